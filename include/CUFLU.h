@@ -70,6 +70,45 @@ struct FluVar5 { real Rho, Px, Py, Pz, Egy; };
 #endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 
 
+// number of components evolved by the data reconstruction and half-step prediction of the MHM schemes
+// --> PASSIVE_MASS_FLUX: passive scalars are excluded, and their face values are set by CPU_PassiveFaceValue()
+#ifdef PASSIVE_MASS_FLUX
+#  define NCOMP_PRED      NCOMP_FLUID
+#else
+#  define NCOMP_PRED      NCOMP_TOTAL
+#endif
+
+
+// component classes of the hydro solvers
+// --> per-component kernels (e.g., the cylindrical flux gradients) are templates on the component class
+//     so that the class-dependent branches are resolved at compile time
+#define COMP_DENS       0     // mass density
+#define COMP_MOMPHI     1     // azimuthal momentum (MOMY) in the cylindrical coordinates
+#define COMP_MOM        2     // other momentum components
+#define COMP_ENGY       3     // total energy density
+#define COMP_PASSIVE    4     // passive scalars
+
+// apply OP( Class, v_start, v_end ) to each contiguous run [v_start, v_end) of components of the same class
+#define FOR_EACH_COMP_CLASS( OP )                  \
+   OP( COMP_DENS,    DENS,        MOMX        )    \
+   OP( COMP_MOM,     MOMX,        MOMY        )    \
+   OP( COMP_MOMPHI,  MOMY,        MOMZ        )    \
+   OP( COMP_MOM,     MOMZ,        ENGY        )    \
+   OP( COMP_ENGY,    ENGY,        NCOMP_FLUID )    \
+   OP( COMP_PASSIVE, NCOMP_FLUID, NCOMP_TOTAL )
+
+
+// stages of the CPU MHM/MHM_RP solvers timed by OPT__RECORD_FLU_BANDWIDTH (see Aux_Record_FluBandwidth())
+#define MHM_STAGE_INPUT       0     // input primitive variables and geometric source terms
+#define MHM_STAGE_HALF_FLUX   1     // half-step fluxes by Riemann solver (MHM_RP only)
+#define MHM_STAGE_HALF_VAR    2     // half-step cell-centered solutions  (MHM_RP only)
+#define MHM_STAGE_RECON       3     // data reconstruction
+#define MHM_STAGE_HANCOCK     4     // half-step face-centered solutions  (MHM only)
+#define MHM_STAGE_FLUX        5     // full-step fluxes
+#define MHM_STAGE_UPDATE      6     // full-step update
+#define MHM_NSTAGE            7
+
+
 // check the non-physical negative values (e.g., negative density) inside the fluid solver
 #ifdef GAMER_DEBUG
 #  define CHECK_NEGATIVE_IN_FLUID
@@ -24,7 +24,9 @@
 #endif
 
 #ifdef GRAVITY
-#  ifdef FLOAT8
+#  ifdef SUPPORT_FFTW3
+#     include <fftw3.h>
+#  elif ( defined FLOAT8 )
 #     ifdef SERIAL
 #        include <drfftw.h>
 #     else
@@ -63,6 +63,7 @@ extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_
 extern bool       OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
 extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 extern bool       OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
+extern bool       OPT__RECORD_FLU_BANDWIDTH;
 extern bool       OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
 extern bool       OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
 extern bool       OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
@@ -96,9 +97,22 @@ extern bool             OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLA
 extern bool             OPT__FLAG_VORTICITY, OPT__FLAG_JEANS, JEANS_MIN_PRES;
 extern int              OPT__CK_NEGATIVE, JEANS_MIN_PRES_LEVEL, JEANS_MIN_PRES_NCELL;
 extern double           MIN_DENS, MIN_PRES;
+extern int              FLU_TILE_CACHE_KB;
 #ifdef DUAL_ENERGY
 extern double           DUAL_ENERGY_SWITCH;
 #endif
+#ifdef COOLING
+extern bool             OPT__CK_COOL_TABLE, OPT__COOL_SUBCYCLE;
+extern double           COOL_SUBCYCLE_TOL, COOL_LB_WEIGHT;
+extern int              COOL_SUBCYCLE_NMAX;
+#endif
+#if ( COORDINATE == CYLINDRICAL )
+extern CylGeo_t         CylGeo[NLEVEL];
+extern OptOrbitalAdv_t  OPT__ORBITAL_ADV;
+extern real            *OrbAdv_Vphi;
+extern int              LTS_NBIN;
+extern OptCylRGrid_t    OPT__CYL_RGRID;
+#endif
 
 #elif ( MODEL == MHD )
 #warning WAIT MHD !!!
@@ -132,12 +146,25 @@ extern int        Rho_ParaBuf;                        // number of parallel buff
 extern real      *GreenFuncK;
 #elif ( COORDINATE == CYLINDRICAL )
 extern real     **KernelFuncK;
+extern int      *KernelPairIdx, kernel_npair;
+extern long      kernel_size;
+extern int       kernel_nm, CYL_POISSON_MMAX;
+extern double    CYL_HMATRIX_TOL;
+extern bool      CYL_KERNEL_CACHE;
+#ifdef SUPPORT_FFTW3
+extern bool      CYL_FFTW3_WISDOM, CYL_FFTW3_SINGLE;
+#endif
+extern int       KernelHMat_NBlock, (*KernelHMat_Block)[4], *KernelHMat_Rank;
+extern long     *KernelHMat_Offset;
+extern real     *KernelHMat_Data;
 extern real     **RhoK, **PhiK;
 //
 extern int       RANK_I_TOT, RANK_IP_TOT ;
+extern int       CYL_RANK_TUNE_NTRIAL;
 // below are for MPI
 extern real     *SendBuf_Rho, *RecvBuf_Rho, *SendBuf_Phi, *RecvBuf_Phi;
-extern real     *PhiK_All_re, *PhiK_All_im, *PhiK_local_re, *PhiK_local_im;
+extern real     *PhiK_All, *PhiK_Recv;
+extern int      *PhiK_OwnStart;
 extern int      *SendBuf_IDPlanXp, *RecvBuf_IDPlanXp, *SendBuf_I, *RecvBuf_I ;
 extern long     *SendBuf_IDPlanYZ, *RecvBuf_IDPlanYZ, *SendBuf_PID, *RecvBuf_PID ;
 //
@@ -222,6 +249,9 @@ extern char            GRACKLE_CLOUDY_TABLE[MAX_STRING];
 extern int             GRACKLE_THREE_BODY_RATE;
 extern int             GRACKLE_CIE_COOLING;
 extern int             GRACKLE_H2_OPA_APPROX;
+extern bool            GRACKLE_LAZY;
+extern double          GRACKLE_LAZY_TOL;
+extern bool            GRACKLE_ZERO_COPY;
 extern int             CHE_GPU_NPGROUP;
 extern real            dt_Grackle_global, dt_Grackle_local; 
 
@@ -277,9 +307,14 @@ extern real       (*h_Flu_Array_USG_G[2])[GRA_NIN-1][PS1][PS1][PS1];
 
 #ifdef SUPPORT_GRACKLE
 extern real       (*h_Che_Array[2]);
+extern char        *h_Che_Active  [2];
+extern int         *h_Che_PGOffset[2];
+extern int          h_Che_NCell   [2];
+extern real        *h_Che_CoolTime;
 // do not declare Grackle variables for CUDA source files since they do not include <grackle.h>
 #ifndef __CUDACC__
 extern grackle_field_data *Che_FieldData;
+extern grackle_field_data *Che_FieldData_Patch;
 extern code_units Che_Units;
 #endif
 #endif // SUPPORT_GRACKLE
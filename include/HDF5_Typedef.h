@@ -419,6 +419,9 @@ struct InputPara_t
    int    Opt__WAF_Limiter;
    int    Opt__1stFluxCorr;
    int    Opt__1stFluxCorrScheme;
+#  if ( COORDINATE == CYLINDRICAL )
+   int    Opt__CylRGrid;
+#  endif
 #  endif
 
 // ELBDM solvers
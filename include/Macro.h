@@ -603,6 +603,20 @@
 #endif
 
 
+// fields stored in the array "che_cache" for GRACKLE_LAZY and the marker indicating that it has NOT been properly set
+// --> the marker is stored in che_cache[CHE_CACHE_DENS][0][0][0]
+#ifdef SUPPORT_GRACKLE
+#  define CHE_CACHE_DENS         0
+#  define CHE_CACHE_SEINT        1
+#  define CHE_CACHE_DSEINT       2
+#  define NCHE_CACHE             3
+#  define CHE_CACHE_NEED_INIT    __FLT_MAX__
+
+// number of cells sent into the Grackle solver at a time must be a multiple of CHE_NCELL_ALIGN (see CPU_GrackleSolver())
+#  define CHE_NCELL_ALIGN        ( 16*PS2 )
+#endif
+
+
 // markers for inactive particles
 #ifdef PARTICLE
 #  define PAR_INACTIVE_OUTSIDE   ( -1.0 )
@@ -648,6 +662,10 @@
 #define TOP_LEVEL          ( NLEVEL - 1 )
 
 
+// maximum number of time-step bins of the base-level local time-stepping (see Flu_AdvanceDt_LTS)
+#define LTS_NBIN_MAX       8
+
+
 // maximum length for strings
 #define MAX_STRING         512
 
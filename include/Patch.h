@@ -138,6 +138,11 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                  --> for LOAD_BALANCE only
 //                NPar_Escp       : Number of particles escaping from this patch
 //                ParList_Escp    : List recording the IDs of all particles escaping from this patch
+//                CoolNSub        : Total number of cooling substeps taken by all cells of this patch in the last update
+//                                  --> set by Hydro_Cooling_AdvanceDt() and used as the load-balance weighting of cooling
+//                che_cache       : Density, specific internal energy, and its time derivative of each cell right after
+//                                  the last Grackle update (see NCHE_CACHE in Macro.h)
+//                                  --> for GRACKLE_LAZY only; allocated by Grackle_Prepare() and only for patch[0]
 //
 // Method      :  patch_t         : Constructor
 //               ~patch_t         : Destructor
@@ -152,6 +157,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                sdelete         : Deallocate the dual-energy status array
 //                dnew            : Allocate the rho_ext array
 //                ddelete         : Deallocate the rho_ext array
+//                cnew            : Allocate the che_cache array
+//                cdelete         : Deallocate the che_cache array
 //                AddParticle     : Add particles to the particle list
 //                RemoveParticle  : Remove particles from the particle list
 //-------------------------------------------------------------------------------------------------------
@@ -211,6 +218,14 @@ struct patch_t
    long  *ParList_Escp[26];
 #  endif
 
+#  ifdef COOLING
+   int    CoolNSub;
+#  endif
+
+#  ifdef SUPPORT_GRACKLE
+   real (*che_cache)[PATCH_SIZE][PATCH_SIZE][PATCH_SIZE];
+#  endif
+
 
 
    //===================================================================================
@@ -385,6 +400,16 @@ struct patch_t
       }
 #     endif
 
+#     ifdef COOLING
+      CoolNSub     = 0;
+#     endif
+
+#     ifdef SUPPORT_GRACKLE
+      if ( InitPtrAsNull )          che_cache = NULL;
+//    the cache of a reused patch no longer applies
+      else if ( che_cache != NULL ) che_cache[CHE_CACHE_DENS][0][0][0] = CHE_CACHE_NEED_INIT;
+#     endif
+
    } // METHOD : Activate
 
 
@@ -407,6 +432,10 @@ struct patch_t
       sdelete();
 #     endif
 
+#     ifdef SUPPORT_GRACKLE
+      cdelete();
+#     endif
+
 #     ifdef PARTICLE
       ddelete();
 
@@ -680,6 +709,49 @@ struct patch_t
       }
 
    } // METHOD : ddelete
+#  endif // #ifdef PARTICLE
+
+
+
+#  ifdef SUPPORT_GRACKLE
+   //===================================================================================
+   // Method      :  cnew
+   // Description :  Allocate the che_cache array
+   //
+   // Note        :  Do nothing if the che_cache array has been allocated
+   //===================================================================================
+   void cnew()
+   {
+
+      if ( che_cache == NULL )   che_cache = new real [NCHE_CACHE][PATCH_SIZE][PATCH_SIZE][PATCH_SIZE];
+
+//    always initialize che_cache (even if che_cache != NULL when calling this function) to indicate that this array
+//    has NOT been properly set --> used by Grackle_Prepare()
+      che_cache[CHE_CACHE_DENS][0][0][0] = CHE_CACHE_NEED_INIT;
+
+   } // METHOD : cnew
+
+
+
+   //===================================================================================
+   // Method      :  cdelete
+   // Description :  Deallocate the che_cache array
+   //===================================================================================
+   void cdelete()
+   {
+
+      if ( che_cache != NULL )
+      {
+         delete [] che_cache;
+         che_cache = NULL;
+      }
+
+   } // METHOD : cdelete
+#  endif // #ifdef SUPPORT_GRACKLE
+
+
+
+#  ifdef PARTICLE
 
 
 
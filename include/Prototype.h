@@ -33,6 +33,9 @@ void Aux_AccumulatedTiming( const double TotalT, double InitT, double OtherT );
 void Aux_Record_Timing();
 void Aux_Record_PatchCount();
 void Aux_Record_Performance( const double ElapsedTime );
+void Aux_Record_FluBandwidth();
+void Aux_Record_CoolSubcycle();
+void Aux_Record_GrackleLazy();
 void Aux_Record_CorrUnphy();
 int  Aux_CountRow( const char *FileName );
 #ifndef SERIAL
@@ -40,6 +43,7 @@ void Aux_Record_BoundaryPatch( const int lv, int *NList, int **IDList, int **Pos
 #endif
 void Aux_SwapPointer( void **Ptr1, void **Ptr2 );
 double Aux_Coord_CellIdx2AdoptedCoord( const int lv, const int PID, const int dim, const int idx );
+double Aux_Coord_CellIdx2CellWidth( const int lv, const int PID, const int dim, const int idx );
 double Aux_Coord_CellIdx2Volume( const int lv, const int PID, const int i, const int j, const int k );
 void Aux_Coord_CellIdx2CartesianCoord( const int lv, const int PID, const int i, const int j, const int k, double xyz[] );
 void Aux_Coord_Adopted2CartesianCoord( const double in[], double out[] );
@@ -209,7 +213,7 @@ void   dt_Prepare_Pot( const int lv, real h_Pot_Array_T[][ CUBE(GRA_NXT) ], cons
                        const double PrepTime );
 #endif
 void   dt_Prepare_Corner( const int lv, double h_Corner_Array_T[][3], const int NPG, const int *PID0_List );
-void   dt_Close( const real h_dt_Array_T[], const int NPG );
+void   dt_Close( const Solver_t TSolver, const int lv, const real h_dt_Array_T[], const int NPG, const int *PID0_List );
 void   CPU_dtSolver( const Solver_t TSolver, real dt_Array[], const real Flu_Array[][NCOMP_FLUID][ CUBE(PS1) ],
                      const real Pot_Array[][ CUBE(GRA_NXT) ], const double Corner_Array[][3],
                      const int NPatchGroup, const real dh[], const real Safety, const real Gamma, const real MinPres,
@@ -307,14 +311,26 @@ void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveS
 void Init_CrtFFTW();
 #elif (COORDINATE == CYLINDRICAL)
 void Init_CylFFTW();
+#ifdef SUPPORT_FFTW3
+void Init_CylFFTW_Batch( real **RhoK, const int NSlab_Rho, real **PhiK, const int NSlab_Phi );
+#endif
+void CylFFTW_Slab( real *Slab );
+void CylFFTW_Forward( real **Slab, const int NSlab );
+void CylFFTW_Inverse( real **Slab, const int NSlab );
+void CylFFTW_AllocateSlab( real **&Slab, const int NSlab );
+void CylFFTW_DeallocateSlab( real **&Slab );
 void Init_CylKernel();
+void CylKernel_Pair( const int ii, const int iip, real *KernelSlab, real *Kernel, real &MaxRe, real &MaxIm );
+void Init_CylKernel_HMatrix( const int global_nx_start, const int global_nxp_start );
 void Init_MemAllocate_CylPoisson(const long slab_size);
+void Init_CylRankTuner();
+bool CylKernel_LoadCache();
+void CylKernel_SaveCache();
 void End_MemFree_CylPoisson();
 void CPU_CylPoissonSolver( const real Poi_Coeff, const int SaveSg, const double PrepTime );
-void Patch2Slab(real **RhoK, int SlabID2Rank[], long SlabID2PID[], const double PrepTime, 
-                const int local_ny, const int global_nxp_start );
-void Slab2Patch(real **PhiK, const int SaveSg, int SlabID2Rank[], long SlabID2PID[],
-                const int local_nx, const int local_ny, const int local_nx_start, const real Coeff );
+void Patch2Slab(real **RhoK, const double PrepTime, const int local_ny, const int global_nxp_start );
+void Slab2Patch(real **PhiK, const int SaveSg, const int local_ny, const int global_nx_start, const real Coeff );
+void CylPoisson_FreeSchedule();
 #endif
 void End_MemFree_PoissonGravity();
 void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
@@ -417,6 +433,26 @@ void Hydro_BoundaryCondition_Reflecting( real *Array, const int BC_Face, const i
                                          const int Idx_Start[], const int Idx_End[], const int TFluVarIdxList[],
                                          const int NVar_Der, const int TDerVarList[] );
 bool Hydro_Flag_Vorticity( const int i, const int j, const int k, const int lv, const int PID, const double Threshold );
+#if ( COORDINATE == CYLINDRICAL )
+void Hydro_Init_CylGeo();
+void Hydro_End_CylGeo();
+#ifdef COOLING
+void Hydro_Init_CoolTable();
+void Hydro_End_CoolTable();
+void Hydro_Cooling_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg );
+#endif
+void Hydro_OrbAdv_Init();
+void Hydro_OrbAdv_End();
+void Hydro_OrbAdv_SetVphi( const int lv, const int FluSg, const double TTime );
+void Hydro_OrbAdv_Shift( const int lv, const int FluSg, const double dt );
+void Flu_LTS_Init();
+void Flu_LTS_End();
+void Flu_LTS_RecordDt( const int lv, const real h_dt_Array_T[], const int NPG, const int *PID0_List );
+int  Flu_LTS_SetBin( const int lv );
+void Flu_LTS_StoreFlux( const int lv, const real h_Flux_Array[][9][NFLUX_TOTAL][4*PATCH_SIZE*PATCH_SIZE],
+                        const int NPG, const int *PID0_List, const real dt );
+int  Flu_AdvanceDt_LTS( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg );
+#endif
 
 
 // MHD model
@@ -573,11 +609,13 @@ void Grackle_Init_FieldData();
 void Grackle_End();
 void Init_MemAllocate_Grackle( const int Che_NPG );
 void End_MemFree_Grackle();
-void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int *PID0_List );
-void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], const int NPG, const int *PID0_List );
+void Grackle_Prepare( const int lv, const double dt, real h_Che_Array[], char Che_Active[], int PGOffset[], int &NCell,
+                      const int NPG, const int *PID0_List );
+void Grackle_Close( const int lv, const int SaveSg, const double dt, const real h_Che_Array[], const char Che_Active[],
+                    const int PGOffset[], const int NPG, const int *PID0_List );
 void Grackle_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg,
                         const bool OverlapMPI, const bool Overlap_Sync );
-void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NPatchGroup, const real dt );
+void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NCell, const real dt );
 
 #ifdef MODEL_IC_GRACKLE
 void Init_GrackleField();
@@ -34,6 +34,9 @@ extern void (*End_User_Ptr)();
 extern void (*Init_ExternalAcc_Ptr)();
 extern void (*Init_ExternalPot_Ptr)();
 #endif
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+extern double (*OrbAdv_Vphi_User_Ptr)( const double R, const double Z, const double Time );
+#endif
 #ifdef PARTICLE
 extern void (*Par_Init_ByFunction_Ptr)( const long NPar_ThisRank, const long NPar_AllRank,
                                         real *ParMass, real *ParPosX, real *ParPosY, real *ParPosZ,
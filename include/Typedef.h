@@ -23,6 +23,29 @@ typedef float  real;
 #endif
 
 
+// complex number with the memory layout of both the FFTW2 "fftw_complex" struct and the FFTW3 "fftw_complex" array
+// --> allow the cylindrical Poisson solver to access the FFT data independent of the FFTW version
+typedef struct { real re, im; } CylComplex_t;
+
+
+// radial geometry factors of the cylindrical hydro solver at one level (see Init_CylGeo)
+// --> all arrays are indexed by the global radial cell index + NGhost
+typedef struct
+{
+   int   NGhost;                     // number of ghost cells stored on each side of the domain
+   int   N;                          // number of entries in each array
+   real *r, *r2, *_r, *_r2;          // cell-centre radius r, r^2, 1/r, 1/r^2
+   real *rR, *rR2;                   // outer face radius rR and rR^2
+   real *rL_r, *rR_r;                // face-to-centre ratios rL/r and rR/r
+   real *rL2_r2, *rR2_r2;            // squared ratios (rL/r)^2 and (rR/r)^2
+   real *dh_6r;                      // dr/(6r) of the PLM face-value correction
+   real *SlopeCorr[3];               // PLM slope corrections of the backward/forward/centred differences
+   real *dh_dr;                      // dh/dr of the radial flux differences (1 for OPT__CYL_RGRID == CYL_RGRID_UNIFORM)
+   real *r_m32;                      // r^(-3/2) of the Keplerian dynamical time used by the cooling kernel
+   double *rFace;                    // inner face radius in double precision (N+1 entries --> rFace[N] = outer edge)
+} CylGeo_t;
+
+
 // short names for unsigned type
 typedef unsigned short     ushort;
 typedef unsigned int       uint;
@@ -326,6 +349,26 @@ const OptRSolver1st_t
 #endif // #if ( MODEL == HYDRO || MODEL == MHD )
 
 
+// OPT__ORBITAL_ADV options
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+typedef int OptOrbitalAdv_t;
+const OptOrbitalAdv_t
+   ORB_ADV_NONE    = 0,
+   ORB_ADV_AVERAGE = 1,
+   ORB_ADV_USER    = 2;
+#endif
+
+
+// OPT__CYL_RGRID options
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+typedef int OptCylRGrid_t;
+const OptCylRGrid_t
+   CYL_RGRID_UNIFORM = 0,
+   CYL_RGRID_LOG     = 1,
+   CYL_RGRID_TABLE   = 2;
+#endif
+
+
 // OPT__CORR_AFTER_ALL_SYNC options
 typedef int OptCorrAfterSync_t;
 const OptCorrAfterSync_t
@@ -44,6 +44,10 @@ void Aux_Check_Parameter()
 #     error : ERROR : currently UNSPLIT_GRAVITY is only supported in HYDRO !!
 #  endif
 
+#  if ( defined COOLING  &&  ( MODEL != HYDRO || COORDINATE != CYLINDRICAL )  )
+#     error : ERROR : currently COOLING only works with HYDRO in the CYLINDRICAL coordinates !!
+#  endif
+
 #  if ( NCOMP_PASSIVE < 0 )
 #     error : ERROR : incorrect number of NCOMP_PASSIVE !!
 #  endif
@@ -633,6 +637,10 @@ void Aux_Check_Parameter()
 #     error : ERROR : RTVD and WAF do not support UNSPLIT_GRAVITY !!
 #  endif
 
+#  if (  defined PASSIVE_MASS_FLUX  &&  ( defined GPU || ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP ) )  )
+#     error : ERROR : PASSIVE_MASS_FLUX only supports the CPU MHM and MHM_RP schemes !!
+#  endif
+
 #  if ( defined LR_SCHEME  &&  LR_SCHEME != PLM  &&  LR_SCHEME != PPM )
 #     error : ERROR : unsupported data reconstruction scheme (PLM/PPM) !!
 #  endif
@@ -682,6 +690,57 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "RTVD and WAF fluid schemes do not support \"JEANS_MIN_PRES\" !!\n" );
 #  endif
 
+#  if ( COORDINATE == CYLINDRICAL )
+   if ( OPT__ORBITAL_ADV != ORB_ADV_NONE )
+   {
+#     if ( defined GPU  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP ) )
+         Aux_Error( ERROR_INFO, "\"OPT__ORBITAL_ADV\" only supports the CPU MHM and MHM_RP fluid schemes !!\n" );
+#     endif
+
+      if ( MAX_LEVEL != 0 )
+         Aux_Error( ERROR_INFO, "\"OPT__ORBITAL_ADV\" only supports MAX_LEVEL == 0 (current = %d) !!\n", MAX_LEVEL );
+
+      if ( OPT__BC_FLU[2] != BC_FLU_PERIODIC  ||  OPT__BC_FLU[3] != BC_FLU_PERIODIC )
+         Aux_Error( ERROR_INFO, "\"OPT__ORBITAL_ADV\" only supports the periodic boundary condition along phi !!\n" );
+   }
+
+   if ( LTS_NBIN > 1 )
+   {
+#     if ( defined GPU  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP ) )
+         Aux_Error( ERROR_INFO, "\"LTS_NBIN\" > 1 only supports the CPU MHM and MHM_RP fluid schemes !!\n" );
+#     endif
+
+#     ifdef COMOVING
+         Aux_Error( ERROR_INFO, "\"LTS_NBIN\" > 1 does not support COMOVING !!\n" );
+#     endif
+
+      if ( MAX_LEVEL != 0 )
+         Aux_Error( ERROR_INFO, "\"LTS_NBIN\" > 1 only supports MAX_LEVEL == 0 (current = %d) !!\n", MAX_LEVEL );
+
+//    the shear limit of OPT__ORBITAL_ADV is part of the CFL criterion scaled by the bins, whereas
+//    Hydro_OrbAdv_Shift() is applied once per macro step
+      if ( OPT__ORBITAL_ADV != ORB_ADV_NONE )
+         Aux_Error( ERROR_INFO, "\"LTS_NBIN\" > 1 does not support \"OPT__ORBITAL_ADV\" !!\n" );
+   }
+
+   if ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+   {
+#     if ( defined GPU  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP ) )
+         Aux_Error( ERROR_INFO, "\"OPT__CYL_RGRID\" only supports the CPU MHM and MHM_RP fluid schemes !!\n" );
+#     endif
+
+      if ( MAX_LEVEL != 0 )
+         Aux_Error( ERROR_INFO, "\"OPT__CYL_RGRID\" only supports MAX_LEVEL == 0 (current = %d) !!\n", MAX_LEVEL );
+
+      if ( OPT__CYL_RGRID == CYL_RGRID_LOG  &&  amr->BoxEdgeL[0] <= 0.0 )
+         Aux_Error( ERROR_INFO, "\"OPT__CYL_RGRID\" == %d requires BOX_EDGE_LEFT_X (%14.7e) > 0.0 !!\n",
+                    CYL_RGRID_LOG, amr->BoxEdgeL[0] );
+
+      if ( OPT__BC_FLU[0] == BC_FLU_PERIODIC  ||  OPT__BC_FLU[1] == BC_FLU_PERIODIC )
+         Aux_Error( ERROR_INFO, "\"OPT__CYL_RGRID\" does not support the periodic boundary condition along r !!\n" );
+   }
+#  endif
+
 
 // warnings
 // ------------------------------
@@ -719,6 +778,16 @@ void Aux_Check_Parameter()
       Aux_Message( stderr, "WARNING : currently we do not use Grackle to calculate temperature for OPT__FLAG_LOHNER_TEMP !!\n" );
 #  endif
 
+#  ifdef COOLING
+   if ( !OPT__COOL_SUBCYCLE )
+      Aux_Message( stderr, "REMINDER : OPT__COOL_SUBCYCLE is off --> cooling is evaluated by the fluid solver and limits the time-step\n" );
+
+#  ifndef LOAD_BALANCE
+   if ( OPT__COOL_SUBCYCLE  &&  COOL_LB_WEIGHT > 0.0 )
+      Aux_Message( stderr, "WARNING : %s is useless since %s is off !!\n", "COOL_LB_WEIGHT", "LOAD_BALANCE" );
+#  endif
+#  endif
+
    } // if ( MPI_Rank == 0 )
 
 
@@ -1004,6 +1073,10 @@ void Aux_Check_Parameter()
 #     error : ERROR : POT_GHOST_SIZE < 1 !!
 #  endif
 
+#  if ( defined SUPPORT_FFTW3  &&  COORDINATE != CYLINDRICAL )
+#     error : ERROR : SUPPORT_FFTW3 only works with COORDINATE == CYLINDRICAL !!
+#  endif
+
 #  ifdef GPU
 #     if ( POT_GHOST_SIZE > 5 )
 #        error : ERROR : POT_GHOST_SIZE must <= 5 for the GPU Poisson solver !!
@@ -1062,6 +1135,19 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "non-Cartesian coordinates only support isolated gravity (OPT__BC_POT=2) !!\n" );
 #  endif
 
+#  if ( COORDINATE == CYLINDRICAL )
+// RANK_I_TOT <= 0 will be set by Init_CylRankTuner()
+   if ( RANK_I_TOT > 0 )
+   {
+      if ( RANK_I_TOT*RANK_IP_TOT != MPI_NRank )
+         Aux_Error( ERROR_INFO, "RANK_I_TOT (%d) * RANK_IP_TOT (%d) != MPI_NRank (%d) !!\n",
+                    RANK_I_TOT, RANK_IP_TOT, MPI_NRank );
+
+      if ( NX0_TOT[0] % RANK_IP_TOT != 0 )
+         Aux_Error( ERROR_INFO, "NX0_TOT[0] (%d) %% RANK_IP_TOT (%d) != 0 !!\n", NX0_TOT[0], RANK_IP_TOT );
+   }
+#  endif
+
    if ( OPT__GRAVITY_TYPE != GRAVITY_SELF  &&  OPT__GRAVITY_TYPE != GRAVITY_EXTERNAL  &&  OPT__GRAVITY_TYPE != GRAVITY_BOTH )
       Aux_Error( ERROR_INFO, "unsupported option \"%s = %d\" [1/2/3] !!\n", "OPT__GRAVITY_TYPE", OPT__GRAVITY_TYPE );
 
@@ -1114,6 +1200,17 @@ void Aux_Check_Parameter()
    }
 #  endif
 
+#  if ( defined SUPPORT_FFTW3  &&  !defined FLOAT8 )
+   if ( CYL_FFTW3_SINGLE )
+      Aux_Message( stderr, "WARNING : CYL_FFTW3_SINGLE is useless when FLOAT8 is off !!\n" );
+#  endif
+
+#  if ( COORDINATE == CYLINDRICAL )
+   if ( CYL_POISSON_MMAX >= NX0_TOT[1]/2 )
+      Aux_Message( stderr, "WARNING : CYL_POISSON_MMAX (%d) >= NX0_TOT[1]/2 (%d) --> all azimuthal modes are retained !!\n",
+                   CYL_POISSON_MMAX, NX0_TOT[1]/2 );
+#  endif
+
    } // if ( MPI_Rank == 0 )
 
 
@@ -1298,6 +1395,9 @@ void Aux_Check_Parameter()
 
 // errors
 // ------------------------------
+   if ( GRACKLE_ACTIVATE  &&  GRACKLE_ZERO_COPY  &&  GRACKLE_LAZY )
+      Aux_Error( ERROR_INFO, "GRACKLE_ZERO_COPY does not work with GRACKLE_LAZY !!\n" );
+
    /*
    if ( CHE_GPU_NPGROUP % GPU_NSTREAM != 0 )
       Aux_Error( ERROR_INFO, "CHE_GPU_NPGROUP (%d) %% GPU_NSTREAM (%d) != 0 !!\n",
@@ -1311,6 +1411,9 @@ void Aux_Check_Parameter()
    if ( OPT__OVERLAP_MPI )
       Aux_Message( stderr, "WARNING : currently SUPPORT_GRACKLE does not support \"%s\" !!\n", "OPT__OVERLAP_MPI" );
 
+   if ( GRACKLE_ACTIVATE  &&  GRACKLE_LAZY )
+      Aux_Message( stderr, "REMINDER : GRACKLE_LAZY does not update the chemical species of quiescent cells\n" );
+
    } // if ( MPI_Rank == 0 )
 
 #endif // SUPPORT_GRACKLE
@@ -14,6 +14,7 @@
 //                      Spherical  : (0/1/2) <--> (r/theta/phi)
 //                2. Only work on one target direction at a time
 //                3. Always work on double precision
+//                4. The cylindrical radius is taken from the mapped radial grid of OPT__CYL_RGRID (see Hydro_Init_CylGeo())
 //
 // Parameter   :  lv  : Target AMR level
 //                PID : Target patch ID
@@ -37,12 +38,68 @@ double Aux_Coord_CellIdx2AdoptedCoord( const int lv, const int PID, const int di
 #  endif
 
 
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   if ( dim == 0  &&  OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+   {
+      const double *rFace = CylGeo[lv].rFace;
+      const int     t     = amr->patch[0][lv][PID]->corner[0]/amr->scale[lv] + idx + CylGeo[lv].NGhost;
+
+      return 0.5*( rFace[t] + rFace[t+1] );
+   }
+#  endif
+
    return amr->patch[0][lv][PID]->EdgeL[dim] + (idx+0.5)*amr->dh[lv][dim];
 
 } // FUNCTION : Aux_Coord_CellIdx2AdoptedCoord
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Coord_CellIdx2CellWidth
+// Description :  Convert the input AMR level, patch ID, and cell index to the cell width along the target
+//                direction of the adopted coordinate system
+//
+// Note        :  1. Return amr->dh[lv][dim] except for the cylindrical radius of a mapped radial grid
+//                   (OPT__CYL_RGRID != CYL_RGRID_UNIFORM)
+//                2. The width is measured in the adopted coordinate (e.g., dphi instead of r*dphi)
+//                3. Always work on double precision
+//
+// Parameter   :  lv  : Target AMR level
+//                PID : Target patch ID
+//                dim : Target direction
+//                idx : Target cell index along the target direction
+//
+// Return      :  Cell width along the target direction
+//-------------------------------------------------------------------------------------------------------
+double Aux_Coord_CellIdx2CellWidth( const int lv, const int PID, const int dim, const int idx )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( lv < 0  ||  lv > TOP_LEVEL )
+      Aux_Error( ERROR_INFO, "lv = %d lies outside the accepted range !!\n", lv );
+
+   if ( PID < 0  ||  PID >= amr->num[lv] )
+      Aux_Error( ERROR_INFO, "PID = %d lies outside the accepted range (lv %d, NPatch %d) !!\n", PID, lv, amr->num[lv] );
+#  endif
+
+
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   if ( dim == 0  &&  OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+   {
+      const double *rFace = CylGeo[lv].rFace;
+      const int     t     = amr->patch[0][lv][PID]->corner[0]/amr->scale[lv] + idx + CylGeo[lv].NGhost;
+
+      return rFace[t+1] - rFace[t];
+   }
+#  endif
+
+   return amr->dh[lv][dim];
+
+} // FUNCTION : Aux_Coord_CellIdx2CellWidth
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Aux_Coord_CellIdx2CartesianCoord
 // Description :  Convert the input AMR level, patch ID, and cell index to the Cartesian coordinates
@@ -122,7 +179,7 @@ double Aux_Coord_CellIdx2Volume( const int lv, const int PID, const int i, const
    dv = amr->dh[lv][0]*amr->dh[lv][1]*amr->dh[lv][2];
 
 #  elif ( COORDINATE == CYLINDRICAL )
-   const double dr   = amr->dh[lv][0];
+   const double dr   = Aux_Coord_CellIdx2CellWidth( lv, PID, 0, i );
    const double dphi = amr->dh[lv][1];
    const double dz   = amr->dh[lv][2];
    const double r    = Aux_Coord_CellIdx2AdoptedCoord( lv, PID, 0, i );
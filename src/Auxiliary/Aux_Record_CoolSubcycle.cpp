@@ -0,0 +1,101 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  defined COOLING )
+extern long Cool_NCell  [NLEVEL];
+extern long Cool_NSub   [NLEVEL];
+extern int  Cool_NSubMax[NLEVEL];
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_CoolSubcycle
+// Description :  Record the statistics of the cooling substeps taken by Hydro_Cooling_AdvanceDt()
+//
+// Note        :  1. Enabled by OPT__COOL_SUBCYCLE and invoked once per global step
+//                   --> the counters are accumulated over all cooling updates since the last record, and are
+//                       reset here
+//                2. "NSub_Mean" : average number of substeps per cell update
+//                   "NSub_Max"  : maximum number of substeps taken by a single cell
+//                   "Imbalance" : maximum over average number of substeps per rank
+//                   --> a large "Imbalance" indicates that COOL_LB_WEIGHT should be increased
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_CoolSubcycle()
+{
+
+#  if ( MODEL == HYDRO  &&  defined COOLING )
+
+   const char  FileName[] = "Record__CoolSubcycle";
+   static bool FirstTime  = true;
+
+   long NCell_AllRank[NLEVEL], NSub_AllRank[NLEVEL], NSub_MaxRank[NLEVEL];
+   int  NSubMax_AllRank[NLEVEL];
+
+
+// collect from all ranks and reset the counters
+   MPI_Reduce( Cool_NCell,   NCell_AllRank,   NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Cool_NSub,    NSub_AllRank,    NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Cool_NSub,    NSub_MaxRank,    NLEVEL, MPI_LONG, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Cool_NSubMax, NSubMax_AllRank, NLEVEL, MPI_INT,  MPI_MAX, 0, MPI_COMM_WORLD );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Cool_NCell  [lv] = 0;
+      Cool_NSub   [lv] = 0;
+      Cool_NSubMax[lv] = 0;
+   }
+
+
+// only rank 0 needs to take a note
+   if ( MPI_Rank == 0 )
+   {
+//    header
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+
+         FILE *File_Record = fopen( FileName, "a" );
+
+         fprintf( File_Record, "# COOL_SUBCYCLE_TOL = %13.7e, COOL_SUBCYCLE_NMAX = %d, COOL_LB_WEIGHT = %13.7e\n",
+                  COOL_SUBCYCLE_TOL, COOL_SUBCYCLE_NMAX, COOL_LB_WEIGHT );
+         fprintf( File_Record, "#%13s%14s", "Time", "Step" );
+
+         for (int lv=0; lv<NLEVEL; lv++)
+         {
+            char tmp[3][MAX_STRING];
+            sprintf( tmp[0], "NSub_Mean(%d)", lv );
+            sprintf( tmp[1], "NSub_Max(%d)",  lv );
+            sprintf( tmp[2], "Imbalance(%d)", lv );
+            fprintf( File_Record, "%14s%14s%14s", tmp[0], tmp[1], tmp[2] );
+         }
+
+         fprintf( File_Record, "\n" );
+         fclose( File_Record );
+      } // if ( FirstTime )
+
+
+//    record the substep statistics
+      FILE *File_Record = fopen( FileName, "a" );
+
+      fprintf( File_Record, "%14.7e%14ld", Time[0], Step );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         const double NSub_Mean = ( NCell_AllRank[lv] > 0 ) ? (double)NSub_AllRank[lv]/NCell_AllRank[lv] : 0.0;
+         const double Imbalance = ( NSub_AllRank [lv] > 0 ) ? (double)NSub_MaxRank[lv]*MPI_NRank/NSub_AllRank[lv] : 1.0;
+
+         fprintf( File_Record, "%14.4e%14d%14.4e", NSub_Mean, NSubMax_AllRank[lv], Imbalance );
+      }
+
+      fprintf( File_Record, "\n" );
+      fclose( File_Record );
+
+   } // if ( MPI_Rank == 0 )
+
+#  endif // #if ( MODEL == HYDRO  &&  defined COOLING )
+
+} // FUNCTION : Aux_Record_CoolSubcycle
@@ -0,0 +1,113 @@
+#include "GAMER.h"
+#include "CUFLU.h"
+
+#if (  !defined GPU  &&  MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  )
+extern double MHM_StageTime[MHM_NSTAGE];
+extern double MHM_StageByte[MHM_NSTAGE];
+
+int CPU_MHM_TileDepth( const int CacheKB );
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_FluBandwidth
+// Description :  Record the memory bandwidth achieved by each stage of the CPU MHM/MHM_RP fluid solvers
+//
+// Note        :  1. Enabled by OPT__RECORD_FLU_BANDWIDTH and invoked once per global step
+//                   --> the stage timers are accumulated over all fluid solver calls since the last record,
+//                       and are reset here
+//                2. The memory traffic of each stage is modeled by counting each array element read and written
+//                   by the stage once per evaluated cell (see CPU_FluidSolver_MHM())
+//                   --> it is the minimum traffic assuming perfect reuse of the stencil neighbors
+//                3. "t_*"  : elapsed time of each stage per OpenMP thread, averaged over all ranks
+//                   "BW_*" : modeled memory traffic per rank divided by "t_*"
+//                   --> compare "BW_*" with the STREAM bandwidth of one node divided by the number of ranks per
+//                       node to tell whether a stage is memory-bandwidth bound, and compare runs with different
+//                       FLU_TILE_CACHE_KB to measure the effect of the k-slabs
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_FluBandwidth()
+{
+
+#  if (  !defined GPU  &&  MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  )
+
+   const char  FileName[] = "Record__FluBandwidth";
+   const char *StageName[MHM_NSTAGE] = { "Input", "HalfFlux", "HalfVar", "Recon", "Hancock", "Flux", "Update" };
+#  if   ( FLU_SCHEME == MHM_RP )
+   const bool  StageOn  [MHM_NSTAGE] = { COORDINATE == CYLINDRICAL, true, true, true, false, true, true };
+#  elif ( FLU_SCHEME == MHM )
+   const bool  StageOn  [MHM_NSTAGE] = { true, false, false, true, true, true, true };
+#  endif
+   static bool FirstTime = true;
+
+   double Time_AllRank[MHM_NSTAGE], Byte_AllRank[MHM_NSTAGE];
+
+
+// sum over all ranks and reset the stage timers
+   MPI_Reduce( MHM_StageTime, Time_AllRank, MHM_NSTAGE, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( MHM_StageByte, Byte_AllRank, MHM_NSTAGE, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   for (int s=0; s<MHM_NSTAGE; s++)
+   {
+      MHM_StageTime[s] = 0.0;
+      MHM_StageByte[s] = 0.0;
+   }
+
+
+// only rank 0 needs to take a note
+   if ( MPI_Rank == 0 )
+   {
+//    header
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+
+         FILE *File_Record = fopen( FileName, "a" );
+
+         fprintf( File_Record, "# FLU_TILE_CACHE_KB = %d --> %d output plane(s) per k-slab\n",
+                  FLU_TILE_CACHE_KB, CPU_MHM_TileDepth(FLU_TILE_CACHE_KB) );
+         fprintf( File_Record, "# t_* : elapsed time per OpenMP thread (s), BW_* : memory bandwidth per rank (GB/s)\n" );
+         fprintf( File_Record, "#%13s%14s", "Time", "Step" );
+
+         for (int s=0; s<MHM_NSTAGE; s++)
+         {
+            if ( !StageOn[s] )   continue;
+
+            char tmp[2][MAX_STRING];
+            sprintf( tmp[0], "t_%s",  StageName[s] );
+            sprintf( tmp[1], "BW_%s", StageName[s] );
+            fprintf( File_Record, "%14s%14s", tmp[0], tmp[1] );
+         }
+
+         fprintf( File_Record, "\n" );
+         fclose( File_Record );
+      } // if ( FirstTime )
+
+
+//    record the bandwidth
+      FILE *File_Record = fopen( FileName, "a" );
+
+      fprintf( File_Record, "%14.7e%14ld", Time[0], Step );
+
+      for (int s=0; s<MHM_NSTAGE; s++)
+      {
+         if ( !StageOn[s] )   continue;
+
+         const double Time_PerThread = Time_AllRank[s]/MPI_NRank/OMP_NTHREAD;
+         const double BW_PerRank     = ( Time_PerThread > 0.0 ) ? Byte_AllRank[s]/MPI_NRank/Time_PerThread*1.0e-9 : 0.0;
+
+         fprintf( File_Record, "%14.4e%14.4e", Time_PerThread, BW_PerRank );
+      }
+
+      fprintf( File_Record, "\n" );
+      fclose( File_Record );
+
+   } // if ( MPI_Rank == 0 )
+
+#  endif // #if (  !defined GPU  &&  MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  )
+
+} // FUNCTION : Aux_Record_FluBandwidth
@@ -0,0 +1,91 @@
+#include "GAMER.h"
+
+#ifdef SUPPORT_GRACKLE
+extern long Che_Lazy_NCell  [NLEVEL];
+extern long Che_Lazy_NActive[NLEVEL];
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_GrackleLazy
+// Description :  Record the statistics of the activity mask of GRACKLE_LAZY
+//
+// Note        :  1. Enabled by GRACKLE_LAZY and invoked once per global step
+//                   --> the counters are accumulated over all Grackle updates since the last record by
+//                       Grackle_Prepare(), and are reset here
+//                2. "NCell"  : number of cell updates summed over all ranks
+//                   "Active" : fraction of cell updates sent into the Grackle solver
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_GrackleLazy()
+{
+
+#  ifdef SUPPORT_GRACKLE
+
+   const char  FileName[] = "Record__GrackleLazy";
+   static bool FirstTime  = true;
+
+   long NCell_AllRank[NLEVEL], NActive_AllRank[NLEVEL];
+
+
+// sum over all ranks and reset the counters
+   MPI_Reduce( Che_Lazy_NCell,   NCell_AllRank,   NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Che_Lazy_NActive, NActive_AllRank, NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Che_Lazy_NCell  [lv] = 0;
+      Che_Lazy_NActive[lv] = 0;
+   }
+
+
+// only rank 0 needs to take a note
+   if ( MPI_Rank == 0 )
+   {
+//    header
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+
+         FILE *File_Record = fopen( FileName, "a" );
+
+         fprintf( File_Record, "# GRACKLE_LAZY_TOL = %13.7e\n", GRACKLE_LAZY_TOL );
+         fprintf( File_Record, "#%13s%14s", "Time", "Step" );
+
+         for (int lv=0; lv<NLEVEL; lv++)
+         {
+            char tmp[2][MAX_STRING];
+            sprintf( tmp[0], "NCell(%d)",  lv );
+            sprintf( tmp[1], "Active(%d)", lv );
+            fprintf( File_Record, "%14s%14s", tmp[0], tmp[1] );
+         }
+
+         fprintf( File_Record, "\n" );
+         fclose( File_Record );
+      } // if ( FirstTime )
+
+
+//    record the active fraction
+      FILE *File_Record = fopen( FileName, "a" );
+
+      fprintf( File_Record, "%14.7e%14ld", Time[0], Step );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         const double Active = ( NCell_AllRank[lv] > 0 ) ? (double)NActive_AllRank[lv]/NCell_AllRank[lv] : 0.0;
+
+         fprintf( File_Record, "%14ld%14.4e", NCell_AllRank[lv], Active );
+      }
+
+      fprintf( File_Record, "\n" );
+      fclose( File_Record );
+
+   } // if ( MPI_Rank == 0 )
+
+#  endif // #ifdef SUPPORT_GRACKLE
+
+} // FUNCTION : Aux_Record_GrackleLazy
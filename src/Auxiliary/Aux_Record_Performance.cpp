@@ -1,5 +1,8 @@
 #include "GAMER.h"
 
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+extern long Flu_LTS_NUpdateCell[LTS_NBIN_MAX];
+#endif
 
 
 
@@ -14,6 +17,9 @@
 //                       integration is only approximate since the number of patches at each level may change
 //                       during one global time-step
 //                2. When PARTICLE is on, this routine also records the "total number of particle updates per second"
+//                3. For the local time-stepping (LTS_NBIN > 1), the number of cell updates is counted in each time-step
+//                   bin by Flu_AdvanceDt_LTS() and is recorded as "NUpdate_Bin*"
+//                   --> only the macro steps accepted by AUTO_REDUCE_DT are counted
 //
 // Parameter   :  ElapsedTime : Elapsed time of the current global step
 //-------------------------------------------------------------------------------------------------------
@@ -31,6 +37,19 @@ void Aux_Record_Performance( const double ElapsedTime )
 #  endif
 
 
+// get the total number of cell updates in each time-step bin and reset the counters
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   long NUpdateBin_AllRank[LTS_NBIN_MAX];
+
+   if ( LTS_NBIN > 1 )
+   {
+      MPI_Reduce( Flu_LTS_NUpdateCell, NUpdateBin_AllRank, LTS_NBIN, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+      for (int b=0; b<LTS_NBIN; b++)   Flu_LTS_NUpdateCell[b] = 0;
+   }
+#  endif
+
+
 // only rank 0 needs to take a note
    if ( MPI_Rank == 0 )
    {
@@ -58,6 +77,15 @@ void Aux_Record_Performance( const double ElapsedTime )
             fprintf( File_Record, "%14s", tmp );
          }
 
+#        if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+         for (int b=0; b<LTS_NBIN && LTS_NBIN>1; b++)
+         {
+            char tmp[MAX_STRING];
+            sprintf( tmp, "NUpdate_Bin%d", b );
+            fprintf( File_Record, "%14s", tmp );
+         }
+#        endif
+
          fprintf( File_Record, "\n" );
          fclose( File_Record );
       } // if ( FirstTime )
@@ -79,6 +107,15 @@ void Aux_Record_Performance( const double ElapsedTime )
 #        endif
       }
 
+//    the base-level cells are updated a different number of times in each time-step bin of the local time-stepping
+#     if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+      if ( LTS_NBIN > 1 )
+      {
+         NUpdateCell = 0;
+         for (int b=0; b<LTS_NBIN; b++)   NUpdateCell += NUpdateBin_AllRank[b];
+      }
+#     endif
+
 
 //    record performance
       const double NUpdateCell_PerSec         = NUpdateCell/ElapsedTime;
@@ -111,6 +148,11 @@ void Aux_Record_Performance( const double ElapsedTime )
       for (int lv=0; lv<NLEVEL; lv++)
       fprintf( File_Record, "%14ld", amr->NUpdateLv[lv] );
 
+#     if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+      for (int b=0; b<LTS_NBIN && LTS_NBIN>1; b++)
+      fprintf( File_Record, "%14.2e", (double)NUpdateBin_AllRank[b] );
+#     endif
+
       fprintf( File_Record, "\n" );
 
       fclose( File_Record );
@@ -217,6 +217,12 @@ void Aux_TakeNote()
       fprintf( Note, "DUAL_ENERGY                     UNKNOWN\n" );
 #     endif
 
+#     ifdef PASSIVE_MASS_FLUX
+      fprintf( Note, "PASSIVE_MASS_FLUX               ON\n" );
+#     else
+      fprintf( Note, "PASSIVE_MASS_FLUX               OFF\n" );
+#     endif
+
 //    c. options in MHD
 #     elif ( MODEL == MHD )
 #     warning : WAIT MHD !!!
@@ -361,6 +367,12 @@ void Aux_TakeNote()
       fprintf( Note, "SUPPORT_HDF5                    OFF\n" );
 #     endif
 
+#     ifdef SUPPORT_FFTW3
+      fprintf( Note, "SUPPORT_FFTW3                   ON\n" );
+#     else
+      fprintf( Note, "SUPPORT_FFTW3                   OFF\n" );
+#     endif
+
 #     ifdef SUPPORT_GSL
       fprintf( Note, "SUPPORT_GSL                     ON\n" );
 #     else
@@ -820,6 +832,10 @@ void Aux_TakeNote()
       fprintf( Note, "GRACKLE_THREE_BODY_RATE         %d\n",      GRACKLE_THREE_BODY_RATE );
       fprintf( Note, "GRACKLE_CIE_COOLING             %d\n",      GRACKLE_CIE_COOLING     );
       fprintf( Note, "GRACKLE_H2_OPA_APPROX           %d\n",      GRACKLE_H2_OPA_APPROX   );
+      fprintf( Note, "GRACKLE_LAZY                    %d\n",      GRACKLE_LAZY            );
+      if ( GRACKLE_LAZY )
+      fprintf( Note, "GRACKLE_LAZY_TOL                %13.7e\n",  GRACKLE_LAZY_TOL        );
+      fprintf( Note, "GRACKLE_ZERO_COPY               %d\n",      GRACKLE_ZERO_COPY       );
       fprintf( Note, "CHE_GPU_NPGROUP                 %d\n",      CHE_GPU_NPGROUP         ); }
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -876,6 +892,18 @@ void Aux_TakeNote()
                                                                   ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLE ) ? "RSOLVER_1ST_HLLE" :
                                                                   ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_NONE ) ? "NONE"             :
                                                                                                                 "UNKNOWN" );
+      fprintf( Note, "FLU_TILE_CACHE_KB               %d\n",      FLU_TILE_CACHE_KB       );
+#     if ( COORDINATE == CYLINDRICAL )
+      fprintf( Note, "OPT__ORBITAL_ADV                %s\n",      ( OPT__ORBITAL_ADV == ORB_ADV_AVERAGE ) ? "AVERAGE" :
+                                                                  ( OPT__ORBITAL_ADV == ORB_ADV_USER    ) ? "USER"    :
+                                                                  ( OPT__ORBITAL_ADV == ORB_ADV_NONE    ) ? "NONE"    :
+                                                                                                            "UNKNOWN" );
+      fprintf( Note, "LTS_NBIN                        %d\n",      LTS_NBIN                );
+      fprintf( Note, "OPT__CYL_RGRID                  %s\n",      ( OPT__CYL_RGRID == CYL_RGRID_UNIFORM ) ? "UNIFORM" :
+                                                                  ( OPT__CYL_RGRID == CYL_RGRID_LOG     ) ? "LOG"     :
+                                                                  ( OPT__CYL_RGRID == CYL_RGRID_TABLE   ) ? "TABLE"   :
+                                                                                                            "UNKNOWN" );
+#     endif
 #     elif ( MODEL == MHD )
 #     warning : WAIT MHD !!!
 
@@ -947,6 +975,13 @@ void Aux_TakeNote()
 #     endif
 #     ifdef DUAL_ENERGY
       fprintf( Note, "DUAL_ENERGY_SWITCH              %13.7e\n",  DUAL_ENERGY_SWITCH       );
+#     endif
+#     ifdef COOLING
+      fprintf( Note, "OPT__COOL_SUBCYCLE              %d\n",      OPT__COOL_SUBCYCLE       );
+      if ( OPT__COOL_SUBCYCLE ) {
+      fprintf( Note, "COOL_SUBCYCLE_TOL               %13.7e\n",  COOL_SUBCYCLE_TOL        );
+      fprintf( Note, "COOL_SUBCYCLE_NMAX              %d\n",      COOL_SUBCYCLE_NMAX       );
+      fprintf( Note, "COOL_LB_WEIGHT                  %13.7e\n",  COOL_LB_WEIGHT           ); }
 #     endif
       fprintf( Note, "WITH_COARSE_FINE_FLUX           %d\n",      amr->WithFlux            );
 #     ifndef SERIAL
@@ -987,6 +1022,18 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__GRAVITY_TYPE               %d\n",      OPT__GRAVITY_TYPE    );
       fprintf( Note, "OPT__EXTERNAL_POT               %d\n",      OPT__EXTERNAL_POT    );
       fprintf( Note, "AveDensity_Init                 %13.7e\n",  AveDensity_Init      );
+#     if ( COORDINATE == CYLINDRICAL )
+      fprintf( Note, "RANK_I_TOT                      %d\n",      RANK_I_TOT           );
+      fprintf( Note, "RANK_IP_TOT                     %d\n",      RANK_IP_TOT          );
+      fprintf( Note, "CYL_RANK_TUNE_NTRIAL            %d\n",      CYL_RANK_TUNE_NTRIAL );
+      fprintf( Note, "CYL_HMATRIX_TOL                 %13.7e\n",  CYL_HMATRIX_TOL      );
+      fprintf( Note, "CYL_POISSON_MMAX                %d\n",      CYL_POISSON_MMAX     );
+      fprintf( Note, "CYL_KERNEL_CACHE                %d\n",      CYL_KERNEL_CACHE     );
+#     ifdef SUPPORT_FFTW3
+      fprintf( Note, "CYL_FFTW3_WISDOM                %d\n",      CYL_FFTW3_WISDOM     );
+      fprintf( Note, "CYL_FFTW3_SINGLE                %d\n",      CYL_FFTW3_SINGLE     );
+#     endif
+#     endif
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 #     endif // #ifdef GRAVITY
@@ -1124,6 +1171,7 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__TIMING_MPI                 %d\n",      OPT__TIMING_MPI          );
       fprintf( Note, "OPT__RECORD_MEMORY              %d\n",      OPT__RECORD_MEMORY       );
       fprintf( Note, "OPT__RECORD_PERFORMANCE         %d\n",      OPT__RECORD_PERFORMANCE  );
+      fprintf( Note, "OPT__RECORD_FLU_BANDWIDTH       %d\n",      OPT__RECORD_FLU_BANDWIDTH );
       fprintf( Note, "OPT__MANUAL_CONTROL             %d\n",      OPT__MANUAL_CONTROL      );
       fprintf( Note, "OPT__RECORD_USER                %d\n",      OPT__RECORD_USER         );
       fprintf( Note, "OPT__OPTIMIZE_AGGRESSIVE        %d\n",      OPT__OPTIMIZE_AGGRESSIVE );
@@ -1148,6 +1196,9 @@ void Aux_TakeNote()
 #     warning : WAIT MHD !!!
 #     endif // MODEL
       fprintf( Note, "OPT__CK_MEMFREE                 %13.7e\n",  OPT__CK_MEMFREE           );
+#     ifdef COOLING
+      fprintf( Note, "OPT__CK_COOL_TABLE              %d\n",      OPT__CK_COOL_TABLE        );
+#     endif
 #     ifdef PARTICLE
       fprintf( Note, "OPT__CK_PARTICLE                %d\n",      OPT__CK_PARTICLE          );
 #     endif
@@ -40,7 +40,8 @@ void CPU_FluidSolver_MHM( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
                           const real EP_Coeff, const double Time, const OptGravityType_t GravityType,
                           const double ExtAcc_AuxArray[], const real MinDens, const real MinPres,
                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                          const bool JeansMinPres, const real JeansMinPres_Coeff );
+                          const bool JeansMinPres, const real JeansMinPres_Coeff,
+                          const int TileCacheKB, const bool TimeStage );
 #elif ( FLU_SCHEME == CTU )
 void CPU_FluidSolver_CTU( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NXT*FLU_NXT ],
                           real Flu_Array_Out     [][NCOMP_TOTAL][ PS2*PS2*PS2 ],
@@ -202,7 +203,7 @@ void CPU_FluidSolver( real h_Flu_Array_In [][FLU_NIN    ][ FLU_NXT*FLU_NXT*FLU_N
       CPU_FluidSolver_MHM ( h_Flu_Array_In, h_Flu_Array_Out, h_DE_Array_Out, h_Flux_Array, h_Corner_Array, h_Pot_Array_USG,
                             NPatchGroup, dt, dh, Gamma, StoreFlux, LR_Limiter, MinMod_Coeff, EP_Coeff, Time,
                             GravityType, ExtAcc_AuxArray, MinDens, MinPres, DualEnergySwitch, NormPassive, NNorm, NormIdx,
-                            JeansMinPres, JeansMinPres_Coeff );
+                            JeansMinPres, JeansMinPres_Coeff, FLU_TILE_CACHE_KB, OPT__RECORD_FLU_BANDWIDTH );
 
 #     elif ( FLU_SCHEME == CTU )
 
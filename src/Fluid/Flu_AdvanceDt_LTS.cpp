@@ -0,0 +1,651 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+
+// patch groups to be advanced by the fluid solver in the current time-step bin
+// --> adopted by InvokeSolver() instead of all real patch groups when Flu_LTS_PID0_List != NULL
+int   Flu_LTS_NPG       = 0;
+int  *Flu_LTS_PID0_List = NULL;
+
+// number of cell updates of each time-step bin on this rank (recorded and reset by Aux_Record_Performance())
+long  Flu_LTS_NUpdateCell[LTS_NBIN_MAX];
+
+
+// status of the fluid solver used by AUTO_REDUCE_DT (declared in Flu_AdvanceDt.cpp)
+extern int FluStatus_ThisRank;
+
+extern void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const double TTime );
+
+
+static int     LTS_NCol;               // number of radial patch-group columns
+static int    *LTS_Bin      = NULL;    // time-step bin of each column
+static double *LTS_dt_Col   = NULL;    // minimum dt of each column on this rank (set by Flu_LTS_RecordDt())
+static double  LTS_dt_Min;             // minimum dt of all columns
+static int    *LTS_RegID    = NULL;    // flux register of each column interface (-1 if not on a bin boundary)
+static double *LTS_Reg      = NULL;    // flux registers
+static long    LTS_RegSize;            // number of elements in one flux register
+
+static void LTS_CorrectFlux( const int lv, const int FluSg, const int PID0, const int Face, const double *Reg );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_LTS_Init
+// Description :  Allocate the tables of the radially varying local time-stepping
+//
+// Note        :  1. Invoked by Init_GAMER() when LTS_NBIN > 1
+//                2. Each radial column of patch groups (PS2 cells along r spanning the entire phi-z plane)
+//                   is assigned to one time-step bin
+//-------------------------------------------------------------------------------------------------------
+void Flu_LTS_Init()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
+
+
+   LTS_NCol    = NX0_TOT[0] / PS2;
+   LTS_RegSize = (long)NFLUX_TOTAL*NX0_TOT[1]*NX0_TOT[2];
+
+   LTS_Bin    = new int    [LTS_NCol];
+   LTS_dt_Col = new double [LTS_NCol];
+   LTS_RegID  = new int    [LTS_NCol];
+
+   for (int c=0; c<LTS_NCol; c++)
+   {
+      LTS_Bin   [c] = 0;
+      LTS_dt_Col[c] = HUGE_NUMBER;
+      LTS_RegID [c] = -1;
+   }
+
+   for (int b=0; b<LTS_NBIN_MAX; b++)  Flu_LTS_NUpdateCell[b] = 0;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+} // FUNCTION : Flu_LTS_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_LTS_End
+// Description :  Free the tables allocated by Flu_LTS_Init()
+//-------------------------------------------------------------------------------------------------------
+void Flu_LTS_End()
+{
+
+   delete [] LTS_Bin;
+   delete [] LTS_dt_Col;
+   delete [] LTS_RegID;
+   delete [] LTS_Reg;
+
+   LTS_Bin    = NULL;
+   LTS_dt_Col = NULL;
+   LTS_RegID  = NULL;
+   LTS_Reg    = NULL;
+
+} // FUNCTION : Flu_LTS_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_LTS_RecordDt
+// Description :  Record the minimum dt of each radial patch-group column
+//
+// Note        :  1. Invoked by dt_Close() for the fluid dt solver only
+//                   --> the gravity time-step limits the macro step instead (see Mis_GetTimeStep())
+//
+// Parameter   :  lv           : Target refinement level
+//                h_dt_Array_T : Host array storing the minimum dt in each target patch
+//                NPG          : Number of target patch groups
+//                PID0_List    : List recording the patch indicies with LocalID==0 to be udpated
+//-------------------------------------------------------------------------------------------------------
+void Flu_LTS_RecordDt( const int lv, const real h_dt_Array_T[], const int NPG, const int *PID0_List )
+{
+
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const int c = amr->patch[0][lv][ PID0_List[TID] ]->corner[0] / amr->scale[lv] / PS2;
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+         LTS_dt_Col[c] = fmin( LTS_dt_Col[c], (double)h_dt_Array_T[ 8*TID + LocalID ] );
+   }
+
+} // FUNCTION : Flu_LTS_RecordDt
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_LTS_SetBin
+// Description :  Assign each radial patch-group column to a time-step bin
+//
+// Note        :  1. Invoked by Mis_GetTimeStep() after the fluid dt solver
+//                2. Columns in bin b advance with 2^b times the minimum dt of all columns, where b is the largest
+//                   value satisfying this constraint and b < LTS_NBIN
+//                3. Bins of neighboring columns differ by at most one
+//
+// Parameter   :  lv : Target refinement level (must be 0)
+//
+// Return      :  Largest bin of all columns
+//-------------------------------------------------------------------------------------------------------
+int Flu_LTS_SetBin( const int lv )
+{
+
+#  ifdef GAMER_DEBUG
+   if ( lv != 0 )    Aux_Error( ERROR_INFO, "local time-stepping only supports the base level (lv %d) !!\n", lv );
+#  endif
+
+
+// get the minimum dt of each column among all ranks and reset the local record for the next step
+   double *dt_AllRank = new double [LTS_NCol];
+
+   MPI_Allreduce( LTS_dt_Col, dt_AllRank, LTS_NCol, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD );
+
+   for (int c=0; c<LTS_NCol; c++)   LTS_dt_Col[c] = HUGE_NUMBER;
+
+   LTS_dt_Min = HUGE_NUMBER;
+   for (int c=0; c<LTS_NCol; c++)   LTS_dt_Min = fmin( LTS_dt_Min, dt_AllRank[c] );
+
+
+// assign each column to the largest bin allowed by its own dt
+   for (int c=0; c<LTS_NCol; c++)
+   {
+      int b = 0;
+      while (  b < LTS_NBIN-1  &&  LTS_dt_Min*(1<<(b+1)) <= dt_AllRank[c]  )  b++;
+
+      LTS_Bin[c] = b;
+   }
+
+
+// lower the bins so that neighboring columns differ by at most one bin
+// --> two sweeps suffice since bins are only lowered
+   for (int c=1; c<LTS_NCol; c++)      LTS_Bin[c] = MIN( LTS_Bin[c], LTS_Bin[c-1]+1 );
+   for (int c=LTS_NCol-2; c>=0; c--)   LTS_Bin[c] = MIN( LTS_Bin[c], LTS_Bin[c+1]+1 );
+
+   int BinMax = 0;
+   for (int c=0; c<LTS_NCol; c++)   BinMax = MAX( BinMax, LTS_Bin[c] );
+
+
+   delete [] dt_AllRank;
+
+   return BinMax;
+
+} // FUNCTION : Flu_LTS_SetBin
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_LTS_StoreFlux
+// Description :  Accumulate the fluxes across the bin boundaries into the flux registers
+//
+// Note        :  1. Invoked by Flu_Close() and only works during Flu_AdvanceDt_LTS()
+//                2. Each register stores "dt_slow*F_slow - sum(dt_fast*F_fast)" on a radial interface, where
+//                   F are the fluxes already multiplied by the face area factors (see CylFluxScale())
+//                   --> different patch groups in one call never share the same register element since only
+//                       one side of a bin boundary is advanced at a time
+//
+// Parameter   :  lv           : Target refinement level
+//                h_Flux_Array : Host array storing the updated flux data
+//                NPG          : Number of patch groups to be evaluated
+//                PID0_List    : List recording the patch indicies with LocalID==0 to be udpated
+//                dt           : Evolution time-step
+//-------------------------------------------------------------------------------------------------------
+void Flu_LTS_StoreFlux( const int lv, const real h_Flux_Array[][9][NFLUX_TOTAL][4*PATCH_SIZE*PATCH_SIZE],
+                        const int NPG, const int *PID0_List, const real dt )
+{
+
+   if ( Flu_LTS_PID0_List == NULL )    return;
+
+
+   const int NY = NX0_TOT[1];
+   const int NZ = NX0_TOT[2];
+
+#  pragma omp parallel for schedule( runtime )
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const int PID0 = PID0_List[TID];
+      const int i0   = amr->patch[0][lv][PID0]->corner[0] / amr->scale[lv];
+      const int j0   = amr->patch[0][lv][PID0]->corner[1] / amr->scale[lv];
+      const int k0   = amr->patch[0][lv][PID0]->corner[2] / amr->scale[lv];
+      const int c    = i0 / PS2;
+
+//    left and right faces of the patch group --> x planes 0 and 2 of the flux array
+      for (int f=0; f<2; f++)
+      {
+         const int ci  = c - 1 + f;    // interface between the columns ci and ci+1
+         const int cNb = c - 1 + 2*f;  // neighboring column
+
+         if ( ci < 0  ||  ci >= LTS_NCol-1  ||  LTS_RegID[ci] < 0 )  continue;
+
+         const real Coeff = ( LTS_Bin[c] > LTS_Bin[cNb] ) ? +dt : -dt;
+         double    *Reg   = LTS_Reg + LTS_RegID[ci]*LTS_RegSize;
+
+         for (int v=0; v<NFLUX_TOTAL; v++)
+         for (int m=0; m<PS2; m++)
+         for (int n=0; n<PS2; n++)
+            Reg[ ( (long)v*NZ + k0+m )*NY + j0+n ] += Coeff*h_Flux_Array[TID][2*f][v][ m*PS2 + n ];
+      }
+   } // for (int TID=0; TID<NPG; TID++)
+
+} // FUNCTION : Flu_LTS_StoreFlux
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_AdvanceDt_LTS
+// Description :  Advance the fluid attributes on the base level by the radially varying local time-stepping
+//
+// Note        :  1. Replace Flu_AdvanceDt() in EvolveLevel() when LTS_NBIN > 1
+//                2. One macro step "dt" is divided into NSub = 2^BinMax sub-steps, and the patch groups in the
+//                   bin b are advanced by 2^b sub-steps at a time
+//                   --> the patch groups in the middle of their step are set by linear interpolation in time
+//                       at the end of each sub-step to provide the ghost zones of the faster bins
+//                3. The slow side of each bin boundary is corrected by the fluxes of the fast side at the end
+//                   of its step in the same way as Flu_FixUp()
+//                4. Gravity, Grackle, and orbital advection are still applied once per macro step by EvolveLevel()
+//                   --> for UNSPLIT_GRAVITY, the potential at TimeOld is adopted by all sub-steps
+//                5. On return, "SaveSg" stores the data at TimeNew and the other sandglass still stores the data
+//                   at TimeOld, as for Flu_AdvanceDt()
+//
+// Parameter   :  lv      : Target refinement level (must be 0)
+//                TimeNew : Target physical time to reach
+//                TimeOld : Physical time before update
+//                dt      : Time interval of the macro step
+//                SaveSg  : Sandglass to store the updated data
+//
+// Return      : GAMER_SUCCESS / GAMER_FAILED
+//               --> Mainly used for the option "AUTO_REDUCE_DT"
+//-------------------------------------------------------------------------------------------------------
+int Flu_AdvanceDt_LTS( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg )
+{
+
+   const int  Sg0      = amr->FluSg[lv];
+   const int  NReal    = amr->NPatchComma[lv][1];
+   const int  NPG_Real = NReal / 8;
+   const long NPatchVar = (long)NCOMP_TOTAL*CUBE(PS1);
+
+
+// 1. set the number of sub-steps
+// --> other dt criteria (e.g., data dump and end time) may shorten the macro step, in which case the bins are lowered
+   int NSub = 1;
+   for (int c=0; c<LTS_NCol; c++)   NSub = MAX( NSub, 1<<LTS_Bin[c] );
+
+   while (  NSub > 1  &&  dt/(NSub/2) <= LTS_dt_Min  )   NSub /= 2;
+
+   int BinMax = 0;
+   while (  (1<<BinMax) < NSub  )  BinMax ++;
+
+   for (int c=0; c<LTS_NCol; c++)   LTS_Bin[c] = MIN( LTS_Bin[c], BinMax );
+
+   if ( NSub == 1 )
+   {
+      const int FluStatus = Flu_AdvanceDt( lv, TimeNew, TimeOld, dt, SaveSg, false, false );
+
+      if ( FluStatus == GAMER_SUCCESS )   Flu_LTS_NUpdateCell[0] += (long)NReal*CUBE(PS1);
+
+      return FluStatus;
+   }
+
+   const double dTime_Sub = ( TimeNew - TimeOld )/NSub;
+   const double dt_Sub    = dt/NSub;
+
+
+// 2. sort the real patch groups by bin
+   int  NPG_Bin [LTS_NBIN_MAX], Offset[LTS_NBIN_MAX];
+   int *PID0_Bin[LTS_NBIN_MAX];
+
+   for (int b=0; b<=BinMax; b++)    NPG_Bin[b] = 0;
+
+   for (int t=0; t<NPG_Real; t++)
+      NPG_Bin[ LTS_Bin[ amr->patch[0][lv][8*t]->corner[0] / amr->scale[lv] / PS2 ] ] ++;
+
+// --> Offset[b] is the index of the first patch group of the bin b >= 1 in the arrays Old[] and New[] below
+   for (int b=0; b<=BinMax; b++)
+      Offset[b] = ( b <= 1 ) ? 0 : Offset[b-1] + NPG_Bin[b-1];
+
+   for (int b=0; b<=BinMax; b++)
+   {
+      PID0_Bin[b] = new int [ MAX(NPG_Bin[b],1) ];
+      NPG_Bin [b] = 0;
+   }
+
+   for (int t=0; t<NPG_Real; t++)
+   {
+      const int b = LTS_Bin[ amr->patch[0][lv][8*t]->corner[0] / amr->scale[lv] / PS2 ];
+      PID0_Bin[b][ NPG_Bin[b]++ ] = 8*t;
+   }
+
+
+// 3. allocate the flux registers on the bin boundaries
+   int NReg = 0;
+   for (int ci=0; ci<LTS_NCol-1; ci++)    LTS_RegID[ci] = ( LTS_Bin[ci] != LTS_Bin[ci+1] ) ? NReg++ : -1;
+
+   delete [] LTS_Reg;
+   LTS_Reg = new double [ MAX(NReg,1)*LTS_RegSize ];
+
+   for (long t=0; t<NReg*LTS_RegSize; t++)   LTS_Reg[t] = 0.0;
+
+   double *RegBuf = new double [ MAX(NReg,1)*LTS_RegSize ];
+
+
+// 4. back up the data at TimeOld, and allocate the data at the beginning (Old) and end (New) of the current
+//    step of the bins >= 1
+   const int NPG_Slow = ( BinMax >= 1 ) ? Offset[BinMax] + NPG_Bin[BinMax] : 0;
+
+   real *Backup = new real [ NReal*NPatchVar ];
+   real *Old    = new real [ MAX(8*NPG_Slow,1)*NPatchVar ];
+   real *New    = new real [ MAX(8*NPG_Slow,1)*NPatchVar ];
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+      memcpy( Backup+PID*NPatchVar, amr->patch[Sg0][lv][PID]->fluid, NPatchVar*sizeof(real) );
+
+
+// 5. advance all bins by NSub sub-steps
+// --> the cell updates are only added to Flu_LTS_NUpdateCell[] once the macro step is accepted (see AUTO_REDUCE_DT)
+   long NUpdateCell[LTS_NBIN_MAX];
+   for (int b=0; b<=BinMax; b++)    NUpdateCell[b] = 0;
+
+   FluStatus_ThisRank = GAMER_SUCCESS;
+
+#  ifdef MODEL_MSTAR
+   d_MStar    = 0.0 ;
+   d_Star_J   = 0.0 ;
+   for (int d=0; d<3; d++ ) d_Star_Mom[d] = 0.0; //cartesian mom
+#  endif
+
+#  ifdef UNSPLIT_GRAVITY
+   const double PotSgTime0 = amr->PotSgTime[lv][ amr->PotSg[lv] ];
+#  endif
+
+   for (int s=0; s<NSub; s++)
+   {
+      const int    InSg       = amr->FluSg[lv];
+      const int    OutSg      = 1 - InSg;
+      const double TimeSub    = TimeOld + s*dTime_Sub;
+      const double TimeSubNew = ( s == NSub-1 ) ? TimeNew : TimeOld + (s+1)*dTime_Sub;
+
+//    adopt the potential at TimeOld for the half-step prediction of all sub-steps
+#     ifdef UNSPLIT_GRAVITY
+      amr->PotSgTime[lv][ amr->PotSg[lv] ] = TimeSub;
+#     endif
+
+
+//    5.1 advance the bins starting a new step at this sub-step
+      for (int b=0; b<=BinMax; b++)
+      {
+         const int Stride = 1 << b;
+
+         if ( s%Stride != 0  ||  NPG_Bin[b] == 0 )    continue;
+
+         const double TimeEnd = ( s+Stride == NSub ) ? TimeNew : TimeOld + (s+Stride)*dTime_Sub;
+
+         if ( b > 0 )
+         {
+#           pragma omp parallel for schedule( runtime )
+            for (int t=0; t<8*NPG_Bin[b]; t++)
+               memcpy( Old+(8*Offset[b]+t)*NPatchVar, amr->patch[InSg][lv][ PID0_Bin[b][t/8]+t%8 ]->fluid,
+                       NPatchVar*sizeof(real) );
+         }
+
+         Flu_LTS_NPG       = NPG_Bin [b];
+         Flu_LTS_PID0_List = PID0_Bin[b];
+
+         InvokeSolver( FLUID_SOLVER, lv, TimeEnd, TimeSub, Stride*dt_Sub, NULL_REAL, OutSg, NULL_INT, false, false );
+
+         Flu_LTS_NPG       = 0;
+         Flu_LTS_PID0_List = NULL;
+
+         if ( b > 0 )
+         {
+#           pragma omp parallel for schedule( runtime )
+            for (int t=0; t<8*NPG_Bin[b]; t++)
+               memcpy( New+(8*Offset[b]+t)*NPatchVar, amr->patch[OutSg][lv][ PID0_Bin[b][t/8]+t%8 ]->fluid,
+                       NPatchVar*sizeof(real) );
+         }
+
+         NUpdateCell[b] += (long)NPG_Bin[b]*8*CUBE(PS1);
+      } // for (int b=0; b<=BinMax; b++)
+
+
+//    5.2 set the bins >= 1 at the end of this sub-step by linear interpolation in time
+      for (int b=1; b<=BinMax; b++)
+      {
+         const int  Stride = 1 << b;
+         const int  NDone  = s%Stride + 1;   // number of sub-steps done in the current step of this bin
+         const real Weight = (real)NDone / Stride;
+
+#        pragma omp parallel for schedule( runtime )
+         for (int t=0; t<8*NPG_Bin[b]; t++)
+         {
+            const real *OldPtr = Old + (8*Offset[b]+t)*NPatchVar;
+            const real *NewPtr = New + (8*Offset[b]+t)*NPatchVar;
+            real       *OutPtr = amr->patch[OutSg][lv][ PID0_Bin[b][t/8]+t%8 ]->fluid[0][0][0];
+
+            if ( NDone == Stride )
+               memcpy( OutPtr, NewPtr, NPatchVar*sizeof(real) );
+            else
+               for (long idx=0; idx<NPatchVar; idx++)
+                  OutPtr[idx] = OldPtr[idx] + Weight*( NewPtr[idx] - OldPtr[idx] );
+         }
+      }
+
+
+//    5.3 correct the slow side of the bin boundaries finishing a step at this sub-step
+      int NFinish = 0;
+
+      for (int ci=0; ci<LTS_NCol-1; ci++)
+      {
+         if ( LTS_RegID[ci] < 0 )   continue;
+
+         const int BinSlow = MAX( LTS_Bin[ci], LTS_Bin[ci+1] );
+
+         if ( (s+1)%(1<<BinSlow) == 0 )
+            memcpy( RegBuf+(NFinish++)*LTS_RegSize, LTS_Reg+LTS_RegID[ci]*LTS_RegSize, LTS_RegSize*sizeof(double) );
+      }
+
+//    sum over all ranks since each rank only accumulates the fluxes of its own patch groups
+      if ( NFinish > 0 )
+         MPI_Allreduce( MPI_IN_PLACE, RegBuf, (int)(NFinish*LTS_RegSize), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      NFinish = 0;
+
+      for (int ci=0; ci<LTS_NCol-1; ci++)
+      {
+         if ( LTS_RegID[ci] < 0 )   continue;
+
+         const int BinSlow = MAX( LTS_Bin[ci], LTS_Bin[ci+1] );
+
+         if ( (s+1)%(1<<BinSlow) != 0 )   continue;
+
+         const int     cSlow = ( LTS_Bin[ci] > LTS_Bin[ci+1] ) ? ci : ci+1;
+         const int     Face  = ( cSlow == ci ) ? 1 : 0;
+         const double *Reg   = RegBuf + (NFinish++)*LTS_RegSize;
+
+#        pragma omp parallel for schedule( runtime )
+         for (int t=0; t<NPG_Bin[BinSlow]; t++)
+         {
+            const int PID0 = PID0_Bin[BinSlow][t];
+
+            if ( amr->patch[0][lv][PID0]->corner[0] / amr->scale[lv] / PS2 == cSlow )
+               LTS_CorrectFlux( lv, OutSg, PID0, Face, Reg );
+         }
+
+         for (long t=0; t<LTS_RegSize; t++)  LTS_Reg[ LTS_RegID[ci]*LTS_RegSize + t ] = 0.0;
+      }
+
+
+//    5.4 proceed to the next sub-step
+      amr->FluSg    [lv]        = OutSg;
+      amr->FluSgTime[lv][OutSg] = TimeSubNew;
+
+      if ( s < NSub-1 )
+         Buf_GetBufferData( lv, OutSg, NULL_INT, DATA_GENERAL, _TOTAL, Flu_ParaBuf, USELB_YES );
+   } // for (int s=0; s<NSub; s++)
+
+#  ifdef UNSPLIT_GRAVITY
+   amr->PotSgTime[lv][ amr->PotSg[lv] ] = PotSgTime0;
+#  endif
+
+
+// 6. store the data at TimeNew in SaveSg and restore the data at TimeOld in the other sandglass
+   if ( amr->FluSg[lv] != SaveSg )
+   {
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<NReal; PID++)
+         memcpy( amr->patch[SaveSg][lv][PID]->fluid, amr->patch[Sg0][lv][PID]->fluid, NPatchVar*sizeof(real) );
+   }
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<NReal; PID++)
+      memcpy( amr->patch[Sg0][lv][PID]->fluid, Backup+PID*NPatchVar, NPatchVar*sizeof(real) );
+
+   amr->FluSg    [lv]         = Sg0;
+   amr->FluSgTime[lv][Sg0   ] = TimeOld;
+   amr->FluSgTime[lv][SaveSg] = TimeNew;
+
+
+   for (int b=0; b<=BinMax; b++)    delete [] PID0_Bin[b];
+   delete [] RegBuf;
+   delete [] Backup;
+   delete [] Old;
+   delete [] New;
+
+
+// 7. collect the fluid solver status from all ranks (only necessary for AUTO_REDUCE_DT)
+   int FluStatus_AllRank;
+
+   if ( AUTO_REDUCE_DT )   { MPI_Allreduce( &FluStatus_ThisRank, &FluStatus_AllRank, 1, MPI_INT, MPI_BAND, MPI_COMM_WORLD ); }
+   else                    FluStatus_AllRank = GAMER_SUCCESS;
+
+   if ( FluStatus_AllRank == GAMER_SUCCESS )
+   {
+      for (int b=0; b<=BinMax; b++)    Flu_LTS_NUpdateCell[b] += NUpdateCell[b];
+
+      if ( OPT__FIXUP_FLUX )  Buf_ResetBufferFlux( lv );
+
+#     ifdef GRAVITY
+      if ( false )
+#     endif
+#     ifdef SUPPORT_GRACKLE
+      if ( !GRACKLE_ACTIVATE )
+#     endif
+      if ( OPT__RESET_FLUID  &&  Flu_ResetByUser_API_Ptr != NULL )   Flu_ResetByUser_API_Ptr( lv, SaveSg, TimeNew );
+   }
+
+   return FluStatus_AllRank;
+
+} // FUNCTION : Flu_AdvanceDt_LTS
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LTS_CorrectFlux
+// Description :  Correct the cells of a patch group adjacent to a bin boundary by the difference between
+//                the fluxes of the slow and fast sides
+//
+// Note        :  1. Same as Flu_FixUp() except for the cylindrical factors 1/r and 1/r^2 (for MOMY) and dh/dr
+//                   (for OPT__CYL_RGRID)
+//                   --> cells with unphysical results after the correction are skipped
+//
+// Parameter   :  lv    : Target refinement level
+//                FluSg : Sandglass of the data to be corrected
+//                PID0  : Patch index with LocalID==0 of the target patch group
+//                Face  : 0/1 --> the bin boundary is the left/right face of the patch group
+//                Reg   : Flux register of the bin boundary summed over all ranks
+//-------------------------------------------------------------------------------------------------------
+void LTS_CorrectFlux( const int lv, const int FluSg, const int PID0, const int Face, const double *Reg )
+{
+
+   const real      Const     = ( Face == 0 ) ? real(-1.0/amr->dh[lv][0]) : real(+1.0/amr->dh[lv][0]);
+   const int       NY        = NX0_TOT[1];
+   const int       NZ        = NX0_TOT[2];
+   const int       i         = ( Face == 0 ) ? 0 : PS1-1;
+   const CylGeo_t &Geo       = CylGeo[lv];
+   const real      Gamma_m1  = GAMMA - (real)1.0;
+   const real     _Gamma_m1  = (real)1.0 / Gamma_m1;
+   const bool CheckMinPres_No = false;
+
+   real CorrVal[NFLUX_TOTAL];
+
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      if ( TABLE_02( LocalID, 'x', 0, 1 ) != Face )   continue;
+
+      const int PID = PID0 + LocalID;
+      const int ig  = amr->patch[0][lv][PID]->corner[0] / amr->scale[lv] + i + Geo.NGhost;
+      const int j0  = amr->patch[0][lv][PID]->corner[1] / amr->scale[lv];
+      const int k0  = amr->patch[0][lv][PID]->corner[2] / amr->scale[lv];
+      real (*Fluid)[PS1][PS1][PS1] = amr->patch[FluSg][lv][PID]->fluid;
+
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      {
+//       calculate the corrected results
+//       --> do NOT **store** these results yet since we want to skip the cells with unphysical results
+         for (int v=0; v<NFLUX_TOTAL; v++)
+         {
+            const real Factor = ( ( v == MOMY ) ? Geo._r2[ig] : Geo._r[ig] )*Geo.dh_dr[ig];
+
+            CorrVal[v] = Fluid[v][k][j][i] + Const*Factor*(real)Reg[ ( (long)v*NZ + k0+k )*NY + j0+j ];
+         }
+
+
+//       calculate the pressure
+         real Pres;
+
+#        if   ( DUAL_ENERGY == DE_ENPY )
+         const char DE_Status = amr->patch[0][lv][PID]->de_status[k][j][i];
+
+         Pres = ( DE_Status == DE_UPDATED_BY_ETOT  ||  DE_Status == DE_UPDATED_BY_ETOT_GRA ) ?
+                CPU_GetPressure( CorrVal[DENS], CorrVal[MOMX], CorrVal[MOMY], CorrVal[MOMZ], CorrVal[ENGY],
+                                 Gamma_m1, CheckMinPres_No, NULL_REAL )
+              : CPU_DensEntropy2Pres( CorrVal[DENS], CorrVal[ENPY], Gamma_m1, CheckMinPres_No, NULL_REAL );
+
+#        elif ( DUAL_ENERGY == DE_EINT )
+#        error : DE_EINT is NOT supported yet !!
+
+#        else
+         Pres = CPU_GetPressure( CorrVal[DENS], CorrVal[MOMX], CorrVal[MOMY], CorrVal[MOMZ], CorrVal[ENGY],
+                                 Gamma_m1, CheckMinPres_No, NULL_REAL );
+#        endif // DUAL_ENERGY
+
+
+//       do not apply the flux correction if there are any unphysical results
+         if ( CorrVal[DENS] <= MIN_DENS  ||  Pres <= MIN_PRES  ||  !Aux_IsFinite(Pres)
+#             if ( DUAL_ENERGY == DE_ENPY )
+              ||  ( (DE_Status == DE_UPDATED_BY_DUAL || DE_Status == DE_UPDATED_BY_MIN_PRES)
+                     && CorrVal[ENPY] <= (real)2.0*TINY_NUMBER )
+#             endif
+            )
+            continue;
+
+
+//       floor and normalize the passive scalars
+#        if ( NCOMP_PASSIVE > 0 )
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  CorrVal[v] = FMAX( CorrVal[v], TINY_NUMBER );
+
+         if ( OPT__NORMALIZE_PASSIVE )
+            CPU_NormalizePassive( CorrVal[DENS], CorrVal+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
+#        endif
+
+
+//       ensure the consistency between pressure, total energy density, and dual-energy variable
+         CorrVal[ENGY] = (real)0.5*( SQR(CorrVal[MOMX]) + SQR(CorrVal[MOMY]) + SQR(CorrVal[MOMZ]) ) / CorrVal[DENS]
+                         + Pres*_Gamma_m1;
+
+#        if ( DUAL_ENERGY == DE_ENPY )
+         CorrVal[ENPY] = CPU_DensPres2Entropy( CorrVal[DENS], Pres, Gamma_m1 );
+#        endif
+
+
+//       store the corrected results
+         for (int v=0; v<NFLUX_TOTAL; v++)   Fluid[v][k][j][i] = CorrVal[v];
+      } // k,j
+   } // for (int LocalID=0; LocalID<8; LocalID++)
+
+} // FUNCTION : LTS_CorrectFlux
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
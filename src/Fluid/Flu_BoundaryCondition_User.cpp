@@ -15,22 +15,30 @@ void (*BC_User_Ptr)( real fluid[], const double X, const double Y, const double
 // boundary condition using gradient field
 static void BC_User_xm( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, 
                         const int ArraySizeY, const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar );
+                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                        const int lv );
 static void BC_User_xp( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, 
                         const int ArraySizeY, const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar );
+                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                        const int lv );
 static void BC_User_ym( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, 
                         const int ArraySizeY, const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar );
+                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                        const int lv );
 static void BC_User_yp( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, 
                         const int ArraySizeY, const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar );
+                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                        const int lv );
 static void BC_User_zm( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, 
                         const int ArraySizeY, const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar );
+                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                        const int lv );
 static void BC_User_zp( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, 
                         const int ArraySizeY, const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar );
+                        const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                        const int lv );
+
+static double BC_User_Radius( const double *Corner, const double dh[], const int i, const int lv );
 
 static const double rho_ratio_limit = 0.6;
 
@@ -121,17 +129,17 @@ void Flu_BoundaryCondition_User( real *Array, real *PotArray, const int BC_Face,
    switch ( BC_Face )
    {
       case 0:  BC_User_xm( Array, PotArray, NVar_Flu, GhostSize, ArraySizeX, ArraySizeY, ArraySizeZ, Idx_Start, Idx_End, 
-                           TFluVarIdxList, dh, Corner, TVar );  break;
+                           TFluVarIdxList, dh, Corner, TVar, lv );  break;
       case 1:  BC_User_xp( Array, PotArray, NVar_Flu, GhostSize, ArraySizeX, ArraySizeY, ArraySizeZ, Idx_Start, Idx_End, 
-                           TFluVarIdxList, dh, Corner, TVar );  break;
+                           TFluVarIdxList, dh, Corner, TVar, lv );  break;
       case 2:  BC_User_ym( Array, PotArray, NVar_Flu, GhostSize, ArraySizeX, ArraySizeY, ArraySizeZ, Idx_Start, Idx_End, 
-                           TFluVarIdxList, dh, Corner, TVar );  break;
+                           TFluVarIdxList, dh, Corner, TVar, lv );  break;
       case 3:  BC_User_yp( Array, PotArray, NVar_Flu, GhostSize, ArraySizeX, ArraySizeY, ArraySizeZ, Idx_Start, Idx_End, 
-                           TFluVarIdxList, dh, Corner, TVar );  break;
+                           TFluVarIdxList, dh, Corner, TVar, lv );  break;
       case 4:  BC_User_zm( Array, PotArray, NVar_Flu, GhostSize, ArraySizeX, ArraySizeY, ArraySizeZ, Idx_Start, Idx_End, 
-                           TFluVarIdxList, dh, Corner, TVar );  break;
+                           TFluVarIdxList, dh, Corner, TVar, lv );  break;
       case 5:  BC_User_zp( Array, PotArray, NVar_Flu, GhostSize, ArraySizeX, ArraySizeY, ArraySizeZ, Idx_Start, Idx_End, 
-                           TFluVarIdxList, dh, Corner, TVar );  break;
+                           TFluVarIdxList, dh, Corner, TVar, lv );  break;
       default: Aux_Error( ERROR_INFO, "incorrect boundary face (%d) !!\n", BC_Face );
    }
    
@@ -143,7 +151,6 @@ void Flu_BoundaryCondition_User( real *Array, real *PotArray, const int BC_Face,
    if ( BC_User_Ptr == NULL )    Aux_Error( ERROR_INFO, "BC_User_Ptr == NULL !!\n" );  
 
 // starting coordinates in the adopted coordinate system
-   const double X0 = Corner[0] + (double)Idx_Start[0]*dh[0];
    const double Y0 = Corner[1] + (double)Idx_Start[1]*dh[1];
    const double Z0 = Corner[2] + (double)Idx_Start[2]*dh[2];
 
@@ -178,8 +185,9 @@ void Flu_BoundaryCondition_User( real *Array, real *PotArray, const int BC_Face,
 
    for (k=Idx_Start[2], Z=Z0; k<=Idx_End[2]; k++, Z+=dh[2])
    for (j=Idx_Start[1], Y=Y0; j<=Idx_End[1]; j++, Y+=dh[1])
-   for (i=Idx_Start[0], X=X0; i<=Idx_End[0]; i++, X+=dh[0])
+   for (i=Idx_Start[0]; i<=Idx_End[0]; i++)
    {
+      X = BC_User_Radius( Corner, dh, i, lv );
       BC_User_Ptr( BVal, X, Y, Z, Time, lv, NULL );
 
       for (int v=0; v<NVar_Flu; v++)   Array3D[v][k][j][i] = BVal[ TFluVarIdxList[v] ];
@@ -216,6 +224,41 @@ void Flu_BoundaryCondition_User( real *Array, real *PotArray, const int BC_Face,
 
 
 #if (COORDINATE == CYLINDRICAL)
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BC_User_Radius
+// Description :  Return the radius of the cell with the array index i along x
+//
+// Note        :  1. Uniform radial grids step in dh[0] from Corner[0]
+//                2. Mapped radial grids (OPT__CYL_RGRID != CYL_RGRID_UNIFORM) take the radius from CylGeo[lv].r[],
+//                   which stores NGhost ghost cells on each side of the domain
+//                3. Corner[0] is the logical (uniform) coordinate of the cell 0 and is only used to get its
+//                   global index
+//
+// Parameter   :  Corner   : Physcial coordinates at the center of the cell (0,0,0) --> Array[0]
+//                dh       : Grid size
+//                i        : Array index along x
+//                lv       : Refinement level
+//
+// Return      :  Cell-centre radius
+//-------------------------------------------------------------------------------------------------------
+double BC_User_Radius( const double *Corner, const double dh[], const int i, const int lv )
+{
+
+   if ( OPT__CYL_RGRID == CYL_RGRID_UNIFORM )   return Corner[0] + (double)i*dh[0];
+
+   const CylGeo_t *Geo = &CylGeo[lv];
+   const int       t   = (int)floor( ( Corner[0] - amr->BoxEdgeL[0] )/amr->dh[lv][0] ) + i + Geo->NGhost;
+
+   if ( t < 0  ||  t >= Geo->N )
+      Aux_Error( ERROR_INFO, "radial table index %d lies outside the range [0, %d) (lv %d) --> increase NGhost of CylGeo !!\n",
+                 t, Geo->N, lv );
+
+   return Geo->r[t];
+
+} // FUNCTION : BC_User_Radius
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  BC_User_xm
 // Description :  User-specified boundary condition
@@ -231,7 +274,8 @@ void Flu_BoundaryCondition_User( real *Array, real *PotArray, const int BC_Face,
 //-------------------------------------------------------------------------------------------------------
 void BC_User_xm( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, const int ArraySizeY,
                  const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar ) 
+                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                 const int lv )
 {
 #  ifdef UserPotBC
 // 1D array -> 3D array
@@ -244,11 +288,10 @@ void BC_User_xm( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    }
    real (*PotArray3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )PotArray;
    
-   const double X0    = Corner[0] + (double)Idx_End[0]*dh[0];
    const double Y0    = Corner[1] + (double)Idx_Start[1]*dh[1];
    const double Z0    = Corner[2] + (double)Idx_Start[2]*dh[2];
    const double GM    = ExtAcc_AuxArray[3] ;
-   const double X_ref = X0 + dh[0];
+   const double X_ref = BC_User_Radius( Corner, dh, Idx_End[0]+1, lv );
    const double Y_ref = Y0;
    const double Z_ref = Z0;
    const int    i_ref = Idx_End[0]+1 ;
@@ -269,8 +312,9 @@ void BC_User_xm( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
                                    Array3D[ENGY][k][j][i_ref], Gamma_m1, CheckMinPres_Yes, MIN_PRES );
       _rho_ref  = 1.0/Array3D[DENS][k][j][i_ref];
                                    
-      for (i=Idx_End[0], X=X0; i>=Idx_Start[0]; i--, X-=dh[0])
+      for (i=Idx_End[0]; i>=Idx_Start[0]; i--)
       {
+         X = BC_User_Radius( Corner, dh, i, lv );
          // outflow 
          Array3D[DENS][k][j][i] = Array3D[DENS][k][j][i_ref] ;
          Array3D[MOMX][k][j][i] = Array3D[MOMX][k][j][i_ref] ;
@@ -318,7 +362,8 @@ void BC_User_xm( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
 //-------------------------------------------------------------------------------------------------------                        
 void BC_User_xp( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, const int ArraySizeY,
                  const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar )
+                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                 const int lv )
 {
 #  ifdef UserPotBC
 // 1D array -> 3D array
@@ -331,11 +376,10 @@ void BC_User_xp( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    }
    real (*PotArray3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )PotArray;
    
-   const double X0    = Corner[0] + (double)Idx_Start[0]*dh[0];
    const double Y0    = Corner[1] + (double)Idx_Start[1]*dh[1];
    const double Z0    = Corner[2] + (double)Idx_Start[2]*dh[2];
    const double GM    = ExtAcc_AuxArray[3] ;
-   const double X_ref = X0 - dh[0];
+   const double X_ref = BC_User_Radius( Corner, dh, Idx_Start[0]-1, lv );
    const double Y_ref = Y0;
    const double Z_ref = Z0;
    
@@ -349,8 +393,9 @@ void BC_User_xp( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    
    for (k=Idx_Start[2], Z=Z0; k<=Idx_End[2]; k++, Z+=dh[2])
    for (j=Idx_Start[1], Y=Y0; j<=Idx_End[1]; j++, Y+=dh[1])
-   for (i=Idx_Start[0], X=X0; i<=Idx_End[0]; i++, X+=dh[0])
+   for (i=Idx_Start[0]; i<=Idx_End[0]; i++)
    {
+      X = BC_User_Radius( Corner, dh, i, lv );
       // outflow 
       Array3D[DENS][k][j][i] = Array3D[DENS][k][j][i_ref] ;
       Array3D[MOMX][k][j][i] = Array3D[MOMX][k][j][i_ref] ;
@@ -377,14 +422,14 @@ void BC_User_xp( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
 //-------------------------------------------------------------------------------------------------------              
 void BC_User_ym( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, const int ArraySizeY,
                  const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar )
+                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                 const int lv )
 {
 #  ifdef UserPotBC
 // 1D array -> 3D array
    const int FACE = 2;
    real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
    
-   const double X0 = Corner[0] + (double)Idx_Start[0]*dh[0];
    const double Y0 = Corner[1] + (double)Idx_End[1]*dh[1]  ;
    const double Z0 = Corner[2] + (double)Idx_Start[2]*dh[2];
    
@@ -395,8 +440,9 @@ void BC_User_ym( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    
    for (k=Idx_Start[2], Z=Z0; k<=Idx_End[2];   k++, Z+=dh[2])
    for (j=Idx_End[1],   Y=Y0; j>=Idx_Start[1]; j--, Y-=dh[1])
-   for (i=Idx_Start[0], X=X0; i<=Idx_End[0];   i++, X+=dh[0])
+   for (i=Idx_Start[0]; i<=Idx_End[0];   i++)
    {
+      X = BC_User_Radius( Corner, dh, i, lv );
       // outflow 
       Array3D[DENS][k][j][i] = Array3D[DENS][k][j_ref][i] ;
       Array3D[MOMX][k][j][i] = Array3D[MOMX][k][j_ref][i] ;
@@ -422,14 +468,14 @@ void BC_User_ym( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
 //-------------------------------------------------------------------------------------------------------        
 void BC_User_yp( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, const int ArraySizeY,
                  const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar )
+                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                 const int lv )
 {
 #  ifdef UserPotBC
 // 1D array -> 3D array
    const int FACE = 3;
    real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
    
-   const double X0 = Corner[0] + (double)Idx_Start[0]*dh[0];
    const double Y0 = Corner[1] + (double)Idx_Start[1]*dh[1];
    const double Z0 = Corner[2] + (double)Idx_Start[2]*dh[2];
    
@@ -440,8 +486,9 @@ void BC_User_yp( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    
    for (k=Idx_Start[2], Z=Z0; k<=Idx_End[2]; k++, Z+=dh[2])
    for (j=Idx_Start[1], Y=Y0; j<=Idx_End[1]; j++, Y+=dh[1])
-   for (i=Idx_Start[0], X=X0; i<=Idx_End[0]; i++, X+=dh[0])
+   for (i=Idx_Start[0]; i<=Idx_End[0]; i++)
    {
+      X = BC_User_Radius( Corner, dh, i, lv );
       // outflow 
       Array3D[DENS][k][j][i] = Array3D[DENS][k][j_ref][i] ;
       Array3D[MOMX][k][j][i] = Array3D[MOMX][k][j_ref][i] ;
@@ -467,18 +514,18 @@ void BC_User_yp( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
 //-------------------------------------------------------------------------------------------------------              
 void BC_User_zm( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, const int ArraySizeY,
                  const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar )
+                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                 const int lv )
 {
 #  ifdef UserPotBC
 // 1D array -> 3D array
    const int FACE = 4;
    real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
    
-   const double X0    = Corner[0] + (double)Idx_Start[0]*dh[0];
    const double Y0    = Corner[1] + (double)Idx_Start[1]*dh[1];
    const double Z0    = Corner[2] + (double)Idx_End[2]*dh[2];
    const double GM    = ExtAcc_AuxArray[3] ;
-   const double X_ref = X0;
+   const double X_ref = BC_User_Radius( Corner, dh, Idx_Start[0], lv );
    const double Y_ref = Y0;
    const double Z_ref = Z0 + dh[2];
    const int    k_ref = Idx_End[2]+1 ;
@@ -500,8 +547,9 @@ void BC_User_zm( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    real (*PotArray3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )PotArray;
    
    for (j=Idx_Start[1], Y=Y0; j<=Idx_End[1]; j++, Y+=dh[1])
-   for (i=Idx_Start[0], X=X0; i<=Idx_End[0]; i++, X+=dh[0])
-   {  
+   for (i=Idx_Start[0]; i<=Idx_End[0]; i++)
+   {
+      X = BC_User_Radius( Corner, dh, i, lv );
       rho_ref   = Array3D[DENS][k_ref][j][i] ;
       _rho_ref  = 1 / rho_ref;
       Vx_ref    = Array3D[MOMX][k_ref][j][i] * _rho_ref;
@@ -585,7 +633,8 @@ void BC_User_zm( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
 //-------------------------------------------------------------------------------------------------------              
 void BC_User_zp( real *Array, real *PotArray, const int NVar_Flu, const int GhostSize, const int ArraySizeX, const int ArraySizeY,
                  const int ArraySizeZ, const int Idx_Start[], const int Idx_End[],
-                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar )
+                 const int TFluVarIdxList[], const double dh[], const double *Corner, const int TVar,
+                 const int lv )
 {
 #  ifdef UserPotBC
 // 1D array -> 3D array
@@ -593,11 +642,10 @@ void BC_User_zp( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    real (*Array3D)[ArraySizeZ][ArraySizeY][ArraySizeX]    = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )Array;
 
    
-   const double X0    = Corner[0] + (double)Idx_Start[0]*dh[0];
    const double Y0    = Corner[1] + (double)Idx_Start[1]*dh[1];
    const double Z0    = Corner[2] + (double)Idx_Start[2]*dh[2];
    const double GM    = ExtAcc_AuxArray[3] ;
-   const double X_ref = X0;
+   const double X_ref = BC_User_Radius( Corner, dh, Idx_Start[0], lv );
    const double Y_ref = Y0;
    const double Z_ref = Z0 - dh[2];
    const int    k_ref = Idx_Start[2]-1 ;
@@ -618,8 +666,9 @@ void BC_User_zp( real *Array, real *PotArray, const int NVar_Flu, const int Ghos
    real (*PotArray3D)[ArraySizeZ][ArraySizeY][ArraySizeX] = ( real (*)[ArraySizeZ][ArraySizeY][ArraySizeX] )PotArray;
    
    for (j=Idx_Start[1], Y=Y0; j<=Idx_End[1]; j++, Y+=dh[1])
-   for (i=Idx_Start[0], X=X0; i<=Idx_End[0]; i++, X+=dh[0])
-   {  
+   for (i=Idx_Start[0]; i<=Idx_End[0]; i++)
+   {
+      X = BC_User_Radius( Corner, dh, i, lv );
       rho_ref   = Array3D[DENS][k_ref][j][i] ;
       _rho_ref  = 1 / rho_ref;
       Vx_ref    = Array3D[MOMX][k_ref][j][i] * _rho_ref;
@@ -37,6 +37,7 @@ extern void CPU_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L
 //                2. Correct the fluxes across the coarse-fine boundaries at level "lv-1"
 //                3. Copy the data from the "h_Flu_Array_F_Out" and "h_DE_Array_F_Out" arrays to the "amr->patch" pointers
 //                4. Get the minimum time-step information of the fluid solver
+//                5. Accumulate the fluxes across the time-step bin boundaries for LTS_NBIN > 1
 //
 // Parameter   :  lv                : Target refinement level
 //                SaveSg            : Sandglass to store the updated data
@@ -69,6 +70,12 @@ void Flu_Close( const int lv, const int SaveSg, real h_Flux_Array[][9][NFLUX_TOT
    if ( OPT__FIXUP_FLUX  &&  lv != 0 )    CorrectFlux( lv, h_Flux_Array, NPG, PID0_List, dt );
 
 
+// accumulate the fluxes across the time-step bin boundaries of the local time-stepping
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   if ( LTS_NBIN > 1  &&  lv == 0 )    Flu_LTS_StoreFlux( lv, h_Flux_Array, NPG, PID0_List, dt );
+#  endif
+
+
 // copy the updated data from the arrays "h_Flu_Array_F_Out" and "h_DE_Array_F_Out" to each patch pointer
 #  if ( FLU_NOUT != NCOMP_TOTAL )
 #     error : ERROR : FLU_NOUT != NCOMP_TOTAL (one must specify how to copy data from h_Flu_Array_F_Out to fluid) !!
@@ -172,6 +172,10 @@ void Flu_ResetByUser_API( const int lv, const int FluSg, const double TTime )
       for (int j=0; j<PS1; j++)  {  Y = Y0 + j*dh[1];
       for (int i=0; i<PS1; i++)  {  X = X0 + i*dh[0];
 
+#        if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+         if ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM )   X = Aux_Coord_CellIdx2AdoptedCoord( lv, PID, 0, i );
+#        endif
+
          for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = amr->patch[FluSg][lv][PID]->fluid[v][k][j][i];
 
 //       reset this cell
@@ -78,6 +78,12 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       Timer_dt[lv]->Start();
 #     endif
 
+//    set the mean azimuthal velocity of orbital advection before estimating the time-step
+#     if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+      if ( OPT__ORBITAL_ADV != ORB_ADV_NONE  &&  lv == 0 )
+         Hydro_OrbAdv_SetVphi( lv, amr->FluSg[lv], Time[lv] );
+#     endif
+
       switch ( OPT__DT_LEVEL )
       {
          case ( DT_LEVEL_SHARED ):
@@ -189,6 +195,12 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       {
          int FluStatus_AllRank;
 
+#        if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+         if ( LTS_NBIN > 1  &&  lv == 0 ) {
+         TIMING_FUNC(   FluStatus_AllRank = Flu_AdvanceDt_LTS( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu ),
+                        Timer_Flu_Advance[lv]   ); }
+         else
+#        endif
          TIMING_FUNC(   FluStatus_AllRank = Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, false, false ),
                         Timer_Flu_Advance[lv]   );
 
@@ -238,6 +250,13 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       amr->FluSg    [lv]             = SaveSg_Flu;
       amr->FluSgTime[lv][SaveSg_Flu] = TimeNew;
 
+//    transport the fluid along phi by the mean azimuthal velocity excluded from the fluid solver
+#     if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+      if ( OPT__ORBITAL_ADV != ORB_ADV_NONE  &&  lv == 0 )
+         TIMING_FUNC(   Hydro_OrbAdv_Shift( lv, SaveSg_Flu, dt_SubStep ),
+                        Timer_Flu_Advance[lv]   );
+#     endif
+
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 // ===============================================================================================
 
@@ -420,7 +439,25 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 // ===============================================================================================
 
 // *********************************
-//    6-1. Grackle cooling/heating
+//    6-1. built-in cooling
+// *********************************
+#     ifdef COOLING
+      if ( OPT__COOL_SUBCYCLE )
+      {
+         if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+            Aux_Message( stdout, "   Lv %2d: Hydro_Cooling_AdvanceDt, counter = %4ld ... ", lv, AdvanceCounter[lv] );
+
+//       Hydro_Cooling_AdvanceDt() requires no ghost zones
+         TIMING_FUNC(   Hydro_Cooling_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu ),
+                        Timer_Che_Advance[lv]   );
+
+         if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+      } // if ( OPT__COOL_SUBCYCLE )
+#     endif // #ifdef COOLING
+
+
+// *********************************
+//    6-2. Grackle cooling/heating
 // *********************************
 #     ifdef SUPPORT_GRACKLE
       if ( GRACKLE_ACTIVATE )
@@ -459,7 +496,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
 
 // *********************************
-//    6-2. star formation
+//    6-3. star formation
 // *********************************
 #     ifdef STAR_FORMATION
       if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )
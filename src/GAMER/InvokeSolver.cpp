@@ -1,7 +1,7 @@
 #include "GAMER.h"
 
 static void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                              const int *PID0_List, const int ArrayID );
+                              const int *PID0_List, const int ArrayID, const double dt );
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
                     const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Pot, const int NPG,
@@ -10,6 +10,10 @@ static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Clo         [NLEVEL][NSOLVER];
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+extern int      Flu_LTS_NPG;
+extern int     *Flu_LTS_PID0_List;
+#endif
 #ifdef GRAVITY
 extern Timer_t *Timer_Poi_PreRho  [NLEVEL];
 extern Timer_t *Timer_Poi_PreFlu  [NLEVEL];
@@ -163,6 +167,15 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
    } // if ( OverlapMPI )
 
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+// advance only the patch groups in the current time-step bin of the local time-stepping (see Flu_AdvanceDt_LTS())
+   else if ( TSolver == FLUID_SOLVER  &&  Flu_LTS_PID0_List != NULL )
+   {
+      NTotal    = Flu_LTS_NPG;
+      PID0_List = Flu_LTS_PID0_List;
+   }
+#  endif
+
    else
    {
       AllocateList = true;
@@ -176,7 +189,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID ),
+   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID, dt ),
                   Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -195,7 +208,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID ),
+      TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID, dt ),
                      Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -266,9 +279,10 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 //                NPG       : Number of patch groups to be prepared at a time
 //                PID0_List : List recording the patch indicies with LocalID==0 to be udpated
 //                ArrayID   : Array index to load and store data ( 0 or 1 )
+//                dt        : Time interval to advance solution (for GRACKLE_LAZY in Grackle_Prepare())
 //-------------------------------------------------------------------------------------------------------
 void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                       const int *PID0_List, const int ArrayID )
+                       const int *PID0_List, const int ArrayID, const double dt )
 {
 
 #  ifndef UNSPLIT_GRAVITY
@@ -347,7 +361,8 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 
 #     ifdef SUPPORT_GRACKLE
       case GRACKLE_SOLVER :
-         Grackle_Prepare( lv, h_Che_Array[ArrayID], NPG, PID0_List );
+         Grackle_Prepare( lv, dt, h_Che_Array[ArrayID], h_Che_Active[ArrayID], h_Che_PGOffset[ArrayID], h_Che_NCell[ArrayID],
+                          NPG, PID0_List );
       break;
 #     endif
 
@@ -481,6 +496,13 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
    const real JeansMinPres_Coeff = NULL_REAL;
 #  endif
 
+// the local time-stepping also requires the fluxes on the patch-group boundaries (see Flu_LTS_StoreFlux())
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   const bool StoreFlux = ( OPT__FIXUP_FLUX  ||  ( LTS_NBIN > 1 && lv == 0 ) );
+#  else
+   const bool StoreFlux = OPT__FIXUP_FLUX;
+#  endif
+
 
    switch ( TSolver )
    {
@@ -489,14 +511,14 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 #        ifdef GPU
          CUAPI_Asyn_FluidSolver( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
                                  h_Flux_Array[ArrayID], h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
-                                 NPG, dt, dh_real, GAMMA, OPT__FIXUP_FLUX, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF, EP_COEFF,
+                                 NPG, dt, dh_real, GAMMA, StoreFlux, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF, EP_COEFF,
                                  OPT__WAF_LIMITER, ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
                                  TimeOld, OPT__GRAVITY_TYPE, GPU_NSTREAM, MIN_DENS, MIN_PRES, DUAL_ENERGY_SWITCH,
                                  OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, JEANS_MIN_PRES, JeansMinPres_Coeff );
 #        else
          CPU_FluidSolver       ( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
                                  h_Flux_Array[ArrayID], h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
-                                 NPG, dt, dh_real, GAMMA, OPT__FIXUP_FLUX, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF, EP_COEFF,
+                                 NPG, dt, dh_real, GAMMA, StoreFlux, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF, EP_COEFF,
                                  OPT__WAF_LIMITER, ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
                                  TimeOld, OPT__GRAVITY_TYPE, MIN_DENS, MIN_PRES, DUAL_ENERGY_SWITCH,
                                  OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff );
@@ -580,7 +602,7 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 
 #     ifdef SUPPORT_GRACKLE
       case GRACKLE_SOLVER :
-         CPU_GrackleSolver( Che_FieldData, Che_Units, NPG, dt );
+         CPU_GrackleSolver( ( GRACKLE_ZERO_COPY ) ? Che_FieldData_Patch : Che_FieldData, Che_Units, h_Che_NCell[ArrayID], dt );
 
       break;
 #     endif // #ifdef SUPPORT_GRACKLE
@@ -656,7 +678,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                NPG        : Number of patch groups to be evaluated at a time
 //                PID0_List  : List recording the patch indicies with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
-//                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
+//                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close() and GRACKLE_LAZY
+//                             in Grackle_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Pot, const int NPG,
                    const int *PID0_List, const int ArrayID, const double dt )
@@ -695,17 +718,18 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 
 #     ifdef SUPPORT_GRACKLE
       case GRACKLE_SOLVER :
-         Grackle_Close( lv, SaveSg_Flu, h_Che_Array[ArrayID], NPG, PID0_List );
+         Grackle_Close( lv, SaveSg_Flu, dt, h_Che_Array[ArrayID], h_Che_Active[ArrayID], h_Che_PGOffset[ArrayID],
+                        NPG, PID0_List );
       break;
 #     endif
 
       case DT_FLU_SOLVER:
-         dt_Close( h_dt_Array_T[ArrayID], NPG );
+         dt_Close( TSolver, lv, h_dt_Array_T[ArrayID], NPG, PID0_List );
       break;
 
 #     ifdef GRAVITY
       case DT_GRA_SOLVER:
-         dt_Close( h_dt_Array_T[ArrayID], NPG );
+         dt_Close( TSolver, lv, h_dt_Array_T[ArrayID], NPG, PID0_List );
       break;
 #     endif
 
@@ -57,6 +57,7 @@ bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMO
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
 bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
+bool                 OPT__RECORD_FLU_BANDWIDTH;
 bool                 OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
 bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
 bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
@@ -87,9 +88,22 @@ bool                 OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLAG_L
 bool                 OPT__FLAG_VORTICITY, OPT__FLAG_JEANS, JEANS_MIN_PRES;
 int                  OPT__CK_NEGATIVE, JEANS_MIN_PRES_LEVEL, JEANS_MIN_PRES_NCELL;
 double               MIN_DENS, MIN_PRES;
+int                  FLU_TILE_CACHE_KB;
 #ifdef DUAL_ENERGY
 double               DUAL_ENERGY_SWITCH;
 #endif
+#ifdef COOLING
+bool                 OPT__CK_COOL_TABLE, OPT__COOL_SUBCYCLE;
+double               COOL_SUBCYCLE_TOL, COOL_LB_WEIGHT;
+int                  COOL_SUBCYCLE_NMAX;
+#endif
+#if ( COORDINATE == CYLINDRICAL )
+CylGeo_t             CylGeo[NLEVEL];
+OptOrbitalAdv_t      OPT__ORBITAL_ADV;
+real                *OrbAdv_Vphi = NULL;
+int                  LTS_NBIN;
+OptCylRGrid_t        OPT__CYL_RGRID;
+#endif
 
 #elif ( MODEL == MHD )
 #warning : WAIT MHD !!!
@@ -122,18 +136,32 @@ int                  Pot_ParaBuf, Rho_ParaBuf;
 real                *GreenFuncK       = NULL;
 #elif (COORDINATE == CYLINDRICAL)
 int                  RANK_I_TOT, RANK_IP_TOT;
+int                  CYL_RANK_TUNE_NTRIAL;
 int                  RANK_I, RANK_IP, global_nx_unit, global_nxp_unit, global_nx, global_nxp;
 real               **KernelFuncK      = NULL;
+int                 *KernelPairIdx    = NULL;
+int                  kernel_npair;
+long                 kernel_size;
+int                  kernel_nm, CYL_POISSON_MMAX;
+double               CYL_HMATRIX_TOL;
+bool                 CYL_KERNEL_CACHE;
+#ifdef SUPPORT_FFTW3
+bool                 CYL_FFTW3_WISDOM, CYL_FFTW3_SINGLE;
+#endif
+int                  KernelHMat_NBlock = 0;
+int                (*KernelHMat_Block)[4] = NULL;
+int                 *KernelHMat_Rank   = NULL;
+long                *KernelHMat_Offset = NULL;
+real                *KernelHMat_Data   = NULL;
 real               **RhoK             = NULL;
 real               **PhiK             = NULL;
 real                *SendBuf_Rho      = NULL;
 real                *RecvBuf_Rho      = NULL;
 real                *SendBuf_Phi      = NULL;
 real                *RecvBuf_Phi      = NULL;
-real                *PhiK_All_re      = NULL;
-real                *PhiK_All_im      = NULL;
-real                *PhiK_local_re    = NULL;
-real                *PhiK_local_im    = NULL;
+real                *PhiK_All         = NULL;
+real                *PhiK_Recv        = NULL;
+int                 *PhiK_OwnStart    = NULL;
 int                 *SendBuf_IDPlanXp = NULL;
 int                 *RecvBuf_IDPlanXp = NULL;
 int                 *SendBuf_I        = NULL;
@@ -211,6 +239,9 @@ char                 GRACKLE_CLOUDY_TABLE[MAX_STRING];
 int                  GRACKLE_THREE_BODY_RATE;
 int                  GRACKLE_CIE_COOLING;
 int                  GRACKLE_H2_OPA_APPROX;
+bool                 GRACKLE_LAZY;
+double               GRACKLE_LAZY_TOL;
+bool                 GRACKLE_ZERO_COPY;
 int                  CHE_GPU_NPGROUP;
 real                 dt_Grackle_global, dt_Grackle_local = HUGE_NUMBER;
 
@@ -268,7 +299,12 @@ real (*h_Flu_Array_USG_G[2])[GRA_NIN-1][PS1][PS1][PS1]                       = {
 // (3-4) Grackle chemistry
 #ifdef SUPPORT_GRACKLE
 real (*h_Che_Array[2])                                                       = { NULL, NULL };
+char  *h_Che_Active  [2]                                                     = { NULL, NULL };
+int   *h_Che_PGOffset[2]                                                     = { NULL, NULL };
+int    h_Che_NCell   [2]                                                     = { 0, 0 };
+real  *h_Che_CoolTime                                                        = NULL;
 grackle_field_data *Che_FieldData                                            = NULL;
+grackle_field_data *Che_FieldData_Patch                                      = NULL;
 code_units Che_Units;
 #endif
 
@@ -563,6 +599,19 @@ int main( int argc, char *argv[] )
 
       Timer_Other.Stop();
 #     endif
+
+      if ( OPT__RECORD_FLU_BANDWIDTH )
+      Aux_Record_FluBandwidth();
+
+#     ifdef COOLING
+      if ( OPT__COOL_SUBCYCLE )
+      Aux_Record_CoolSubcycle();
+#     endif
+
+#     ifdef SUPPORT_GRACKLE
+      if ( GRACKLE_ACTIVATE  &&  GRACKLE_LAZY )
+      Aux_Record_GrackleLazy();
+#     endif
 //    ---------------------------------------------------------------------------------------------------
 
 
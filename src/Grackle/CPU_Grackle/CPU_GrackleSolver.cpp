@@ -3,6 +3,12 @@
 #ifdef SUPPORT_GRACKLE
 
 
+#ifdef GRACKLE_DT
+static real Grackle_MinCoolingTime( const grackle_field_data *Che_FieldData, const code_units Che_Units,
+                                    const real CoolTime[], const int NCell );
+#endif
+
+
 
 
 //-----------------------------------------------------------------------------------------
@@ -11,65 +17,167 @@
 //                in the original Grackle library
 //
 // Note        :  1. Currently it is used even when GPU is enabled
+//                2. The input cells are arranged as a grid of CHE_NCELL_ALIGN x 1 x NCell/CHE_NCELL_ALIGN cells
+//                   --> NCell is set by Grackle_Prepare() and must be a multiple of CHE_NCELL_ALIGN
+//                   --> NCell == NPatchGroup*CUBE(PS2) unless GRACKLE_LAZY is on
+//                3. GRACKLE_ZERO_COPY: Che_FieldData[] holds one object per patch linked to the patch data by
+//                   Grackle_Prepare(), and Grackle is invoked patch by patch on a grid of PS1^3 cells
+//                   --> Patches are distributed over the OpenMP threads here while the OpenMP parallelization
+//                       in Grackle is disabled (omp_nthreads = 1), since PS1^2 rows per patch are too few to
+//                       keep all threads busy
+//                4. GRACKLE_DT: the cooling time of the updated cells is evaluated right after solve_chemistry() and
+//                   its minimum is stored in dt_Grackle_local, which is reduced over all ranks by Mis_GetTimeStep()
 //
 // Parameter   :  Che_FieldData : Array of Grackle "grackle_field_data" objects
 //                Che_Units     : Grackle "code_units" object
-//                NPatchGroup   : Number of patch groups to be evaluated
+//                NCell         : Number of cells to be evaluated
 //                dt            : Time interval to advance solution
 //-----------------------------------------------------------------------------------------
-void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NPatchGroup, const real dt )
+void CPU_GrackleSolver( grackle_field_data *Che_FieldData, code_units Che_Units, const int NCell, const real dt )
 {
 
-// set grid_dimension, grid_start, and grid_end
-   const int OptFac = 16;  // optimization factor
-   if ( SQR(PS2)%OptFac != 0 )   Aux_Error( ERROR_INFO, "SQR(PS2) %% OptFac != 0 !!\n" );
+// nothing to do if all cells are quiescent (for GRACKLE_LAZY)
+   if ( NCell == 0 )    return;
+
 
-   Che_FieldData->grid_dimension[0] = PS2*OptFac;
-   Che_FieldData->grid_dimension[1] = 1;
-   Che_FieldData->grid_dimension[2] = SQR(PS2)*NPatchGroup/OptFac;
+// invoke Grackle patch by patch for GRACKLE_ZERO_COPY
+// --> grid_dimension, grid_start, and grid_end have been set by Grackle_Prepare()
+// --> disable the OpenMP parallelization in Grackle and apply it to different patches instead
+   const int NPatch  = NCell/CUBE(PS1);
+   const int Gra_NT  = grackle_data->omp_nthreads;
+   int       NFail   = 0;
 
-   for (int d=0; d<3; d++)
+   if ( GRACKLE_ZERO_COPY )
    {
-      Che_FieldData->grid_start[d] = 0;
-      Che_FieldData->grid_end  [d] = Che_FieldData->grid_dimension[d] - 1;
+      grackle_data->omp_nthreads = 1;
+
+#     pragma omp parallel for reduction( +:NFail ) schedule( runtime )
+      for (int p=0; p<NPatch; p++)
+         if (  solve_chemistry( &Che_Units, Che_FieldData+p, dt ) == 0  )   NFail ++;
+
+      grackle_data->omp_nthreads = Gra_NT;
+
+      if ( NFail > 0 )  Aux_Error( ERROR_INFO, "Grackle solve_chemistry() failed in %d patches !!\n", NFail );
    }
 
-// invoke Grackle
-// --> note that we use the OpenMP implementation in Grackle directly, which applies the parallelization to the first two
-//     dimensiones of the input grid
-// --> this approach is found to be much more efficient than parallelizing different patches or patch groups here
-   if (  solve_chemistry( &Che_Units, Che_FieldData, dt ) == 0  )
-      Aux_Error( ERROR_INFO, "Grackle solve_chemistry() failed !!\n" );
+   else
+   {
+//    set grid_dimension, grid_start, and grid_end
+//    --> CHE_NCELL_ALIGN = PS2*16 with the optimization factor 16
+      if ( NCell%CHE_NCELL_ALIGN != 0 )   Aux_Error( ERROR_INFO, "NCell (%d) %% CHE_NCELL_ALIGN (%d) != 0 !!\n", NCell, CHE_NCELL_ALIGN );
+
+      Che_FieldData->grid_dimension[0] = CHE_NCELL_ALIGN;
+      Che_FieldData->grid_dimension[1] = 1;
+      Che_FieldData->grid_dimension[2] = NCell/CHE_NCELL_ALIGN;
+
+      for (int d=0; d<3; d++)
+      {
+         Che_FieldData->grid_start[d] = 0;
+         Che_FieldData->grid_end  [d] = Che_FieldData->grid_dimension[d] - 1;
+      }
+
+//    invoke Grackle
+//    --> note that we use the OpenMP implementation in Grackle directly, which applies the parallelization to the first two
+//        dimensiones of the input grid
+//    --> this approach is found to be much more efficient than parallelizing different patches or patch groups here
+      if (  solve_chemistry( &Che_Units, Che_FieldData, dt ) == 0  )
+         Aux_Error( ERROR_INFO, "Grackle solve_chemistry() failed !!\n" );
+   } // if ( GRACKLE_ZERO_COPY ) ... else ...
    
 #  ifdef GRACKLE_DT
-   /*
-   // ### this part should be optimized for performance
-   // get grackle cooling time scale
-   real *gr_cooling_time = new real[ (long)NPatchGroup*(long)CUBE(PS2) ] ;
-   
-   if ( calculate_cooling_time(&Che_Units, Che_FieldData, gr_cooling_time) == 0 ) {
-     Aux_Error( ERROR_INFO, "Grackle calculate_cooling_time() failed !!\n" );
+// estimate the cooling time of the updated cells for the time-step criterion of GRACKLE_DT
+// --> cells not sent into the solver (e.g., quiescent cells of GRACKLE_LAZY) are skipped
+   if ( GRACKLE_ZERO_COPY )
+   {
+      grackle_data->omp_nthreads = 1;
+
+#     pragma omp parallel for reduction( +:NFail ) schedule( runtime )
+      for (int p=0; p<NPatch; p++)
+         if (  calculate_cooling_time( &Che_Units, Che_FieldData+p, h_Che_CoolTime+p*CUBE(PS1) ) == 0  )   NFail ++;
+
+      grackle_data->omp_nthreads = Gra_NT;
+
+      if ( NFail > 0 )  Aux_Error( ERROR_INFO, "Grackle calculate_cooling_time() failed in %d patches !!\n", NFail );
    }
-   
-   //### note that not all cells in gr_cooling_time is updated in every loop
-   //### since NPG could change; need to double check
-   else {
-      for (int n=0; n<NPatchGroup*CUBE(PS2); n++) {
-         // only check high density cells
-         //### this does not seem to match the index 
-         if ( Che_FieldData->density[n] * Che_Units.density_units > 1e-12)
-            dt_Grackle_local = FMIN( dt_Grackle_local, FABS(gr_cooling_time[n]) );
-      }
-         
-      
-   } // if (calculate_cooling_time), else...
-   
-   delete [] gr_cooling_time;
-   */
+
+   else
+   {
+      if (  calculate_cooling_time( &Che_Units, Che_FieldData, h_Che_CoolTime ) == 0  )
+         Aux_Error( ERROR_INFO, "Grackle calculate_cooling_time() failed !!\n" );
+   }
+
+   const real CoolTime = Grackle_MinCoolingTime( Che_FieldData, Che_Units, h_Che_CoolTime, NCell );
+
+   dt_Grackle_local = FMIN( dt_Grackle_local, CoolTime );
 #  endif // GRACKLE_DT
 
 } // FUNCTION : CPU_GrackleSolver
 
 
 
+#ifdef GRACKLE_DT
+//-----------------------------------------------------------------------------------------
+// Function    :  Grackle_MinCoolingTime
+// Description :  Return the minimum absolute cooling time of the cells evaluated by CPU_GrackleSolver()
+//
+// Note        :  1. Only cells denser than MinDens_cgs are considered
+//                2. Each OpenMP thread records its own minimum, which are then compared in the order of
+//                   thread IDs so that the result is independent of the thread scheduling
+//                3. For GRACKLE_ZERO_COPY, Che_FieldData[] holds one object per patch with CUBE(PS1) cells
+//
+// Parameter   :  Che_FieldData : Array of Grackle "grackle_field_data" objects
+//                Che_Units     : Grackle "code_units" object
+//                CoolTime      : Cooling time returned by calculate_cooling_time()
+//                NCell         : Number of cells evaluated
+//
+// Return      :  Minimum cooling time in code units (HUGE_NUMBER if no cell is considered)
+//-----------------------------------------------------------------------------------------
+real Grackle_MinCoolingTime( const grackle_field_data *Che_FieldData, const code_units Che_Units,
+                             const real CoolTime[], const int NCell )
+{
+
+   const double MinDens_cgs = 1.0e-12;
+   const real   MinDens     = (real)( MinDens_cgs/Che_Units.density_units );
+   const int    NCellPerObj = ( GRACKLE_ZERO_COPY ) ? CUBE(PS1) : NCell;
+#  ifdef OPENMP
+   const int    NT          = OMP_NTHREAD;   // number of OpenMP threads
+#  else
+   const int    NT          = 1;
+#  endif
+
+   real *MinTime_OMP = new real [NT];
+   real  MinTime     = HUGE_NUMBER;
+   int   TID;
+
+   for (int t=0; t<NT; t++)   MinTime_OMP[t] = HUGE_NUMBER;
+
+#  pragma omp parallel private( TID )
+   {
+#     ifdef OPENMP
+      TID = omp_get_thread_num();
+#     else
+      TID = 0;
+#     endif
+
+#     pragma omp for schedule( static )
+      for (int n=0; n<NCell; n++)
+      {
+         const real Dens = Che_FieldData[ n/NCellPerObj ].density[ n%NCellPerObj ];
+
+         if ( Dens > MinDens )   MinTime_OMP[TID] = FMIN( MinTime_OMP[TID], FABS(CoolTime[n]) );
+      }
+   } // end of OpenMP parallel region
+
+// compare the minima evaluated by different OMP threads
+   for (int t=0; t<NT; t++)   MinTime = FMIN( MinTime_OMP[t], MinTime );
+
+   delete [] MinTime_OMP;
+
+   return MinTime;
+
+} // FUNCTION : Grackle_MinCoolingTime
+#endif // #ifdef GRACKLE_DT
+
+
+
 #endif // #ifdef SUPPORT_GRACKLE
@@ -23,10 +23,21 @@ void End_MemFree_Grackle()
 
    for (int t=0; t<2; t++)
    {
-      if ( h_Che_Array[t] != NULL )    delete [] h_Che_Array[t];
-      h_Che_Array[t] = NULL;
+      if ( h_Che_Array   [t] != NULL )    delete [] h_Che_Array   [t];
+      if ( h_Che_Active  [t] != NULL )    delete [] h_Che_Active  [t];
+      if ( h_Che_PGOffset[t] != NULL )    delete [] h_Che_PGOffset[t];
+
+      h_Che_Array   [t] = NULL;
+      h_Che_Active  [t] = NULL;
+      h_Che_PGOffset[t] = NULL;
    }
 
+   if ( Che_FieldData_Patch != NULL )  delete [] Che_FieldData_Patch;
+   Che_FieldData_Patch = NULL;
+
+   if ( h_Che_CoolTime != NULL )       delete [] h_Che_CoolTime;
+   h_Che_CoolTime = NULL;
+
 } // FUNCTION : End_MemFree_Grackle
 
 
@@ -39,20 +39,40 @@ extern double  Time[NLEVEL];
 //                       Grackle_AdvanceDt() in EvolveLevel()
 //                2. Che_NField and the corresponding array indices in h_Che_Array[] (e.g., CheIdx_Dens)
 //                   are declared and set by Init_MemAllocate_Grackle()
+//                3. GRACKLE_LAZY (see Grackle_Prepare()):
+//                   --> active cells are read from the compacted h_Che_Array[], and their density, specific internal
+//                       energy, and its rate of change over dt are stored in patch_t::che_cache
+//                   --> quiescent cells are advanced by the cached rate, and their chemical species and cache are
+//                       left unchanged
+//                4. GRACKLE_ZERO_COPY (see Grackle_Prepare()):
+//                   --> the chemical species have been updated in place by the Grackle solver, so only the total
+//                       energy and the dual-energy variable are updated here
+//                   --> SaveSg must equal the sandglass prepared by Grackle_Prepare() (i.e., FluSg)
+//                5. The cooling time-step of GRACKLE_DT is estimated by CPU_GrackleSolver() instead of here
 //
 // Parameter   :  lv          : Target refinement level
 //                SaveSg      : Sandglass to store the updated data
+//                dt          : Time interval to advance solution
 //                h_Che_Array : Host array storing the updated data
+//                Che_Active  : Host array storing the activity mask of all cells (for GRACKLE_LAZY only)
+//                PGOffset    : Host array storing the index of the first active cell of each patch group in h_Che_Array[]
+//                              (for GRACKLE_LAZY only)
 //                NPG         : Number of patch groups to store the updated data
 //                PID0_List   : List recording the patch indicies with LocalID==0 to be udpated
 //-------------------------------------------------------------------------------------------------------
-void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], const int NPG, const int *PID0_List )
+void Grackle_Close( const int lv, const int SaveSg, const double dt, const real h_Che_Array[], const char Che_Active[],
+                    const int PGOffset[], const int NPG, const int *PID0_List )
 {
 
    const int   Size1pg    = CUBE(PS2);
    const int   Size1v     = NPG*Size1pg;
    const real  Gamma_m1   = GAMMA - (real)1.0;
    const real _Gamma_m1   = (real)1.0 / Gamma_m1;
+   const bool  Lazy       = GRACKLE_LAZY;
+   const bool  ZeroCopy   = GRACKLE_ZERO_COPY;
+#  ifdef DUAL_ENERGY
+   const bool  CheckMinPres_No = false;
+#  endif
    //
    const double time_unit = Che_Units.time_units;
    const double L_unit    = Che_Units.length_units;
@@ -61,15 +81,11 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
    const double m_ave_cgs = Const_mH * (0.76 + 0.24*4) ;
    const double R         = (Const_kB/m_ave_cgs) * SQR(time_unit/L_unit) ;
    
-#  if defined(GRACKLE_RELAX) || defined(GRACKLE_DT)
+#  ifdef GRACKLE_RELAX
    const double t_orbit = 0.79 ;
    const double t_relax = 1*t_orbit ;
    const double t_curr  = Time[0];
 #  endif
-   
-#  ifdef GRACKLE_DT
-   const double dt_Lv0    = dTime_AllLv[0] ;  // dt at lv = 0
-#  endif
 
    const real *Ptr_Dens0  = h_Che_Array + CheIdx_Dens *Size1v;
    const real *Ptr_sEint0 = h_Che_Array + CheIdx_sEint*Size1v;
@@ -88,6 +104,11 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
    const real *Ptr_HDI0   = h_Che_Array + CheIdx_HDI  *Size1v;
 
 
+// check
+   if ( ZeroCopy  &&  SaveSg != amr->FluSg[lv] )
+      Aux_Error( ERROR_INFO, "SaveSg (%d) != FluSg (%d) for GRACKLE_ZERO_COPY !!\n", SaveSg, amr->FluSg[lv] );
+
+
 #  pragma omp parallel
    {
 
@@ -95,21 +116,24 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
    int  idx_pg, PID, PID0, offset;  // idx_pg: array indices within a patch group
    real Dens, Pres, Eint_new;
    real (*fluid)[PS1][PS1][PS1]=NULL;
+   real (*cache)[PS1][PS1][PS1]=NULL;
+   const char *Active=NULL;
    
    const real *Ptr_Dens=NULL, *Ptr_sEint=NULL, *Ptr_Ek=NULL, *Ptr_e=NULL, *Ptr_HI=NULL, *Ptr_HII=NULL;
    const real *Ptr_HeI=NULL, *Ptr_HeII=NULL, *Ptr_HeIII=NULL, *Ptr_HM=NULL, *Ptr_H2I=NULL, *Ptr_H2II=NULL;
    const real *Ptr_DI=NULL, *Ptr_DII=NULL, *Ptr_HDI=NULL;
    
-#  if defined(GRACKLE_RELAX) || defined(GRACKLE_DT)
-   real Etot_old, Eint_old, delta_Eint, dens_cgs, relax_frac, t_ratio; 
+#  ifdef GRACKLE_RELAX
+   real Etot_old, Eint_old, delta_Eint, relax_frac, t_ratio; 
 #  endif
 
 #  pragma omp for schedule( static )
    for (int TID=0; TID<NPG; TID++)
    {
       PID0      = PID0_List[TID];
+      offset    = ( Lazy ) ? PGOffset[TID] : TID*Size1pg;
       idx_pg    = 0;
-      offset    = TID*Size1pg;
+      Active    = ( Lazy ) ? Che_Active + TID*Size1pg : NULL;
 
       Ptr_Dens  = Ptr_Dens0  + offset;
       Ptr_sEint = Ptr_sEint0 + offset;
@@ -131,20 +155,43 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
       {
          PID   = PID0 + LocalID;
          fluid = amr->patch[SaveSg][lv][PID]->fluid;
+         cache = amr->patch[0][lv][PID]->che_cache;
 
          for (int idx_p=0; idx_p<CUBE(PS1); idx_p++)
          {
-            Dens     = Ptr_Dens [idx_pg];
+//          advance the quiescent cells by the cached rate
+            if ( Lazy  &&  !Active[ LocalID*CUBE(PS1) + idx_p ] )
+            {
+               const real Dens_q  = *( fluid[DENS][0][0] + idx_p );
+               const real Px_q    = *( fluid[MOMX][0][0] + idx_p );
+               const real Py_q    = *( fluid[MOMY][0][0] + idx_p );
+               const real Pz_q    = *( fluid[MOMZ][0][0] + idx_p );
+               const real Ek_q    = (real)0.5*( SQR(Px_q) + SQR(Py_q) + SQR(Pz_q) )/Dens_q;
+#              ifdef DUAL_ENERGY
+               const real Pres_q0 = CPU_DensEntropy2Pres( Dens_q, *(fluid[ENPY][0][0]+idx_p), Gamma_m1, CheckMinPres_No,
+                                                          NULL_REAL );
+#              else
+               const real Pres_q0 = ( *(fluid[ENGY][0][0]+idx_p) - Ek_q )*Gamma_m1;
+#              endif
+               const real Pres_q  = CPU_CheckMinPres( Pres_q0 + Dens_q*Gamma_m1*dt*( *(cache[CHE_CACHE_DSEINT][0][0]+idx_p) ),
+                                                      MIN_PRES );
+
+               *( fluid[ENGY][0][0] + idx_p ) = Pres_q*_Gamma_m1 + Ek_q;
+#              ifdef DUAL_ENERGY
+               *( fluid[ENPY][0][0] + idx_p ) = CPU_DensPres2Entropy( Dens_q, Pres_q, Gamma_m1 );
+#              endif
+
+               continue;
+            }
+
+            Dens     = ( ZeroCopy ) ? *( fluid[DENS][0][0] + idx_p ) : Ptr_Dens[idx_pg];
             Eint_new = Ptr_sEint[idx_pg];
             
-#           if (defined GRACKLE_RELAX) || (defined GRACKLE_DT)
-            dens_cgs   = Dens*(Che_Units.density_units);
+#           ifdef GRACKLE_RELAX
             Etot_old   = *(fluid[ENGY][0][0] + idx_p); 
             Eint_old   = Etot_old - Ptr_Ek[idx_pg] ;
             Eint_old   = FMAX(Eint_old, MIN_PRES*_Gamma_m1) ;
-#           endif // #if (defined GRACKLE_RELAX) || (defined GRACKLE_DT)
             
-#           ifdef GRACKLE_RELAX
             // only relax if the Time < relaxation time OR Temperature <= T_upper
             if (t_curr < t_relax && Eint_new/R*Gamma_m1 < T_upper ) {
                delta_Eint = Eint_new*Dens - Eint_old ;
@@ -160,14 +207,6 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
             Eint_new = FMIN( Eint_new, R*T_upper*_Gamma_m1 );
             
             
-#           ifdef GRACKLE_DT
-            delta_Eint = Eint_new*Dens - Eint_old ;
-            if (dens_cgs > 1e-12) {
-               dt_Grackle_local = FMIN(dt_Grackle_local, FABS(Eint_old/delta_Eint *dt_Lv0) );
-            }
-#           endif // GRACKLE_DT
-            
-            
 //          apply the minimum pressure check
             Pres = Eint_new*Dens*Gamma_m1;
             Pres = CPU_CheckMinPres( Pres, MIN_PRES );
@@ -185,7 +224,24 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
 #           endif
 #           endif // #ifdef DUAL_ENERGY
 
-//          update all chemical species
+//          update the cache of GRACKLE_LAZY
+//          --> CHE_CACHE_SEINT holds the input specific internal energy recorded by Grackle_Prepare()
+            if ( Lazy )
+            {
+               const real sEint_new = Pres*_Gamma_m1/Dens;
+
+               *( cache[CHE_CACHE_DSEINT][0][0] + idx_p ) = ( sEint_new - *(cache[CHE_CACHE_SEINT][0][0]+idx_p) )/dt;
+               *( cache[CHE_CACHE_SEINT ][0][0] + idx_p ) = sEint_new;
+               *( cache[CHE_CACHE_DENS  ][0][0] + idx_p ) = Dens;
+            }
+
+//          update all chemical species unless they have been updated in place (for GRACKLE_ZERO_COPY)
+            if ( ZeroCopy )
+            {
+               idx_pg ++;
+               continue;
+            }
+
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
             *( fluid[Idx_e    ][0][0] + idx_p ) = Ptr_e    [idx_pg];
             *( fluid[Idx_HI   ][0][0] + idx_p ) = Ptr_HI   [idx_pg];
@@ -32,6 +32,17 @@ extern int CheIdx_H2_DiskTau;
 #endif // #if (defined GRACKLE_H2_SOBOLEV) ... #elif (defined GRACKLE_H2_DISK)
 
 
+// statistics of the activity mask of this rank
+// --> accumulated by Grackle_Prepare() and reset by Aux_Record_GrackleLazy()
+long Che_Lazy_NCell  [NLEVEL];
+long Che_Lazy_NActive[NLEVEL];
+
+
+// grid dimension shared by all per-patch Grackle field data objects of GRACKLE_ZERO_COPY
+static int ZeroCopy_Dim  [3] = { PS1,   PS1,   PS1   };
+static int ZeroCopy_Start[3] = { 0,     0,     0     };
+static int ZeroCopy_End  [3] = { PS1-1, PS1-1, PS1-1 };
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Grackle_Prepare
@@ -41,13 +52,37 @@ extern int CheIdx_H2_DiskTau;
 //                   --> Che_NField and the corresponding array indices in h_Che_Array[] (e.g., CheIdx_Dens)
 //                       are declared and set by Init_MemAllocate_Grackle()
 //                2. This function always prepares the latest FluSg data
+//                3. GRACKLE_LAZY: only cells whose thermochemical state has changed since their last Grackle update
+//                   are sent into the Grackle solver. A cell is quiescent if
+//                   (a) |Dens  - Dens_c |  <= GRACKLE_LAZY_TOL*Dens_c
+//                   (b) |sEint - sEint_c|  <= GRACKLE_LAZY_TOL*sEint_c
+//                   (c) |dsEint_c/dt|*dt   <= GRACKLE_LAZY_TOL*sEint   (i.e., dt is short compared to the cooling time)
+//                   where "_c" are the values cached in patch_t::che_cache by Grackle_Close() after the last update
+//                   --> all cells of a patch without a valid cache (e.g., newly allocated patches) are active
+//                   --> active cells are compacted to the front of each field in h_Che_Array[] and padded to a multiple
+//                       of CHE_NCELL_ALIGN by duplicating the last active cell
+//                   --> quiescent cells are advanced by the cached rate in Grackle_Close()
+//                   --> statistics are recorded by Aux_Record_GrackleLazy()
+//                4. GRACKLE_ZERO_COPY: the density, chemical species, metallicity, and opacity fields are NOT copied
+//                   --> the field data object of each patch Che_FieldData_Patch[] points directly to patch_t::fluid[],
+//                       which is already stored field by field, so Grackle updates the species in place
+//                   --> only the derived specific internal and kinetic energies are stored in h_Che_Array[]
+//                   --> Grackle_Close() must therefore store the data in the same sandglass (i.e., FluSg)
 //
 // Parameter   :  lv          : Target refinement level
+//                dt          : Time interval to advance solution
 //                h_Che_Array : Host array to store the prepared data
+//                Che_Active  : Host array to store the activity mask of all cells (for GRACKLE_LAZY only)
+//                PGOffset    : Host array to store the index of the first active cell of each patch group in h_Che_Array[]
+//                              (for GRACKLE_LAZY only)
+//                NCell       : Number of cells (including padding) to be sent into the Grackle solver
 //                NPG         : Number of patch groups prepared at a time
 //                PID0_List   : List recording the patch indicies with LocalID==0 to be udpated
+//
+// Return      :  h_Che_Array[], Che_Active[], PGOffset[], NCell
 //-------------------------------------------------------------------------------------------------------
-void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int *PID0_List )
+void Grackle_Prepare( const int lv, const double dt, real h_Che_Array[], char Che_Active[], int PGOffset[], int &NCell,
+                      const int NPG, const int *PID0_List )
 {
 
 // check
@@ -125,6 +160,9 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 
    const int  Size1pg         = CUBE(PS2);
    const int  Size1v          = NPG*Size1pg;
+   const bool Lazy            = GRACKLE_LAZY;
+   const real Tol             = (real)GRACKLE_LAZY_TOL;
+   const bool ZeroCopy        = GRACKLE_ZERO_COPY;
 #  ifdef DUAL_ENERGY
    const real  Gamma_m1       = GAMMA - (real)1.0;
    const real _Gamma_m1       = (real)1.0 / Gamma_m1;
@@ -164,6 +202,9 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
    int  idx_pg, PID, PID0, offset;  // idx_pg: array indices within a patch group
    real Dens, Px, Py, Pz, Etot, _Dens, Ek, sEint;
    real (*fluid)[PS1][PS1][PS1]=NULL;;
+   real (*cache)[PS1][PS1][PS1]=NULL;
+   char *Active=NULL;
+   bool  CacheValid=false;
 
    real *Ptr_Dens=NULL, *Ptr_sEint=NULL, *Ptr_Ek=NULL, *Ptr_e=NULL, *Ptr_HI=NULL, *Ptr_HII=NULL;
    real *Ptr_HeI=NULL, *Ptr_HeII=NULL, *Ptr_HeIII=NULL, *Ptr_HM=NULL, *Ptr_H2I=NULL, *Ptr_H2II=NULL;
@@ -180,6 +221,7 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
       PID0      = PID0_List[TID];
       idx_pg    = 0;
       offset    = TID*Size1pg;
+      Active    = ( Lazy ) ? Che_Active + offset : NULL;
 
       Ptr_Dens  = Ptr_Dens0  + offset;
       Ptr_sEint = Ptr_sEint0 + offset;
@@ -210,6 +252,14 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
          PID   = PID0 + LocalID;
          fluid = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid;
 
+         if ( Lazy )
+         {
+            if ( amr->patch[0][lv][PID]->che_cache == NULL )   amr->patch[0][lv][PID]->cnew();
+
+            cache      = amr->patch[0][lv][PID]->che_cache;
+            CacheValid = ( cache[CHE_CACHE_DENS][0][0][0] != (real)CHE_CACHE_NEED_INIT );
+         }
+
          for (int idx_p=0; idx_p<CUBE(PS1); idx_p++)
          {
             Dens  = *( fluid[DENS][0][0] + idx_p );
@@ -234,11 +284,43 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
             sEint = ( Etot - Ek )*_Dens;
 #           endif // #ifdef DUAL_ENERGY ... else
 
+//          activity mask
+            if ( Lazy )
+            {
+               bool IsActive = true;
+
+               if ( CacheValid )
+               {
+                  const real Dens_c   = *( cache[CHE_CACHE_DENS  ][0][0] + idx_p );
+                  const real sEint_c  = *( cache[CHE_CACHE_SEINT ][0][0] + idx_p );
+                  const real dsEint_c = *( cache[CHE_CACHE_DSEINT][0][0] + idx_p );
+
+                  IsActive = (  FABS( Dens  - Dens_c  ) > Tol*Dens_c   ||
+                                FABS( sEint - sEint_c ) > Tol*sEint_c  ||
+                                FABS( dsEint_c )*dt     > Tol*sEint     );
+               }
+
+               Active[ LocalID*CUBE(PS1) + idx_p ] = IsActive;
+
+               if ( !IsActive )  continue;
+
+//             record the input specific internal energy for estimating the rate in Grackle_Close()
+               *( cache[CHE_CACHE_SEINT][0][0] + idx_p ) = sEint;
+            }
+
 //          mandatory fields
-            Ptr_Dens [idx_pg] = Dens;
             Ptr_sEint[idx_pg] = sEint;
             Ptr_Ek   [idx_pg] = Ek;
 
+//          all other fields are linked to the patch data directly for GRACKLE_ZERO_COPY
+            if ( ZeroCopy )
+            {
+               idx_pg ++;
+               continue;
+            }
+
+            Ptr_Dens [idx_pg] = Dens;
+
 //          6-species network
             if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
             Ptr_e    [idx_pg] = *( fluid[Idx_e    ][0][0] + idx_p );
@@ -278,12 +360,106 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
             idx_pg ++;
          } // for (int idx_p=0; idx_p<CUBE(PS1); idx_p++)
 
+//       link the field data object of this patch to the patch data for GRACKLE_ZERO_COPY
+         if ( ZeroCopy )
+         {
+            grackle_field_data *FieldData = Che_FieldData_Patch + TID*8 + LocalID;
+
+//          copy the fields not supported yet (and grid_rank) from Che_FieldData
+            *FieldData = *Che_FieldData;
+
+            FieldData->grid_dimension  = ZeroCopy_Dim;
+            FieldData->grid_start      = ZeroCopy_Start;
+            FieldData->grid_end        = ZeroCopy_End;
+            FieldData->grid_dx         = amr->dh[lv][0];
+
+            FieldData->density         = fluid[DENS][0][0];
+            FieldData->internal_energy = Ptr_sEint + LocalID*CUBE(PS1);
+
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE6 ) {
+            FieldData->e_density       = fluid[Idx_e    ][0][0];
+            FieldData->HI_density      = fluid[Idx_HI   ][0][0];
+            FieldData->HII_density     = fluid[Idx_HII  ][0][0];
+            FieldData->HeI_density     = fluid[Idx_HeI  ][0][0];
+            FieldData->HeII_density    = fluid[Idx_HeII ][0][0];
+            FieldData->HeIII_density   = fluid[Idx_HeIII][0][0];
+            }
+
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE9 ) {
+            FieldData->HM_density      = fluid[Idx_HM   ][0][0];
+            FieldData->H2I_density     = fluid[Idx_H2I  ][0][0];
+            FieldData->H2II_density    = fluid[Idx_H2II ][0][0];
+            }
+
+            if ( GRACKLE_PRIMORDIAL >= GRACKLE_PRI_CHE_NSPE12 ) {
+            FieldData->DI_density      = fluid[Idx_DI   ][0][0];
+            FieldData->DII_density     = fluid[Idx_DII  ][0][0];
+            FieldData->HDI_density     = fluid[Idx_HDI  ][0][0];
+            }
+
+            if ( GRACKLE_METAL )
+            FieldData->metal_density   = fluid[Idx_Metal][0][0];
+
+#           if (defined GRACKLE_H2_SOBOLEV)
+            FieldData->H2_Sobolev_tau_x = fluid[Idx_OpTauX][0][0];
+            FieldData->H2_Sobolev_tau_y = fluid[Idx_OpTauY][0][0];
+            FieldData->H2_Sobolev_tau_z = fluid[Idx_OpTauZ][0][0];
+#           elif (defined GRACKLE_H2_DISK)
+            FieldData->H2_Disk_tau      = fluid[Idx_DiskTau][0][0];
+#           endif
+         } // if ( ZeroCopy )
+
       } // for (int LocalID=0; LocalID<8; LocalID++)
+
+      if ( Lazy )    PGOffset[TID] = idx_pg;  // number of active cells in this patch group for now
    } // for (int TID=0; TID<NPG; TID++)
 
    } // end of OpenMP parallel region
 
 
+// compact the active cells to the front of each field and pad them to a multiple of CHE_NCELL_ALIGN
+   if ( Lazy )
+   {
+      int NActive = 0;
+
+      for (int TID=0; TID<NPG; TID++)
+      {
+         const int NActive_PG = PGOffset[TID];
+
+         PGOffset[TID]  = NActive;
+         NActive       += NActive_PG;
+      }
+
+      NCell = ( NActive + CHE_NCELL_ALIGN - 1 )/CHE_NCELL_ALIGN*CHE_NCELL_ALIGN;
+
+#     pragma omp parallel for schedule( static )
+      for (int v=0; v<Che_NField; v++)
+      {
+         real *Ptr = h_Che_Array + v*Size1v;
+
+         for (int TID=0; TID<NPG; TID++)
+         {
+            const int NActive_PG = ( ( TID == NPG-1 ) ? NActive : PGOffset[TID+1] ) - PGOffset[TID];
+
+            if ( PGOffset[TID] != TID*Size1pg )
+               memmove( Ptr+PGOffset[TID], Ptr+TID*Size1pg, NActive_PG*sizeof(real) );
+         }
+
+         for (int t=NActive; t<NCell; t++)   Ptr[t] = Ptr[ NActive-1 ];
+      }
+
+      Che_Lazy_NCell  [lv] += Size1v;
+      Che_Lazy_NActive[lv] += NActive;
+   } // if ( Lazy )
+
+   else
+      NCell = Size1v;
+
+
+// the field data objects have been linked to the patch data already for GRACKLE_ZERO_COPY
+   if ( ZeroCopy )   return;
+
+
 // set cell size and link pointers for different fields
    Che_FieldData->grid_dx         = amr->dh[lv][0];   // Grackle assumes cubic cells which is only used for H2 self-shielding approximation
 
@@ -41,6 +41,12 @@ int CheIdx_H2_DiskTau = Idx_Undefined;
 //                2. Invoked by Init_MemAllocate()
 //                3. Also set global variables for accessing h_Che_Array[]
 //                   --> Declared on the top of this file
+//                4. Also allocate the activity mask h_Che_Active[] and the patch-group offsets h_Che_PGOffset[]
+//                   for GRACKLE_LAZY (see Grackle_Prepare())
+//                5. Also allocate one Grackle field data object per patch Che_FieldData_Patch[] for GRACKLE_ZERO_COPY
+//                   --> h_Che_Array[] is still allocated with all Che_NField fields for simplicity, but only
+//                       CheIdx_sEint and CheIdx_Ek are accessed
+//                6. Also allocate the cooling-time array h_Che_CoolTime[] for GRACKLE_DT (see CPU_GrackleSolver())
 //
 // Parameter   :  Che_NPG : Number of patch groups to be evaluated at a time
 //-------------------------------------------------------------------------------------------------------
@@ -98,6 +104,20 @@ void Init_MemAllocate_Grackle( const int Che_NPG )
    for (int t=0; t<2; t++)
       h_Che_Array[t] = new real [ (long)Che_NField*(long)Che_NPG*(long)CUBE(PS2) ];
 
+   if ( GRACKLE_LAZY )
+   for (int t=0; t<2; t++)
+   {
+      h_Che_Active  [t] = new char [ (long)Che_NPG*(long)CUBE(PS2) ];
+      h_Che_PGOffset[t] = new int  [ Che_NPG ];
+   }
+
+   if ( GRACKLE_ZERO_COPY )
+      Che_FieldData_Patch = new grackle_field_data [ 8*Che_NPG ];
+
+#  ifdef GRACKLE_DT
+   h_Che_CoolTime = new real [ (long)Che_NPG*(long)CUBE(PS2) ];
+#  endif
+
 } // FUNCTION : Init_MemAllocate_Grackle
 
 
@@ -30,6 +30,15 @@ void End_GAMER()
    End_FFTW();
 #  endif
 
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   Hydro_End_CylGeo();
+#  ifdef COOLING
+   Hydro_End_CoolTable();
+#  endif
+   Hydro_OrbAdv_End();
+   Flu_LTS_End();
+#  endif
+
 #  ifdef SUPPORT_LIBYT
    YT_End();
 #  endif
@@ -1703,6 +1703,9 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__WAF_Limiter",        &RS.Opt__WAF_Limiter,        SID, TID, NonFatal, &RT.Opt__WAF_Limiter,         1, NonFatal );
    LoadField( "Opt__1stFluxCorr",        &RS.Opt__1stFluxCorr,        SID, TID, NonFatal, &RT.Opt__1stFluxCorr,         1, NonFatal );
    LoadField( "Opt__1stFluxCorrScheme",  &RS.Opt__1stFluxCorrScheme,  SID, TID, NonFatal, &RT.Opt__1stFluxCorrScheme,   1, NonFatal );
+#  if ( COORDINATE == CYLINDRICAL )
+   LoadField( "Opt__CylRGrid",           &RS.Opt__CylRGrid,           SID, TID, NonFatal, &RT.Opt__CylRGrid,            1,    Fatal );
+#  endif
 #  endif
 
 // ELBDM solvers
@@ -76,6 +76,12 @@ void Init_GAMER( int *argc, char ***argv )
    Init_Parallelization();
 
 
+// initialize the radial geometry tables of the cylindrical hydro solver
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   Hydro_Init_CylGeo();
+#  endif
+
+
 #  ifdef GRAVITY
 // initialize FFTW
    Init_FFTW();
@@ -120,6 +126,26 @@ void Init_GAMER( int *argc, char ***argv )
    Aux_Check_Parameter();
 
 
+// initialize orbital advection
+// --> must be called AFTER Init_TestProb() to get OrbAdv_Vphi_User_Ptr
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   if ( OPT__ORBITAL_ADV != ORB_ADV_NONE )   Hydro_OrbAdv_Init();
+#  endif
+
+
+// initialize the local time-stepping
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   if ( LTS_NBIN > 1 )  Flu_LTS_Init();
+#  endif
+
+
+// initialize the cooling tables
+// --> must be called AFTER Hydro_Init_CylGeo() and Aux_Check_Parameter()
+#  ifdef COOLING
+   Hydro_Init_CoolTable();
+#  endif
+
+
 // initialize the timer function
 #  ifdef TIMING
    Aux_CreateTimer();
@@ -92,8 +92,17 @@ void Init_Load_Parameter()
 // do not check GFUNC_COEFF0 since it may be reset by Init_ResetDefaultParameter()
    ReadPara->Add( "GFUNC_COEFF0",               &GFUNC_COEFF0,                   -1.0,             NoMin_double,  NoMax_double   );
 #  if (COORDINATE == CYLINDRICAL)
-   ReadPara->Add( "RANK_I_TOT",                 &RANK_I_TOT,                     MPI_NRank,        1,             MPI_NRank      );
+// RANK_I_TOT <= 0 --> determine RANK_I_TOT and RANK_IP_TOT automatically by Init_CylRankTuner()
+   ReadPara->Add( "RANK_I_TOT",                 &RANK_I_TOT,                     MPI_NRank,        NoMin_int,     MPI_NRank      );
    ReadPara->Add( "RANK_IP_TOT",                &RANK_IP_TOT,                    1,                1,             MPI_NRank      );
+   ReadPara->Add( "CYL_RANK_TUNE_NTRIAL",       &CYL_RANK_TUNE_NTRIAL,           0,                0,             NoMax_int      );
+   ReadPara->Add( "CYL_HMATRIX_TOL",            &CYL_HMATRIX_TOL,                0.0,              0.0,           1.0            );
+   ReadPara->Add( "CYL_POISSON_MMAX",           &CYL_POISSON_MMAX,               -1,               -1,            NoMax_int      );
+   ReadPara->Add( "CYL_KERNEL_CACHE",           &CYL_KERNEL_CACHE,               false,            Useless_bool,  Useless_bool   );
+#  ifdef SUPPORT_FFTW3
+   ReadPara->Add( "CYL_FFTW3_WISDOM",           &CYL_FFTW3_WISDOM,               false,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "CYL_FFTW3_SINGLE",           &CYL_FFTW3_SINGLE,               false,            Useless_bool,  Useless_bool   );
+#  endif
 #  endif
 #  endif
 
@@ -214,6 +223,9 @@ void Init_Load_Parameter()
    ReadPara->Add( "GRACKLE_THREE_BODY_RATE",    &GRACKLE_THREE_BODY_RATE,         1,               0,             5              );
    ReadPara->Add( "GRACKLE_CIE_COOLING",        &GRACKLE_CIE_COOLING,             0,               0,             1              );
    ReadPara->Add( "GRACKLE_H2_OPA_APPROX",      &GRACKLE_H2_OPA_APPROX,           1,               0,             3              );
+   ReadPara->Add( "GRACKLE_LAZY",               &GRACKLE_LAZY,                    false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "GRACKLE_LAZY_TOL",           &GRACKLE_LAZY_TOL,                1.0e-2,          Eps_double,    1.0            );
+   ReadPara->Add( "GRACKLE_ZERO_COPY",          &GRACKLE_ZERO_COPY,               false,           Useless_bool,  Useless_bool   );
 // do not check CHE_GPU_NPGROUP since it may be reset by either Init_ResetDefaultParameter() or CUAPI_Set_Default_GPU_Parameter()
    ReadPara->Add( "CHE_GPU_NPGROUP",            &CHE_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
 #  endif
@@ -243,9 +255,21 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__WAF_LIMITER",           &OPT__WAF_LIMITER,                WAF_VANLEER,     0,             4              );
    ReadPara->Add( "OPT__1ST_FLUX_CORR",         &OPT__1ST_FLUX_CORR,              FIRST_FLUX_CORR_3D1D, 0,        2              );
    ReadPara->Add( "OPT__1ST_FLUX_CORR_SCHEME",  &OPT__1ST_FLUX_CORR_SCHEME,       RSOLVER_1ST_ROE, 0,             3              );
+   ReadPara->Add( "FLU_TILE_CACHE_KB",          &FLU_TILE_CACHE_KB,               0,               0,             NoMax_int      );
+#  if ( COORDINATE == CYLINDRICAL )
+   ReadPara->Add( "OPT__ORBITAL_ADV",           &OPT__ORBITAL_ADV,                ORB_ADV_NONE,    0,             2              );
+   ReadPara->Add( "LTS_NBIN",                   &LTS_NBIN,                        1,               1,             LTS_NBIN_MAX   );
+   ReadPara->Add( "OPT__CYL_RGRID",             &OPT__CYL_RGRID,                  CYL_RGRID_UNIFORM, 0,           2              );
+#  endif
 #  ifdef DUAL_ENERGY
    ReadPara->Add( "DUAL_ENERGY_SWITCH",         &DUAL_ENERGY_SWITCH,              2.0e-2,          0.0,           NoMax_double   );
 #  endif
+#  ifdef COOLING
+   ReadPara->Add( "OPT__COOL_SUBCYCLE",         &OPT__COOL_SUBCYCLE,              true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "COOL_SUBCYCLE_TOL",          &COOL_SUBCYCLE_TOL,               1.0e-3,          Eps_double,    1.0            );
+   ReadPara->Add( "COOL_SUBCYCLE_NMAX",         &COOL_SUBCYCLE_NMAX,              1000,            1,             NoMax_int      );
+   ReadPara->Add( "COOL_LB_WEIGHT",             &COOL_LB_WEIGHT,                  0.0,             0.0,           NoMax_double   );
+#  endif
 
 #  elif ( MODEL == MHD )
 #  warning : WAIT MHD !!!
@@ -403,6 +427,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__TIMING_MPI",            &OPT__TIMING_MPI,                 false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_MEMORY",         &OPT__RECORD_MEMORY,              true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_PERFORMANCE",    &OPT__RECORD_PERFORMANCE,         true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__RECORD_FLU_BANDWIDTH",  &OPT__RECORD_FLU_BANDWIDTH,       false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__MANUAL_CONTROL",        &OPT__MANUAL_CONTROL,             true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_USER",           &OPT__RECORD_USER,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OPTIMIZE_AGGRESSIVE",   &OPT__OPTIMIZE_AGGRESSIVE,        false,           Useless_bool,  Useless_bool   );
@@ -421,6 +446,9 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__CK_NEGATIVE",           &OPT__CK_NEGATIVE,                0,               0,             3              );
 #  endif
    ReadPara->Add( "OPT__CK_MEMFREE",            &OPT__CK_MEMFREE,                 1.0,             0.0,           NoMax_double   );
+#  ifdef COOLING
+   ReadPara->Add( "OPT__CK_COOL_TABLE",         &OPT__CK_COOL_TABLE,              false,           Useless_bool,  Useless_bool   );
+#  endif
 #  ifdef PARTICLE
    ReadPara->Add( "OPT__CK_PARTICLE",           &OPT__CK_PARTICLE,                false,           Useless_bool,  Useless_bool   );
 #  endif
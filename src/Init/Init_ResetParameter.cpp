@@ -599,6 +599,26 @@ void Init_ResetParameter()
 #  endif // #if ( MODEL == HYDRO  ||  MODEL == MHD )
 
 
+// disable FLU_TILE_CACHE_KB and OPT__RECORD_FLU_BANDWIDTH if they are useless
+#  if (  MODEL == HYDRO  &&  ( defined GPU  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP ) )  )
+   if ( FLU_TILE_CACHE_KB != 0 )
+   {
+      FLU_TILE_CACHE_KB = 0;
+
+      PRINT_WARNING( FLU_TILE_CACHE_KB, FORMAT_INT, "since it's only useful for the CPU MHM/MHM_RP schemes" );
+   }
+#  endif
+
+#  if (  MODEL != HYDRO  ||  defined GPU  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP )  )
+   if ( OPT__RECORD_FLU_BANDWIDTH )
+   {
+      OPT__RECORD_FLU_BANDWIDTH = false;
+
+      PRINT_WARNING( OPT__RECORD_FLU_BANDWIDTH, FORMAT_INT, "since it's only supported by the CPU MHM/MHM_RP schemes" );
+   }
+#  endif
+
+
 // disable the refinement flag of Jeans length if GRAVITY is disabled
 #  if (  (MODEL == HYDRO || MODEL == MHD )  &&  !defined GRAVITY  )
    if ( OPT__FLAG_JEANS )
@@ -15,7 +15,11 @@
 //                   --> Workload of a single patch (without particles) is normalized to 1.0
 //                2. Workload of each patch **includes particles in the children patches"
 //                   --> For non-leaf patches, this function will collect particles from the leaf patches
-//                3. This function assumes that "NPatchTotal[lv]" has already been set by invoking the
+//                3. With COOLING and OPT__COOL_SUBCYCLE, the workload of each patch further includes
+//                   "CoolNSub*COOL_LB_WEIGHT/PATCH_SIZE^3", where "CoolNSub" is the number of cooling substeps
+//                   taken by this patch in the last update (see Hydro_Cooling_AdvanceDt())
+//                   --> patches that have not been updated since being allocated have CoolNSub == 0
+//                4. This function assumes that "NPatchTotal[lv]" has already been set by invoking the
 //                   function "Mis_GetTotalPatchNumber( lv )"
 //
 // Parameter   :  lv        : Target refinement level
@@ -80,6 +84,20 @@ void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, do
    } // if ( ParWeight_Norm > 0.0 )
 #  endif // #ifdef PARTICLE
 
+
+// 3. workload of cooling substeps
+#  ifdef COOLING
+   if ( OPT__COOL_SUBCYCLE  &&  COOL_LB_WEIGHT > 0.0 )
+   {
+//    renormalize the load-balance weighting of one substep so that the weighting of one patch is 1.0
+      const double CoolWeight_Norm = COOL_LB_WEIGHT / (double)CUBE(PS1);
+
+      for (int t=0; t<NPG_ThisRank; t++)
+      for (int PID=t*8; PID<(t+1)*8; PID++)
+         Load_PG[t] += amr->patch[0][lv][PID]->CoolNSub*CoolWeight_Norm;
+   }
+#  endif // #ifdef COOLING
+
 } // FUNCTION : LB_EstimateWorkload_AllPatchGroup
 
 
@@ -258,6 +258,13 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
    }
 
 
+// 7. invalidate the slab <-> patch communication schedule of the cylindrical Poisson solver
+//    --> it will be reconstructed in the next Poisson solve
+#  if ( defined GRAVITY  &&  COORDINATE == CYLINDRICAL )
+   if ( lv_min == 0 )   CylPoisson_FreeSchedule();
+#  endif
+
+
    if ( MPI_Rank == 0 )
    {
       char lv_str[MAX_STRING];
@@ -56,10 +56,26 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
 #  endif
 
 
+// start the reduction of the Grackle cooling time-step over all ranks, which is completed in criterion 1.9
+// --> use a non-blocking collective to overlap it with the evaluation of other criteria
+#  ifdef GRACKLE_DT
+   MPI_Request Req_Grackle;
+#  ifdef FLOAT8
+   MPI_Iallreduce( &dt_Grackle_local, &dt_Grackle_global, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD, &Req_Grackle );
+#  else
+   MPI_Iallreduce( &dt_Grackle_local, &dt_Grackle_global, 1, MPI_FLOAT,  MPI_MIN, MPI_COMM_WORLD, &Req_Grackle );
+#  endif
+#  endif
+
+
 
 // 1.1 CRITERION ONE : fluid solver
 // =============================================================================================================
 #  if   ( MODEL == HYDRO )
+#  if ( COORDINATE == CYLINDRICAL )
+   const int Idx_HydroCFL = NdTime;    // scaled by the local time-stepping below
+#  endif
+
    dTime[NdTime] = dTime_dt * dt_InvokeSolver( DT_FLU_SOLVER, lv );
    sprintf( dTime_Name[NdTime++], "%s", "Hydro_CFL" );
 
@@ -95,6 +111,19 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
 #  endif // #ifdef GRAVITY
 
 
+// the CFL criterion only limits the fastest time-step bin of the local time-stepping
+// --> the macro step is 2^BinMax times longer (see Flu_AdvanceDt_LTS())
+// --> the gravity criterion is NOT scaled since gravity is applied once per macro step
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   if ( LTS_NBIN > 1  &&  lv == 0 )
+   {
+      const int BinMax = Flu_LTS_SetBin( lv );
+
+      dTime[Idx_HydroCFL] *= (double)( 1 << BinMax );
+   }
+#  endif
+
+
 // 1.3 CRITERION THREE : maximum allowed variation of the expansion factor
 // =============================================================================================================
 #  ifdef COMOVING
@@ -186,10 +215,12 @@ double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double
 #  endif
 
 
-// 1.9 modify by wtl; needed to be double check 
+// 1.9 CRITERION NINE : Grackle cooling time
+// =============================================================================================================
+// --> dt_Grackle_local is the minimum cooling time evaluated by CPU_GrackleSolver() during the last update
 #  ifdef GRACKLE_DT
    double dt_grackle_safty = 5e-2;
-   MPI_Allreduce( &dt_Grackle_local, &dt_Grackle_global, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD );
+   MPI_Wait( &Req_Grackle, MPI_STATUS_IGNORE );
    dTime[NdTime] = dTime_dt * (dt_grackle_safty * dt_Grackle_global);
    sprintf( dTime_Name[NdTime++], "%s", "Grackle" );
 #  endif
@@ -13,15 +13,26 @@ extern double dt_min_for_solver;
 // Note        :  1. Get the minimum dt in all target patches
 //                2. Store the minimum dt in the global variable "dt_min_for_solver" declared in dt_InvokeSolver.cpp
 //                   --> "dt_min_for_solver" must be initialized as an extremely large value in advance
+//                3. Also record the minimum dt of each radial column for the local time-stepping (LTS_NBIN > 1)
+//                   --> fluid dt solver only since gravity is not subcycled by the time-step bins
 //
-// Parameter   :  h_dt_Array_T : Host array storing the minimum dt in each target patch
+// Parameter   :  TSolver      : Target dt solver
+//                               --> DT_FLU_SOLVER : dt solver for the fluid
+//                                   DT_GRA_SOLVER : dt solver for the gravity
+//                lv           : Target refinement level
+//                h_dt_Array_T : Host array storing the minimum dt in each target patch
 //                NPG          : Number of target patch groups
+//                PID0_List    : List recording the patch indicies with LocalID==0 to be udpated
 //-------------------------------------------------------------------------------------------------------
-void dt_Close( const real h_dt_Array_T[], const int NPG )
+void dt_Close( const Solver_t TSolver, const int lv, const real h_dt_Array_T[], const int NPG, const int *PID0_List )
 {
 
    const int NP = 8*NPG;
 
    for (int t=0; t<NP; t++)   dt_min_for_solver = fmin( dt_min_for_solver, (double)h_dt_Array_T[t] );
 
+#  if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+   if ( LTS_NBIN > 1  &&  lv == 0  &&  TSolver == DT_FLU_SOLVER )    Flu_LTS_RecordDt( lv, h_dt_Array_T, NPG, PID0_List );
+#  endif
+
 } // FUNCTION : dt_Close
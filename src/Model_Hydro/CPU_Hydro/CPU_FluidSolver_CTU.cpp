@@ -6,7 +6,7 @@
 
 
 extern void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][NCOMP_TOTAL], const int NIn, const int NGhost,
-                                    const real Gamma, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                                    const int kBeg, const int kEnd, const real Gamma, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                     const real EP_Coeff, const real dt, const real dh, const real MinDens, const real MinPres );
 extern void CPU_Con2Pri( const real In[], real Out[], const real Gamma_m1, const real MinPres,
                          const bool NormPassive, const int NNorm, const int NormIdx[],
@@ -14,11 +14,11 @@ extern void CPU_Con2Pri( const real In[], real Out[], const real Gamma_m1, const
 extern void CPU_Pri2Con( const real In[], real Out[], const real _Gamma_m1,
                          const bool NormPassive, const int NNorm, const int NormIdx[] );
 extern void CPU_ComputeFlux( const real FC_Var[][6][NCOMP_TOTAL], real FC_Flux[][3][NCOMP_TOTAL], const int NFlux, const int Gap,
-                             const real Gamma, const bool CorrHalfVel, const real Pot_USG[], const double Corner[],
+                             const int kBeg, const int kEnd, const real Gamma, const bool CorrHalfVel, const real Pot_USG[], const double Corner[],
                              const real dt, const real dh, const double Time, const OptGravityType_t GravityType,
                              const double ExtAcc_AuxArray[], const real MinPres );
 extern void CPU_FullStepUpdate( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Output[][ PS2*PS2*PS2 ], char DE_Status[],
-                                const real Flux[][3][NCOMP_TOTAL], const real dt, const real dh,
+                                const real Flux[][3][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dt, const real dh,
                                 const real Gamma, const real MinDens, const real MinPres, const real DualEnergySwitch,
                                 const bool NormPassive, const int NNorm, const int NormIdx[] );
 extern void CPU_StoreFlux( real Flux_Array[][NCOMP_TOTAL][ PS2*PS2 ], const real FC_Flux[][3][NCOMP_TOTAL] );
@@ -126,7 +126,7 @@ void CPU_FluidSolver_CTU( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
 
 
 //       2. evaluate the face-centered values at the half time-step
-         CPU_DataReconstruction( PriVar, FC_Var, FLU_NXT, FLU_GHOST_SIZE-1, Gamma, LR_Limiter,
+         CPU_DataReconstruction( PriVar, FC_Var, FLU_NXT, FLU_GHOST_SIZE-1, 0, N_FC_VAR, Gamma, LR_Limiter,
                                  MinMod_Coeff, EP_Coeff, dt, dh, MinDens, MinPres );
 
 
@@ -147,7 +147,7 @@ void CPU_FluidSolver_CTU( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
 
 
 //       4. evaluate the face-centered half-step fluxes by solving the Riemann problem
-         CPU_ComputeFlux( FC_Var, FC_Flux, N_HF_FLUX, 0, Gamma, CorrHalfVel_No, NULL, NULL,
+         CPU_ComputeFlux( FC_Var, FC_Flux, N_HF_FLUX, 0, 0, N_HF_FLUX, Gamma, CorrHalfVel_No, NULL, NULL,
                           NULL_REAL, NULL_REAL, NULL_REAL, GRAVITY_NONE, NULL, MinPres );
 
 
@@ -157,17 +157,17 @@ void CPU_FluidSolver_CTU( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
 
 //       6. evaluate the face-centered full-step fluxes by solving the Riemann problem with the corrected data
 #        ifdef UNSPLIT_GRAVITY
-         CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, Gamma, CorrHalfVel_Yes, Pot_Array_USG[P][0][0], Corner_Array[P],
+         CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, 0, N_FL_FLUX, Gamma, CorrHalfVel_Yes, Pot_Array_USG[P][0][0], Corner_Array[P],
                           dt, dh, Time, GravityType, ExtAcc_AuxArray, MinPres );
 #        else
-         CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, Gamma, CorrHalfVel_No,  NULL, NULL,
+         CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, 0, N_FL_FLUX, Gamma, CorrHalfVel_No,  NULL, NULL,
                           NULL_REAL, NULL_REAL, NULL_REAL, GRAVITY_NONE, NULL, MinPres );
 #        endif
 
 
 //       7. full-step evolution
          CPU_FullStepUpdate( Flu_Array_In[P], Flu_Array_Out[P], DE_Array_Out[P],
-                             FC_Flux, dt, dh, Gamma, MinDens, MinPres, DualEnergySwitch,
+                             FC_Flux, 0, PS2, dt, dh, Gamma, MinDens, MinPres, DualEnergySwitch,
                              NormPassive, NNorm, NormIdx );
 
 
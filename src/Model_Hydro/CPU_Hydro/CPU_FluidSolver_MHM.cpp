@@ -6,9 +6,9 @@
 
 
 extern void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][NCOMP_TOTAL], const int NIn, const int NGhost,
-                                    const real Gamma, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-                                    const real EP_Coeff, const real dt, const real dh[], const double Corner[], 
-                                    const real MinDens, const real MinPres );
+                                    const int kBeg, const int kEnd, const real Gamma, const LR_Limiter_t LR_Limiter,
+                                    const real MinMod_Coeff, const real EP_Coeff, const real dt, const real dh[],
+                                    const double Corner[], const real MinDens, const real MinPres );
 extern void CPU_Con2Flux( const int XYZ, real Flux[], const real Input[], const real Gamma_m1, const real MinPres );
 extern void CPU_Con2Pri( const real In[], real Out[], const real Gamma_m1, const real MinPres,
                          const bool NormPassive, const int NNorm, const int NormIdx[],
@@ -16,12 +16,12 @@ extern void CPU_Con2Pri( const real In[], real Out[], const real Gamma_m1, const
 extern void CPU_Pri2Con( const real In[], real Out[], const real _Gamma_m1,
                          const bool NormPassive, const int NNorm, const int NormIdx[] );
 extern void CPU_ComputeFlux( const real FC_Var[][6][NCOMP_TOTAL], real FC_Flux[][3][NCOMP_TOTAL], const int NFlux, const int Gap,
-                             const real Gamma, const bool CorrHalfVel, const real Pot_USG[], const double Corner[],
+                             const int kBeg, const int kEnd, const real Gamma, const bool CorrHalfVel, const real Pot_USG[], const double Corner[],
                              const real dt, const real dh[], const double Time, const OptGravityType_t GravityType,
                              const double ExtAcc_AuxArray[], const real MinPres );
 extern void CPU_FullStepUpdate( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Output[][ PS2*PS2*PS2 ], char DE_Status[],
-                                const real Flux[][3][NCOMP_TOTAL], const real dt, const real dh[], const double Corner[],
-                                const real Gamma, const real MinDens, const real MinPres, const real DualEnergySwitch,
+                                const real Flux[][3][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dt,
+                                const real dh[], const double Corner[], const real GeoSrc_In[][NCOMP_TOTAL], const real Gamma, const real MinDens, const real MinPres, const real DualEnergySwitch,
                                 const bool NormPassive, const int NNorm, const int NormIdx[] );
 extern void CPU_StoreFlux( real Flux_Array[][NCOMP_TOTAL][ PS2*PS2 ], const real FC_Flux[][3][NCOMP_TOTAL] );
 #if   ( RSOLVER == EXACT )
@@ -41,24 +41,29 @@ extern real CPU_CheckMinPres( const real InPres, const real MinPres );
 
 #if   ( FLU_SCHEME == MHM_RP )
 static void CPU_RiemannPredict( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ],
-                                const real Half_Flux[][3][NCOMP_TOTAL], real Half_Var[][NCOMP_TOTAL], const real dt,
-                                const real dh[], const real Gamma, const real MinDens, const real MinPres, 
-                                const double Corner[] );
+                                const real Half_Flux[][3][NCOMP_TOTAL], real Half_Var[][NCOMP_TOTAL],
+                                const int kBeg, const int kEnd, const real dt, const real dh[], const real Gamma,
+                                const real MinDens, const real MinPres, const double Corner[],
+                                const real GeoSrc_In[][NCOMP_TOTAL] );
 static void CPU_RiemannPredict_Flux( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Half_Flux[][3][NCOMP_TOTAL],
-                                     const real Gamma, const real MinPres );
+                                     const int kBeg, const int kEnd, const real Gamma, const real MinPres,
+                                     const double Corner[], const real dh[] );
 #if (COORDINATE == CYLINDRICAL)
-static void RiemannFluxGrad( const real Flux_R, const real Flux_L, real* const & dF, const int d, const int v,
-                             const real* x_pos, const real face_pos[][2] ) ;
+template <int Class>
+static void RiemannFluxGrad( const real Flux_R[], const real Flux_L[], real dF[], const int d,
+                             const CylGeo_t *Geo, const int ir, const int v0, const int v1 ) ;
 #endif   // COORDINATE == CYLINDRICAL
                              
 #elif ( FLU_SCHEME == MHM )
-static void CPU_HancockPredict( real FC_Var[][6][NCOMP_TOTAL], const real dt, const real dh[], const real Gamma,
-                                const real C_Var[][ FLU_NXT*FLU_NXT*FLU_NXT ], const double Corner[], 
-                                const real MinDens, const real MinPres ) ;
+static void CPU_HancockPredict( real FC_Var[][6][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dt,
+                                const real dh[], const real Gamma, const real C_Var[][ FLU_NXT*FLU_NXT*FLU_NXT ],
+                                const double Corner[], const real GeoSrc_In[][NCOMP_TOTAL], const real MinDens,
+                                const real MinPres ) ;
 #if (COORDINATE == CYLINDRICAL)
-extern void HancockFluxGrad( real Flux[][NCOMP_TOTAL], real* const & dFlux, real* GeoSource,
-                             const real* x_pos, const real face_pos[][2], const int v, 
-                             const real* dt_dh2, const real dt_2 ) ;                              
+template <int Class>
+static void HancockFluxGrad( const real Flux[][NCOMP_TOTAL], real dFlux[], const real GeoSource[],
+                             const CylGeo_t *Geo, const int ir, const real dt_dh2[], const real dt_2,
+                             const int v0, const int v1 ) ;
 #endif // COORDINATE == CYLINDRICAL
 #endif
 
@@ -66,17 +71,40 @@ extern void HancockFluxGrad( real Flux[][NCOMP_TOTAL], real* const & dFlux, real
 #if (COORDINATE == CYLINDRICAL)
 extern void GetCoord( const double Corner[], const real dh[], const int loop_size, real x_pos[], real face_pos[][2], 
                       const int i, const int j, const int k );
-extern void GeometrySourceTerm( const real PriVar[], const real x_pos[], real GeoSource[] );
+extern void GeometrySourceTerm( const real PriVar[], const real x_pos[], const real _rad, real GeoSource[] );
+extern const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
+extern bool CPU_OrbAdv_GetVphi( const double Corner[], const real dh[], const int NGhost, const int loop_size, real Vphi[] );
+#if   ( FLU_SCHEME == MHM_RP )
+extern void CPU_OrbAdv_Con2Frame( real Con[], const real Vphi );
+extern void CPU_OrbAdv_Flux2Lab( real Flux[], const real Vphi );
+#endif
+static void CPU_InputGeoSource( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], real PriVar[][NCOMP_TOTAL],
+                                real GeoSrc_In[][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dh[],
+                                const double Corner[], const real Gamma_m1, const real MinPres, const bool NormPassive, const int NNorm,
+                                const int NormIdx[], const bool JeansMinPres, const real JeansMinPres_Coeff );
 #ifdef COOLING
-extern void CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]);
+extern void CPU_CoolingRate( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N );
 #endif
 #endif
 
+#ifdef PASSIVE_MASS_FLUX
+static void CPU_PassiveFaceValue( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], real FC_Var[][6][NCOMP_TOTAL],
+                                  const int kBeg, const int kEnd );
+#endif
+
 #if (defined SUPPORT_GRACKLE) && ((defined GRACKLE_H2_SOBOLEV) || (defined GRACKLE_H2_DISK)) && (FLU_SCHEME == MHM_RP)
 static void CPU_Find_H2_Opacity( const real Half_Var[][NCOMP_TOTAL], real Output[][ PS2*PS2*PS2 ], 
                                  const real* dh, const real* Corner ) ;
 #endif // if (defined SUPPORT_GRACKLE) && (defined GRACKLE_H2_SOBOLEV) && (FLU_SCHEME == MHM_RP)
 
+int CPU_MHM_TileDepth( const int CacheKB );
+
+
+// elapsed time (summed over all OpenMP threads) and modeled memory traffic of each stage for OPT__RECORD_FLU_BANDWIDTH
+// --> accumulated by CPU_FluidSolver_MHM() and reset by Aux_Record_FluBandwidth()
+double MHM_StageTime[MHM_NSTAGE] = { 0.0 };
+double MHM_StageByte[MHM_NSTAGE] = { 0.0 };
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -91,6 +119,14 @@ static void CPU_Find_H2_Opacity( const real Half_Var[][NCOMP_TOTAL], real Output
 //                   MHM    : "Riemann Solvers and Numerical Methods for Fluid Dynamics
 //                             - A Practical Introduction ~ by Eleuterio F. Toro"
 //                   MHM_RP : Stone & Gardiner, NewA, 14, 139 (2009)
+//                4. With PASSIVE_MASS_FLUX, passive scalars skip the data reconstruction and half-step prediction,
+//                   and are advected by the upwinded mass flux of the full-step Riemann solution
+//                   --> See CPU_PassiveFaceValue()
+//                5. Each patch group is evaluated by k-slabs of output planes to keep the working set of all stages
+//                   in cache (TileCacheKB > 0)
+//                   --> all stages are pipelined slab by slab: each stage evaluates only the planes required by the
+//                       next stage that have not been evaluated by the previous slabs
+//                   --> no plane is evaluated twice, and the results are identical to those without k-slabs
 //
 // Parameter   :  Flu_Array_In       : Array storing the input fluid variables
 //                Flu_Array_Out      : Array to store the output fluid variables
@@ -121,6 +157,10 @@ static void CPU_Find_H2_Opacity( const real Half_Var[][NCOMP_TOTAL], real Output
 //                                     --> Should be set to the global variable "PassiveNorm_VarIdx"
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                TileCacheKB        : Cache budget per OpenMP thread (in KB) for evaluating each patch group by
+//                                     k-slabs (<= 0 --> off) --> see CPU_MHM_TileDepth()
+//                TimeStage          : true --> record the elapsed time and memory traffic of each stage
+//                                              --> see Aux_Record_FluBandwidth()
 //-------------------------------------------------------------------------------------------------------
 void CPU_FluidSolver_MHM( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NXT*FLU_NXT ],
                           real Flu_Array_Out[][NCOMP_TOTAL][ PS2*PS2*PS2 ],
@@ -133,7 +173,8 @@ void CPU_FluidSolver_MHM( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
                           const real EP_Coeff, const double Time, const OptGravityType_t GravityType,
                           const double ExtAcc_AuxArray[], const real MinDens, const real MinPres,
                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                          const bool JeansMinPres, const real JeansMinPres_Coeff )
+                          const bool JeansMinPres, const real JeansMinPres_Coeff, const int TileCacheKB,
+                          const bool TimeStage )
 {
 
 // check
@@ -144,6 +185,26 @@ void CPU_FluidSolver_MHM( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
 #  endif
 
 
+// size and ghost zone of the input array of the data reconstruction
+#  if   ( FLU_SCHEME == MHM_RP )
+   const int LR_NIn    = N_HF_VAR;
+   const int LR_NGhost = FLU_GHOST_SIZE - 2;
+#  elif ( FLU_SCHEME == MHM )
+   const int LR_NIn    = FLU_NXT;
+   const int LR_NGhost = FLU_GHOST_SIZE - 1;
+#  endif
+
+// number of output planes along z evaluated by each k-slab
+   const int TileNK    = CPU_MHM_TileDepth( TileCacheKB );
+
+// modeled memory traffic per cell of each stage (see Aux_Record_FluBandwidth())
+#  if ( COORDINATE == CYLINDRICAL )
+   const int NGeo      = 1;
+#  else
+   const int NGeo      = 0;
+#  endif
+
+
 #  pragma omp parallel
    {
       const real  Gamma_m1       = Gamma - (real)1.0;
@@ -157,124 +218,249 @@ void CPU_FluidSolver_MHM( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
       real Input[NCOMP_TOTAL];
       int ID1;
 
+      Timer_t Timer[MHM_NSTAGE];
+      double  NByte[MHM_NSTAGE];
+
+      for (int s=0; s<MHM_NSTAGE; s++)    NByte[s] = 0.0;
+
 //    FC: Face-Centered variables/fluxes
       real (*FC_Var )[6][NCOMP_TOTAL] = new real [ N_FC_VAR*N_FC_VAR*N_FC_VAR    ][6][NCOMP_TOTAL];
       real (*FC_Flux)[3][NCOMP_TOTAL] = new real [ N_FC_FLUX*N_FC_FLUX*N_FC_FLUX ][3][NCOMP_TOTAL];   // also used by "Half_Flux"
       real (*PriVar)    [NCOMP_TOTAL] = new real [ FLU_NXT*FLU_NXT*FLU_NXT       ]   [NCOMP_TOTAL];   // also used by "Half_Var"
+#     if ( COORDINATE == CYLINDRICAL )
+      real (*GeoSrc_In) [NCOMP_TOTAL] = new real [ FLU_NXT*FLU_NXT*FLU_NXT       ]   [NCOMP_TOTAL];   // shared by all stages
+#     else
+      real (*GeoSrc_In) [NCOMP_TOTAL] = NULL;
+#     endif
 
+//    Half_Flux shares the memory with FC_Flux even when the patch group is evaluated by k-slabs, since the full-step
+//    flux planes written by a slab always lie below the half-step flux planes still required by the next slabs
 #     if ( FLU_SCHEME == MHM_RP )
       real (*const Half_Flux)[3][NCOMP_TOTAL] = FC_Flux;
       real (*const Half_Var)    [NCOMP_TOTAL] = PriVar;
 #     endif
 
+//    the face-centered passive scalars are not reconstructed when PASSIVE_MASS_FLUX is on
+//    --> initialize them once so that the conversions before CPU_PassiveFaceValue() never read undefined values
+#     ifdef PASSIVE_MASS_FLUX
+      for (int t=0; t<N_FC_VAR*N_FC_VAR*N_FC_VAR; t++)
+      for (int f=0; f<6; f++)
+      for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  FC_Var[t][f][v] = (real)0.0;
+#     endif
+
+
+//    time each stage and accumulate its modeled memory traffic
+#     define TIMER_START( Stage )                                                                     \
+      if ( TimeStage )  Timer[Stage].Start();
+#     define TIMER_STOP( Stage, NPlane, NCellPlane, NWord )                                           \
+      if ( TimeStage )                                                                                \
+      {                                                                                               \
+         Timer[Stage].Stop();                                                                         \
+         NByte[Stage] += (double)(NPlane)*(NCellPlane)*(NWord)*NCOMP_TOTAL*sizeof(real);              \
+      }
+
 
 //    loop over all patch groups
 #     pragma omp for schedule( runtime )
       for (int P=0; P<NPatchGroup; P++)
       {
 
-//       1. half-step prediction
-#        if ( FLU_SCHEME == MHM_RP ) // a. use Riemann solver to calculate the half-step fluxes
+//       number of planes along z already evaluated in each array
+         int Done_FC=0, Done_FL=0, Done_Out=0;
+#        if ( FLU_SCHEME == MHM_RP )
+         int Done_HF=0, Done_LR=0;
+#        endif
+#        if ( FLU_SCHEME == MHM  ||  COORDINATE == CYLINDRICAL )
+         int Done_In=0;
+#        endif
 
-//       (1.a-1) evaluate the half-step first-order fluxes by Riemann solver
-         CPU_RiemannPredict_Flux( Flu_Array_In[P], Half_Flux, Gamma, MinPres );
+//       evaluate the patch group by k-slabs of TileNK output planes
+//       --> each stage only evaluates the planes required by the next stage for the current slab and not yet
+//           evaluated for the previous slabs, so that no plane is computed twice and the results do not depend on TileNK
+//       --> TileNK == PS2 for a single slab, in which case each stage evaluates the whole patch group at once
+         for (int kTile=TileNK; kTile<PS2+TileNK; kTile+=TileNK)
+         {
+//          number of planes required in each array
+//          --> the output plane k requires the full-step flux planes <= k+1, the flux plane k requires the
+//              face-centered planes <= k+1, and the face-centered plane k requires the reconstruction input
+//              planes <= k+LR_NGhost+2 (+1 for the half-step fluxes and the input geometric source terms of MHM_RP)
+//          --> the last slab completes all arrays
+            const int kReq     = ( kTile < PS2 ) ? kTile : FLU_NXT;
+            const int Need_Out = MIN( kReq,             PS2       );
+            const int Need_FL  = MIN( kReq+1,           N_FL_FLUX );
+            const int Need_FC  = MIN( kReq+2,           N_FC_VAR  );
+            const int Need_LR  = MIN( kReq+4+LR_NGhost, LR_NIn    );
+#           if   ( FLU_SCHEME == MHM_RP )
+            const int Need_HF  = MIN( kReq+5+LR_NGhost, N_HF_FLUX );
+#           if ( COORDINATE == CYLINDRICAL )
+            const int Need_In  = MIN( kReq+5+LR_NGhost, FLU_NXT   );
+#           endif
+#           elif ( FLU_SCHEME == MHM )
+            const int Need_In  = Need_LR;
+#           endif
+
+
+//          1. half-step prediction
+#           if ( FLU_SCHEME == MHM_RP ) // a. use Riemann solver to calculate the half-step fluxes
+
+//          (1.a-0) evaluate the geometric source terms of the input data once for both the half- and full-step updates
+#           if ( COORDINATE == CYLINDRICAL )
+            TIMER_START( MHM_STAGE_INPUT );
+            CPU_InputGeoSource( Flu_Array_In[P], NULL, GeoSrc_In, Done_In, Need_In, dh, Corner_Array[P], Gamma_m1,
+                                MinPres, false, NULL_INT, NULL, false, NULL_REAL );
+            TIMER_STOP( MHM_STAGE_INPUT, Need_In-Done_In, FLU_NXT*FLU_NXT, 1+NGeo );
+#           endif
+
+
+//          (1.a-1) evaluate the half-step first-order fluxes by Riemann solver
+            TIMER_START( MHM_STAGE_HALF_FLUX );
+            CPU_RiemannPredict_Flux( Flu_Array_In[P], Half_Flux, Done_HF, Need_HF, Gamma, MinPres, Corner_Array[P], dh );
+            TIMER_STOP( MHM_STAGE_HALF_FLUX, Need_HF-Done_HF, N_HF_FLUX*N_HF_FLUX, 4 );
+
+
+//          (1.a-2) evaluate the half-step solutions
+            TIMER_START( MHM_STAGE_HALF_VAR );
+            CPU_RiemannPredict( Flu_Array_In[P], Half_Flux, Half_Var, Done_LR, Need_LR, dt, dh, Gamma, MinDens, MinPres,
+                                Corner_Array[P], GeoSrc_In );
+
+
+//          (1.a-3) conserved variables --> primitive variables
+            for (int k=Done_LR; k<Need_LR;  k++)
+            for (int j=0;       j<N_HF_VAR; j++)
+            for (int i=0;       i<N_HF_VAR; i++)
+            {
+               ID1 = (k*N_HF_VAR + j)*N_HF_VAR + i;
 
+               for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = Half_Var[ID1][v];
 
-//       (1.a-2) evaluate the half-step solutions
-         CPU_RiemannPredict( Flu_Array_In[P], Half_Flux, Half_Var, dt, dh, Gamma, MinDens, MinPres, Corner_Array[P] );
+               CPU_Con2Pri( Input, Half_Var[ID1], Gamma_m1, MinPres, NormPassive, NNorm, NormIdx,
+                            JeansMinPres, JeansMinPres_Coeff );
+            }
+            TIMER_STOP( MHM_STAGE_HALF_VAR, Need_LR-Done_LR, N_HF_VAR*N_HF_VAR, 7+NGeo );
 
 
-//       (1.a-3) conserved variables --> primitive variables
-         for (int k=0; k<N_HF_VAR; k++)
-         for (int j=0; j<N_HF_VAR; j++)
-         for (int i=0; i<N_HF_VAR; i++)
-         {
-            ID1 = (k*N_HF_VAR + j)*N_HF_VAR + i;
+//          (1.a-4) evaluate the face-centered values by data reconstruction
+            TIMER_START( MHM_STAGE_RECON );
+            CPU_DataReconstruction( Half_Var, FC_Var, LR_NIn, LR_NGhost, Done_FC, Need_FC, Gamma, LR_Limiter,
+                                    MinMod_Coeff, EP_Coeff, NULL_REAL, dh, Corner_Array[P], MinDens, MinPres );
 
-            for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = Half_Var[ID1][v];
 
-            CPU_Con2Pri( Input, Half_Var[ID1], Gamma_m1, MinPres, NormPassive, NNorm, NormIdx,
-                         JeansMinPres, JeansMinPres_Coeff );
-         }
+//          (1.a-5) primitive face-centered variables --> conserved face-centered variables
+            for (int k=Done_FC; k<Need_FC;  k++)
+            for (int j=0;       j<N_FC_VAR; j++)
+            for (int i=0;       i<N_FC_VAR; i++)
+            {
+               ID1 = (k*N_FC_VAR + j)*N_FC_VAR + i;
 
+               for (int f=0; f<6; f++)
+               {
+                  for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = FC_Var[ID1][f][v];
 
-//       (1.a-4) evaluate the face-centered values by data reconstruction
-         CPU_DataReconstruction( Half_Var, FC_Var, N_HF_VAR, FLU_GHOST_SIZE-2, Gamma, LR_Limiter,
-                                 MinMod_Coeff, EP_Coeff, NULL_REAL, dh, Corner_Array[P], MinDens, MinPres );
+                  CPU_Pri2Con( Input, FC_Var[ID1][f], _Gamma_m1, NormPassive, NNorm, NormIdx );
+               }
+            }
 
 
-//       (1.a-5) primitive face-centered variables --> conserved face-centered variables
-         for (int k=0; k<N_FC_VAR; k++)
-         for (int j=0; j<N_FC_VAR; j++)
-         for (int i=0; i<N_FC_VAR; i++)
-         {
-            ID1 = (k*N_FC_VAR + j)*N_FC_VAR + i;
+//          (1.a-6) set the face-centered passive scalars by the input mass fractions
+#           ifdef PASSIVE_MASS_FLUX
+            CPU_PassiveFaceValue( Flu_Array_In[P], FC_Var, Done_FC, Need_FC );
+#           endif
+            TIMER_STOP( MHM_STAGE_RECON, Need_FC-Done_FC, N_FC_VAR*N_FC_VAR, 19 );
+
+            Done_HF = Need_HF;
 
-            for (int f=0; f<6; f++)
+#           elif ( FLU_SCHEME == MHM ) // b. use interpolated face-centered values to calculate the half-step fluxes
+
+//          (1.b-1) conserved variables --> primitive variables
+//                  --> also evaluate the geometric source terms in the same pass for the cylindrical coordinate
+            TIMER_START( MHM_STAGE_INPUT );
+#           if ( COORDINATE == CYLINDRICAL )
+            CPU_InputGeoSource( Flu_Array_In[P], PriVar, GeoSrc_In, Done_In, Need_In, dh, Corner_Array[P], Gamma_m1,
+                                MinPres, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff );
+#           else
+            for (int k=Done_In; k<Need_In; k++)
+            for (int j=0;       j<FLU_NXT; j++)
+            for (int i=0;       i<FLU_NXT; i++)
             {
-               for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = FC_Var[ID1][f][v];
+               ID1 = (k*FLU_NXT + j)*FLU_NXT + i;
+
+               for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = Flu_Array_In[P][v][ID1];
 
-               CPU_Pri2Con( Input, FC_Var[ID1][f], _Gamma_m1, NormPassive, NNorm, NormIdx );
+               CPU_Con2Pri( Input, PriVar[ID1], Gamma_m1, MinPres, NormPassive, NNorm, NormIdx,
+                            JeansMinPres, JeansMinPres_Coeff );
             }
-         }
+#           endif
+            TIMER_STOP( MHM_STAGE_INPUT, Need_In-Done_In, FLU_NXT*FLU_NXT, 2+NGeo );
 
-#        elif ( FLU_SCHEME == MHM ) // b. use interpolated face-centered values to calculate the half-step fluxes
 
-//       (1.b-1) conserved variables --> primitive variables
-         for (int k=0; k<FLU_NXT; k++)
-         for (int j=0; j<FLU_NXT; j++)
-         for (int i=0; i<FLU_NXT; i++)
-         {
-            ID1 = (k*FLU_NXT + j)*FLU_NXT + i;
+//          (1.b-2) evaluate the face-centered values by data reconstruction
+            TIMER_START( MHM_STAGE_RECON );
+            CPU_DataReconstruction( PriVar, FC_Var, LR_NIn, LR_NGhost, Done_FC, Need_FC, Gamma, LR_Limiter,
+                                    MinMod_Coeff, EP_Coeff, NULL_REAL, dh, Corner_Array[P], MinDens, MinPres );
 
-            for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = Flu_Array_In[P][v][ID1];
 
-            CPU_Con2Pri( Input, PriVar[ID1], Gamma_m1, MinPres, NormPassive, NNorm, NormIdx,
-                         JeansMinPres, JeansMinPres_Coeff );
-         }
+//          (1.b-3) primitive face-centered variables --> conserved face-centered variables
+            for (int k=Done_FC; k<Need_FC;  k++)
+            for (int j=0;       j<N_FC_VAR; j++)
+            for (int i=0;       i<N_FC_VAR; i++)
+            {
+               ID1 = (k*N_FC_VAR + j)*N_FC_VAR + i;
 
+               for (int f=0; f<6; f++)
+               {
+                  for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = FC_Var[ID1][f][v];
 
-//       (1.b-2) evaluate the face-centered values by data reconstruction
-         CPU_DataReconstruction( PriVar, FC_Var, FLU_NXT, FLU_GHOST_SIZE-1, Gamma, LR_Limiter,
-                                 MinMod_Coeff, EP_Coeff, NULL_REAL, dh, Corner_Array[P], MinDens, MinPres );
+                  CPU_Pri2Con( Input, FC_Var[ID1][f], _Gamma_m1, NormPassive, NNorm, NormIdx );
+               }
+            }
+            TIMER_STOP( MHM_STAGE_RECON, Need_FC-Done_FC, N_FC_VAR*N_FC_VAR, 19 );
 
 
-//       (1.b-3) primitive face-centered variables --> conserved face-centered variables
-         for (int k=0; k<N_FC_VAR; k++)
-         for (int j=0; j<N_FC_VAR; j++)
-         for (int i=0; i<N_FC_VAR; i++)
-         {
-            ID1 = (k*N_FC_VAR + j)*N_FC_VAR + i;
+//          (1.b-4) evaluate the half-step solutions
+            TIMER_START( MHM_STAGE_HANCOCK );
+            CPU_HancockPredict( FC_Var, Done_FC, Need_FC, dt, dh, Gamma, Flu_Array_In[P], Corner_Array[P], GeoSrc_In,
+                                MinDens, MinPres );
 
-            for (int f=0; f<6; f++)
-            {
-               for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = FC_Var[ID1][f][v];
 
-               CPU_Pri2Con( Input, FC_Var[ID1][f], _Gamma_m1, NormPassive, NNorm, NormIdx );
-            }
-         }
+//          (1.b-5) set the face-centered passive scalars by the input mass fractions
+#           ifdef PASSIVE_MASS_FLUX
+            CPU_PassiveFaceValue( Flu_Array_In[P], FC_Var, Done_FC, Need_FC );
+#           endif
+            TIMER_STOP( MHM_STAGE_HANCOCK, Need_FC-Done_FC, N_FC_VAR*N_FC_VAR, 13+NGeo );
 
+#           endif // #if ( FLU_SCHEME == MHM_RP ) ... else ...
 
-//       (1.b-4) evaluate the half-step solutions
-         CPU_HancockPredict( FC_Var, dt, dh, Gamma, Flu_Array_In[P], Corner_Array[P], MinDens, MinPres );
 
-#        endif // #if ( FLU_SCHEME == MHM_RP ) ... else ...
+//          2. evaluate the full-step fluxes
+            TIMER_START( MHM_STAGE_FLUX );
+#           ifdef UNSPLIT_GRAVITY
+            CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, Done_FL, Need_FL, Gamma, CorrHalfVel_Yes,
+                             Pot_Array_USG[P][0][0], Corner_Array[P], dt, dh, Time, GravityType, ExtAcc_AuxArray, MinPres );
+#           else
+            CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, Done_FL, Need_FL, Gamma, CorrHalfVel_No,  NULL,
+                             Corner_Array[P], NULL_REAL, dh, NULL_REAL, GRAVITY_NONE, NULL, MinPres );
+#           endif
+            TIMER_STOP( MHM_STAGE_FLUX, Need_FL-Done_FL, N_FL_FLUX*N_FL_FLUX, 9 );
 
 
-//       2. evaluate the full-step fluxes
-#        ifdef UNSPLIT_GRAVITY
-         CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, Gamma, CorrHalfVel_Yes, Pot_Array_USG[P][0][0], Corner_Array[P],
-                          dt, dh, Time, GravityType, ExtAcc_AuxArray, MinPres );
-#        else
-         CPU_ComputeFlux( FC_Var, FC_Flux, N_FL_FLUX, 1, Gamma, CorrHalfVel_No,  NULL, Corner_Array[P],
-                          NULL_REAL, dh, NULL_REAL, GRAVITY_NONE, NULL, MinPres );
-#        endif
+//          3. full-step evolution
+            TIMER_START( MHM_STAGE_UPDATE );
+            CPU_FullStepUpdate( Flu_Array_In[P], Flu_Array_Out[P], DE_Array_Out[P], FC_Flux, Done_Out, Need_Out,
+                                dt, dh, Corner_Array[P], GeoSrc_In, Gamma, MinDens, MinPres, DualEnergySwitch,
+                                NormPassive, NNorm, NormIdx );
+            TIMER_STOP( MHM_STAGE_UPDATE, Need_Out-Done_Out, PS2*PS2, 5+NGeo );
 
 
-//       3. full-step evolution
-         CPU_FullStepUpdate( Flu_Array_In[P], Flu_Array_Out[P], DE_Array_Out[P],
-                             FC_Flux, dt, dh, Corner_Array[P], Gamma, MinDens, MinPres, DualEnergySwitch,
-                             NormPassive, NNorm, NormIdx );
+#           if ( FLU_SCHEME == MHM  ||  COORDINATE == CYLINDRICAL )
+            Done_In  = Need_In;
+#           endif
+#           if ( FLU_SCHEME == MHM_RP )
+            Done_LR  = Need_LR;
+#           endif
+            Done_FC  = Need_FC;
+            Done_FL  = Need_FL;
+            Done_Out = Need_Out;
+         } // for (int kTile=TileNK; kTile<PS2+TileNK; kTile+=TileNK)
 
 
 //       4. store the inter-patch fluxes
@@ -289,9 +475,25 @@ void CPU_FluidSolver_MHM( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
 
       } // for (int P=0; P<NPatchGroup; P++)
 
+#     undef TIMER_START
+#     undef TIMER_STOP
+
+
+//    accumulate the stage timing of all threads
+      if ( TimeStage )
+      {
+#        pragma omp critical
+         for (int s=0; s<MHM_NSTAGE; s++)
+         {
+            MHM_StageTime[s] += Timer[s].GetValue();
+            MHM_StageByte[s] += NByte[s];
+         }
+      }
+
       delete [] FC_Var;
       delete [] FC_Flux;
       delete [] PriVar;
+      delete [] GeoSrc_In;
 
    } // OpenMP parallel region
 
@@ -306,21 +508,33 @@ void CPU_FluidSolver_MHM( const real Flu_Array_In[][NCOMP_TOTAL][ FLU_NXT*FLU_NX
 //
 // Note        :  1. Work for the MUSCL-Hancock method + Riemann-prediction (MHM_RP)
 //                2. Currently support the exact, Roe, HLLE, and HLLC solvers
+//                3. For OPT__ORBITAL_ADV, the phi fluxes are evaluated in the frame moving with OrbAdv_Vphi
+//                   (see CPU_ComputeFlux)
 //
 // Parameter   :  Flu_Array_In : Array storing the input conserved variables
 //                Half_Flux    : Array to store the output face-centered fluxes
 //                               --> The size is assumed to be N_HF_FLUX^3
+//                kBeg/kEnd    : Only evaluate the flux planes kBeg <= k < kEnd
+//                               --> The flux plane k requires the input planes k and k+1
 //                Gamma        : Ratio of specific heats
 //                MinPres      : Minimum allowed pressure
+//                Corner       : Physical coordinates of the patch group corner (for OPT__ORBITAL_ADV only)
+//                dh           : Grid size                                      (for OPT__ORBITAL_ADV only)
 //-------------------------------------------------------------------------------------------------------
 void CPU_RiemannPredict_Flux( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Half_Flux[][3][NCOMP_TOTAL],
-                              const real Gamma, const real MinPres )
+                              const int kBeg, const int kEnd, const real Gamma, const real MinPres,
+                              const double Corner[], const real dh[] )
 {
 
    const int dr[3] = { 1, FLU_NXT, FLU_NXT*FLU_NXT };
    int ID1, ID2, dN[3]={ 0 };
    real ConVar_L[NCOMP_TOTAL], ConVar_R[NCOMP_TOTAL];
 
+#  if ( COORDINATE == CYLINDRICAL )
+   real Vphi[ SQR(FLU_NXT) ];
+   const bool OrbAdv = CPU_OrbAdv_GetVphi( Corner, dh, FLU_GHOST_SIZE, FLU_NXT, Vphi );
+#  endif
+
 #  if ( RSOLVER == EXACT )
    const real Gamma_m1 = Gamma - (real)1.0;
    real PriVar_L[NCOMP_TOTAL], PriVar_R[NCOMP_TOTAL];
@@ -337,9 +551,9 @@ void CPU_RiemannPredict_Flux( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT
          case 2 : dN[0] = 1;  dN[1] = 1;  dN[2] = 0;  break;
       }
 
-      for (int k1=0, k2=dN[2];  k1<N_HF_FLUX-dN[2];  k1++, k2++)
-      for (int j1=0, j2=dN[1];  j1<N_HF_FLUX-dN[1];  j1++, j2++)
-      for (int i1=0, i2=dN[0];  i1<N_HF_FLUX-dN[0];  i1++, i2++)
+      for (int k1=kBeg, k2=dN[2]+kBeg;  k1<MIN(kEnd,N_HF_FLUX-dN[2]);  k1++, k2++)
+      for (int j1=0,    j2=dN[1];       j1<N_HF_FLUX-dN[1];            j1++, j2++)
+      for (int i1=0,    i2=dN[0];       i1<N_HF_FLUX-dN[0];            i1++, i2++)
       {
          ID1 = (k1*N_HF_FLUX + j1)*N_HF_FLUX + i1;
          ID2 = (k2*FLU_NXT   + j2)*FLU_NXT   + i2;
@@ -351,6 +565,14 @@ void CPU_RiemannPredict_Flux( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT
             ConVar_R[v] = Flu_Array_In[v][ ID2+dr[d] ];
          }
 
+#        if ( COORDINATE == CYLINDRICAL )
+         if ( OrbAdv  &&  d == 1 )
+         {
+            CPU_OrbAdv_Con2Frame( ConVar_L, Vphi[ k2*FLU_NXT + i2 ] );
+            CPU_OrbAdv_Con2Frame( ConVar_R, Vphi[ k2*FLU_NXT + i2 ] );
+         }
+#        endif
+
 //       invoke the Riemann solver
 #        if   ( RSOLVER == EXACT )
          const bool NormPassive_No  = false;  // do NOT convert any passive variable to mass fraction for the Riemann solvers
@@ -368,6 +590,10 @@ void CPU_RiemannPredict_Flux( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT
          CPU_RiemannSolver_HLLC( d, Half_Flux[ID1][d], ConVar_L, ConVar_R, Gamma, MinPres );
 #        else
 #        error : ERROR : unsupported Riemann solver (EXACT/ROE) !!
+#        endif
+
+#        if ( COORDINATE == CYLINDRICAL )
+         if ( OrbAdv  &&  d == 1 )  CPU_OrbAdv_Flux2Lab( Half_Flux[ID1][d], Vphi[ k2*FLU_NXT + i2 ] );
 #        endif
       }
    } // for (int d=0; d<3; d++)
@@ -387,14 +613,20 @@ void CPU_RiemannPredict_Flux( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT
 //                               --> The size is assumed to be N_HF_FLUX^3
 //                Half_Var     : Array to store the output conserved variables
 //                               --> The size is assumed to be N_HF_VAR^3
+//                kBeg/kEnd    : Only evaluate the planes kBeg <= k < kEnd of Half_Var
+//                               --> The plane k requires the planes <= k+1 of Half_Flux and GeoSrc_In
 //                dt           : Time interval to advance solution
 //                dh           : Grid size
 //                Gamma        : Ratio of specific heats
 //                MinDens/Pres : Minimum allowed density and pressure
+//                Corner       : Physical coordinates of the patch group corner
+//                GeoSrc_In    : Geometric source terms of Flu_Array_In evaluated by CPU_InputGeoSource()
+//                               --> Useful only for the cylindrical coordinate
 //-------------------------------------------------------------------------------------------------------
 void CPU_RiemannPredict( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], const real Half_Flux[][3][NCOMP_TOTAL],
-                         real Half_Var[][NCOMP_TOTAL], const real dt, const real dh[], const real Gamma,
-                         const real MinDens, const real MinPres, const double Corner[] )
+                         real Half_Var[][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dt, const real dh[],
+                         const real Gamma, const real MinDens, const real MinPres, const double Corner[],
+                         const real GeoSrc_In[][NCOMP_TOTAL] )
 {
 
    const int  dID3[3]   = { 1, N_HF_FLUX, N_HF_FLUX*N_HF_FLUX };
@@ -407,55 +639,75 @@ void CPU_RiemannPredict( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], c
    int ID1, ID2, ID3;
    
 #  if (COORDINATE == CYLINDRICAL)
-   real x_pos[3], face_pos[1][2], GeoSource[NCOMP_TOTAL], PriVar[NCOMP_TOTAL], ConVar[NCOMP_TOTAL] ; 
+   int  ir0;
+   const CylGeo_t *Geo = CylGeo_Lookup( Corner, dh, FLU_NXT, ir0 );
 #  ifdef COOLING
-   real cool_rate;
+   const bool CheckMinPres_Yes = true;
+   const bool CoolInStage      = !OPT__COOL_SUBCYCLE;   // otherwise cooling is operator split (see Hydro_Cooling_AdvanceDt())
+   real Dens_1D[N_HF_VAR], Pres_1D[N_HF_VAR], CoolRate_1D[N_HF_VAR];
 #  endif
 #  endif
 
 
-   for (int k1=0, k2=1;  k1<N_HF_VAR;  k1++, k2++)
-   for (int j1=0, j2=1;  j1<N_HF_VAR;  j1++, j2++)
-   for (int i1=0, i2=1;  i1<N_HF_VAR;  i1++, i2++)
+   for (int k1=kBeg, k2=kBeg+1;  k1<MIN(kEnd,N_HF_VAR);  k1++, k2++)
+   for (int j1=0,    j2=1;       j1<N_HF_VAR;            j1++, j2++)
+   for (int i1=0,    i2=1;       i1<N_HF_VAR;            i1++, i2++)
    {
       ID1 = (k1*N_HF_VAR  + j1)*N_HF_VAR  + i1;
       ID2 = (k2*FLU_NXT   + j2)*FLU_NXT   + i2;
       ID3 = (k1*N_HF_FLUX + j1)*N_HF_FLUX + i1;
       
 #if   (COORDINATE == CYLINDRICAL)
-      const bool NormPassive_No  = false; 
-      const bool JeansMinPres_No = false;
-      
-      GetCoord( Corner, dh, FLU_NXT, x_pos, face_pos, i2, j2, k2);
-      for ( int v=0; v<NCOMP_TOTAL; v++ ) ConVar[v] = Flu_Array_In[v][ID2] ;
-      CPU_Con2Pri( ConVar, PriVar, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-      GeometrySourceTerm( PriVar, x_pos, GeoSource );
+      const int  ir              = ir0 + i2;
+      const real *GeoSource      = GeoSrc_In[ID2];
 #endif
       
 #     ifdef COOLING
-      // ### currently cooling only work for cylindrical coord
-      CoolingFunc(&cool_rate, PriVar, x_pos);
+//    evaluate the cooling rates of the whole i-pencil at once
+      if ( CoolInStage  &&  i1 == 0 )
+      {
+         for (int i=0; i<N_HF_VAR; i++)
+         {
+            const int ID = ID2 + i;
+
+            Dens_1D[i] = Flu_Array_In[DENS][ID];
+            Pres_1D[i] = CPU_GetPressure( Flu_Array_In[DENS][ID], Flu_Array_In[MOMX][ID], Flu_Array_In[MOMY][ID],
+                                          Flu_Array_In[MOMZ][ID], Flu_Array_In[ENGY][ID], Gamma_m1, CheckMinPres_Yes,
+                                          MinPres );
+         }
+
+         CPU_CoolingRate( CoolRate_1D, Dens_1D, Pres_1D, Geo->r_m32+ir, N_HF_VAR );
+      }
 #     endif
 
       for (int d=0; d<3; d++) {
-      for (int v=0; v<NCOMP_TOTAL; v++) {    
 #        if (COORDINATE == CARTESIAN)
+         for (int v=0; v<NCOMP_PRED; v++)
          dF[d][v] = Half_Flux[ ID3+dID3[d] ][d][v] - Half_Flux[ID3][d][v];
 #        elif (COORDINATE == CYLINDRICAL)
-         RiemannFluxGrad(Half_Flux[ ID3+dID3[d] ][d][v], Half_Flux[ID3][d][v], &(dF[d][v]), d, v, x_pos, face_pos) ;
+#        define RIEMANN_FLUX_GRAD( Class, v0, v1 )                                                   \
+         RiemannFluxGrad<Class>( Half_Flux[ ID3+dID3[d] ][d], Half_Flux[ID3][d], dF[d], d, Geo, ir,   \
+                                 v0, MIN(v1,NCOMP_PRED) );
+
+         FOR_EACH_COMP_CLASS( RIEMANN_FLUX_GRAD )
+#        undef RIEMANN_FLUX_GRAD
 #        endif
-         
-      }}
+      }
 
-      for (int v=0; v<NCOMP_TOTAL; v++) {
+      for (int v=0; v<NCOMP_PRED; v++) {
          Half_Var[ID1][v] = Flu_Array_In[v][ID2] - ( dF[0][v]*dt_dh2[0] + dF[1][v]*dt_dh2[1] + dF[2][v]*dt_dh2[2] );
 #        if (COORDINATE == CYLINDRICAL)
          Half_Var[ID1][v] += GeoSource[v]*dt_2 ;
 #        endif
       }
+
+//    passive scalars are not predicted when PASSIVE_MASS_FLUX is on (see CPU_PassiveFaceValue())
+#     ifdef PASSIVE_MASS_FLUX
+      for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)   Half_Var[ID1][v] = Flu_Array_In[v][ID2];
+#     endif
       
 #     ifdef COOLING
-      Half_Var[ID1][ENGY] -= cool_rate * dt_2 ;
+      if ( CoolInStage )   Half_Var[ID1][ENGY] -= CoolRate_1D[i1] * dt_2 ;
 #     endif
 
 //    ensure positive density and pressure
@@ -474,33 +726,40 @@ void CPU_RiemannPredict( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], c
 #if (COORDINATE == CYLINDRICAL)
 //-------------------------------------------------------------------------------------------------------
 // Function    :  RiemannFluxGrad
-// Description :  get transverse flux gradient and source term for one cell 
+// Description :  get flux gradient of the components [v0, v1) of class Class for one cell 
 //
-// Parameter   :  Flux         : 
-//                dF           : 
-//                GeoSource    :
-//                x_pos        : xyz position of the cell
-//                face_pos     : xyz position of cell faces
-//                v            : from 0 - (NCOMP_TOTAL-1)
+// Parameter   :  Flux_R/L     : right/left face fluxes of the cell in the direction d
+//                dF           : output flux gradient
+//                d            : spatial direction (0/1/2 --> r/phi/z)
+//                Geo          : radial geometry table of this level (see CylGeo_Lookup)
+//                ir           : table index of the cell
+//                v0/v1        : range of the components (see FOR_EACH_COMP_CLASS)
 //
-// NOTE        :  could extend to all coordinate, but be careful of face_pos[][]
+// NOTE        :  1. the azimuthal momentum (COMP_MOMPHI) is weighted by the squared face ratios along r, which
+//                   is resolved at compile time
+//                2. the radial difference is converted from per dh to per dr by dh_dr (see OPT__CYL_RGRID)
 //-------------------------------------------------------------------------------------------------------
-void RiemannFluxGrad( const real Flux_R, const real Flux_L, real* const & dF, const int d, const int v,
-                      const real* x_pos, const real face_pos[][2] ) {
-   
-   const real _x1    = (real)1.0/ x_pos[0];
-   const real _x1_sq = SQR(_x1) ;
+template <int Class>
+void RiemannFluxGrad( const real Flux_R[], const real Flux_L[], real dF[], const int d,
+                      const CylGeo_t *Geo, const int ir, const int v0, const int v1 ) {
    
-   if ( v == MOMY ) {
-      if      ( d==0 ) *dF = (SQR(face_pos[0][1])*Flux_R - SQR(face_pos[0][0])*Flux_L) * _x1_sq ;
-      else if ( d==1 ) *dF = (Flux_R - Flux_L) * _x1 ;
-      else if ( d==2 ) *dF = Flux_R - Flux_L ; ;
-   }  
-   else {
-      if      ( d==0 ) *dF = (face_pos[0][1]*Flux_R - face_pos[0][0]*Flux_L) * _x1 ;
-      else if ( d==1 ) *dF = (Flux_R - Flux_L) * _x1 ;
-      else if ( d==2 ) *dF = Flux_R - Flux_L ; ;
-   }   
+   const bool AngMom = ( Class == COMP_MOMPHI );
+
+   switch ( d ) {
+      case 0 : {
+         const real fR = ( AngMom ) ? Geo->rR2_r2[ir] : Geo->rR_r[ir];
+         const real fL = ( AngMom ) ? Geo->rL2_r2[ir] : Geo->rL_r[ir];
+         for (int v=v0; v<v1; v++)  dF[v] = ( fR*Flux_R[v] - fL*Flux_L[v] ) * Geo->dh_dr[ir] ;
+      } break;
+
+      case 1 :
+         for (int v=v0; v<v1; v++)  dF[v] = (Flux_R[v] - Flux_L[v]) * Geo->_r[ir] ;
+         break;
+
+      case 2 :
+         for (int v=v0; v<v1; v++)  dF[v] = Flux_R[v] - Flux_L[v] ;
+         break;
+   }
    
 } // FUNCTION: RiemannFluxGrad
 
@@ -591,8 +850,9 @@ void CPU_Find_H2_Opacity( const real Half_Var[][NCOMP_TOTAL], real Output[][ PS2
       ID_kL = ((k2-1)*N_HF_VAR   + j2)*N_HF_VAR + i2 ;
       ID_kR = ((k2+1)*N_HF_VAR   + j2)*N_HF_VAR + i2 ;
       
-      // calculate velocity gradient
-      dvx_dx = (Half_Var[ID_iR][MOMX] - Half_Var[ID_iL][MOMX]) * (0.5*_dh[0]);
+      // calculate velocity gradient; the radial one is per dr of the mapped radial grid (OPT__CYL_RGRID)
+      const real _dr = ( OPT__CYL_RGRID == CYL_RGRID_UNIFORM ) ? _dh[0] : (real)1.0/( face_pos[0][1] - face_pos[0][0] );
+      dvx_dx = (Half_Var[ID_iR][MOMX] - Half_Var[ID_iL][MOMX]) * (0.5*_dr);
       dvy_dy = (Half_Var[ID_jR][MOMY] - Half_Var[ID_jL][MOMY]) * (0.5*_dh[1]) / x_pos[0];
       dvz_dz = (Half_Var[ID_kR][MOMZ] - Half_Var[ID_kL][MOMZ]) * (0.5*_dh[2]);
       
@@ -717,19 +977,25 @@ void CPU_Find_H2_Opacity( const real Half_Var[][NCOMP_TOTAL], real Output[][ PS2
 //
 // Note        :  1. Work for the MHM scheme
 //                2. Do NOT require data in the neighboring cells
+//                3. For OPT__ORBITAL_ADV, the advection by OrbAdv_Vphi is removed from the phi fluxes
 //
 // Parameter   :  FC_Var       : Face-centered conserved variables
 //                               --> The size is assumed to be N_FC_VAR^3
+//                kBeg/kEnd    : Only evaluate the planes kBeg <= k < kEnd of FC_Var
 //                dt           : Time interval to advance solution
 //                dh           : Grid size
 //                Gamma        : Ratio of specific heats
 //                C_Var        : Array storing the conservative variables
 //                               --> For checking negative density and pressure
+//                Corner       : Physical coordinates of the patch group corner
+//                GeoSrc_In    : Geometric source terms of C_Var evaluated by CPU_InputGeoSource()
+//                               --> Useful only for the cylindrical coordinate
 //                MinDens/Pres : Minimum allowed density and pressure
 //-------------------------------------------------------------------------------------------------------
-void CPU_HancockPredict( real FC_Var[][6][NCOMP_TOTAL], const real dt, const real dh[], const real Gamma,
-                         const real C_Var[][ FLU_NXT*FLU_NXT*FLU_NXT ], const double Corner[], 
-                         const real MinDens, const real MinPres )
+void CPU_HancockPredict( real FC_Var[][6][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dt,
+                         const real dh[], const real Gamma, const real C_Var[][ FLU_NXT*FLU_NXT*FLU_NXT ],
+                         const double Corner[], const real GeoSrc_In[][NCOMP_TOTAL], const real MinDens,
+                         const real MinPres )
 {
 
    const real  Gamma_m1 = Gamma - (real)1.0;
@@ -742,41 +1008,52 @@ void CPU_HancockPredict( real FC_Var[][6][NCOMP_TOTAL], const real dt, const rea
    int ID1, ID2;
    
 #if (COORDINATE == CYLINDRICAL)
-   real x_pos[3], face_pos[1][2], GeoSource[NCOMP_TOTAL], PriVar[NCOMP_TOTAL], ConVar[NCOMP_TOTAL] ; 
-   real dF[3][NCOMP_TOTAL]; // ### don't need anymore
+   int  ir0;
+   const CylGeo_t *Geo = CylGeo_Lookup( Corner, dh, FLU_NXT, ir0 );
+
+   real Vphi[ SQR(FLU_NXT) ];
+   const bool OrbAdv = CPU_OrbAdv_GetVphi( Corner, dh, FLU_GHOST_SIZE, FLU_NXT, Vphi );
 #endif
 
 
-   for (int k1=0, k2=NGhost;  k1<N_FC_VAR;  k1++, k2++)
-   for (int j1=0, j2=NGhost;  j1<N_FC_VAR;  j1++, j2++)
-   for (int i1=0, i2=NGhost;  i1<N_FC_VAR;  i1++, i2++)
+   for (int k1=kBeg, k2=NGhost+kBeg;  k1<MIN(kEnd,N_FC_VAR);  k1++, k2++)
+   for (int j1=0,    j2=NGhost;       j1<N_FC_VAR;            j1++, j2++)
+   for (int i1=0,    i2=NGhost;       i1<N_FC_VAR;            i1++, i2++)
    {
       ID1 = (k1*N_FC_VAR + j1)*N_FC_VAR + i1;
       ID2 = (k2*FLU_NXT  + j2)*FLU_NXT  + i2;
       
 #if   (COORDINATE == CYLINDRICAL)
-      const bool NormPassive_No  = false; 
-      const bool JeansMinPres_No = false;
-      
-      GetCoord( Corner, dh, FLU_NXT, x_pos, face_pos, i2, j2, k2);
-      for ( int v=0; v<NCOMP_TOTAL; v++ ) ConVar[v] = C_Var[v][ID2] ;
-      CPU_Con2Pri( ConVar, PriVar, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-      GeometrySourceTerm( PriVar, x_pos, GeoSource );
+      const int  ir              = ir0 + i2;
+      const real *GeoSource      = GeoSrc_In[ID2];
 #endif
 
       for (int f=0; f<6; f++)    CPU_Con2Flux( f/2, Flux[f], FC_Var[ID1][f], Gamma_m1, MinPres );
 
-      for (int v=0; v<NCOMP_TOTAL; v++)
+#if   (COORDINATE == CYLINDRICAL)
+      if ( OrbAdv )
       {
-#if      (COORDINATE == CARTESIAN)
+         const real W = Vphi[ k2*FLU_NXT + i2 ];
+
+         for (int f=2; f<4; f++)
+         for (int v=0; v<NCOMP_TOTAL; v++)   Flux[f][v] -= W*FC_Var[ID1][f][v];
+      }
+#endif
+
+#if   (COORDINATE == CARTESIAN)
+      for (int v=0; v<NCOMP_PRED; v++)
          dFlux[v] = (Flux[1][v] - Flux[0][v])*dt_dh2[0] + (Flux[3][v] - Flux[2][v])*dt_dh2[1]
                   + (Flux[5][v] - Flux[4][v])*dt_dh2[2] ;
-#elif    (COORDINATE == CYLINDRICAL)
-         HancockFluxGrad( Flux, &dFlux[v], GeoSource, x_pos, face_pos, v, dt_dh2, dt_2 );
+#elif (COORDINATE == CYLINDRICAL)
+#     define HANCOCK_FLUX_GRAD( Class, v0, v1 )                                                      \
+      HancockFluxGrad<Class>( Flux, dFlux, GeoSource, Geo, ir, dt_dh2, dt_2, v0, MIN(v1,NCOMP_PRED) );
+
+      FOR_EACH_COMP_CLASS( HANCOCK_FLUX_GRAD )
+#     undef HANCOCK_FLUX_GRAD
 #endif // (COORDINATE...)
 
-         for (int f=0; f<6; f++)    FC_Var[ID1][f][v] -= dFlux[v];
-      }
+      for (int v=0; v<NCOMP_PRED; v++)
+      for (int f=0; f<6; f++)    FC_Var[ID1][f][v] -= dFlux[v];
 
 //    check the negative density and energy
       for (int f=0; f<6; f++)
@@ -813,47 +1090,230 @@ void CPU_HancockPredict( real FC_Var[][6][NCOMP_TOTAL], const real dt, const rea
 #if (COORDINATE == CYLINDRICAL)
 //-------------------------------------------------------------------------------------------------------
 // Function    :  HancockFluxGrad
-// Description :  get transverse flux gradient and source term for one cell 
+// Description :  get flux gradient and source term of the components [v0, v1) of class Class for one cell 
 //
-// Parameter   :  Flux         : 
-//                dF           : 
-//                GeoSource    :
-//                x_pos        : xyz position of the cell
-//                face_pos     : xyz position of cell faces
-//                v            : from 0 - (NCOMP_TOTAL-1)
+// Parameter   :  Flux         : face fluxes of the cell
+//                dFlux        : output flux gradient minus source term, multiplied by the time-step
+//                GeoSource    : geometric source terms of the cell
+//                Geo          : radial geometry table of this level (see CylGeo_Lookup)
+//                ir           : table index of the cell
+//                dt_dh2       : 0.5*dt/dh
+//                dt_2         : 0.5*dt
+//                v0/v1        : range of the components (see FOR_EACH_COMP_CLASS)
 //
-// NOTE        :  could extend to all coordinate, but be careful of face_pos[][]
+// NOTE        :  1. the azimuthal momentum (COMP_MOMPHI) is weighted by the squared face ratios along r, which
+//                   is resolved at compile time
+//                2. the radial difference is converted from per dh to per dr by dh_dr (see OPT__CYL_RGRID)
 //-------------------------------------------------------------------------------------------------------
-void HancockFluxGrad( real Flux[][NCOMP_TOTAL], real* const & dFlux, real* GeoSource,
-                      const real* x_pos, const real face_pos[][2], const int v, 
-                      const real* dt_dh2, const real dt_2 ) {
+template <int Class>
+void HancockFluxGrad( const real Flux[][NCOMP_TOTAL], real dFlux[], const real GeoSource[],
+                      const CylGeo_t *Geo, const int ir, const real dt_dh2[], const real dt_2,
+                      const int v0, const int v1 ) {
    
-   const real _x1    = (real)1.0/ x_pos[0];
-   const real _x1_sq = SQR(_x1) ;
-   real dF[3][NCOMP_TOTAL];
+   const bool AngMom = ( Class == COMP_MOMPHI );
+   const real _x1    = Geo->_r[ir];
+   const real fR     = ( AngMom ) ? Geo->rR2_r2[ir]*Geo->dh_dr[ir] : Geo->rR_r[ir]*Geo->dh_dr[ir];
+   const real fL     = ( AngMom ) ? Geo->rL2_r2[ir]*Geo->dh_dr[ir] : Geo->rL_r[ir]*Geo->dh_dr[ir];
    
-   // 1. calculate flux
-   if ( v == MOMY ) {
-      dF[0][v] = (SQR(face_pos[0][1])*Flux[1][v] - SQR(face_pos[0][0])*Flux[0][v]) * _x1_sq ;
-      dF[1][v] = (Flux[3][v] - Flux[2][v]) * _x1 ;
-      dF[2][v] = Flux[5][v] - Flux[4][v] ;
-   }  
-   else {
-      dF[0][v] = (face_pos[0][1]*Flux[1][v] - face_pos[0][0]*Flux[0][v]) * _x1 ;
-      dF[1][v] = (Flux[3][v] - Flux[2][v]) * _x1 ;
-      dF[2][v] = Flux[5][v] - Flux[4][v] ;
+   for (int v=v0; v<v1; v++) {
+      // 1. calculate flux
+      const real dF0 = fR*Flux[1][v] - fL*Flux[0][v] ;
+      const real dF1 = (Flux[3][v] - Flux[2][v]) * _x1 ;
+      const real dF2 = Flux[5][v] - Flux[4][v] ;
+      
+      dFlux[v] = dF0*dt_dh2[0] + dF1*dt_dh2[1] + dF2*dt_dh2[2] ;
+      
+      // 2. add geosource term
+      dFlux[v] -= GeoSource[v] * dt_2;
    }
    
-   *dFlux = dF[0][v]*dt_dh2[0] + dF[1][v]*dt_dh2[1] + dF[2][v]*dt_dh2[2] ;
-   
-   // 2. add geosource term
-   *dFlux -= GeoSource[v] * dt_2;
-   
-}
+} // FUNCTION: HancockFluxGrad
 #endif // #id (COORDINATE == CYLINDRICAL)
 
 #endif // #if ( FLU_SCHEME == MHM )
 
 
 
+#if ( COORDINATE == CYLINDRICAL )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_InputGeoSource
+// Description :  Evaluate the geometric source terms of the input conserved variables of a patch group
+//
+// Note        :  1. Performed once per patch group, and the results are shared by the half-step prediction
+//                   (CPU_RiemannPredict/CPU_HancockPredict) and the full-step update (CPU_FullStepUpdate)
+//                   --> each stage used to convert the same input cells to the primitive variables by itself
+//                2. For MHM, the primitive variables are also stored in PriVar[] for the data reconstruction
+//                   --> the source terms are always evaluated without JeansMinPres and NormPassive, while PriVar[]
+//                       adopts them, so each input cell is converted twice only when either option is on
+//                3. For MHM_RP, set PriVar == NULL
+//
+// Parameter   :  Flu_Array_In       : Array storing the input conserved variables
+//                PriVar             : Array to store the output primitive variables (NULL --> not stored)
+//                GeoSrc_In          : Array to store the output geometric source terms
+//                kBeg/kEnd          : Only evaluate the planes kBeg <= k < kEnd of the input array
+//                dh                 : Grid size
+//                Corner             : Physical coordinates of the patch group corner
+//                Gamma_m1           : Gamma - 1
+//                MinPres            : Minimum allowed pressure
+//                NormPassive        : true --> convert passive scalars to mass fraction
+//                NNorm              : Number of passive scalars to be normalized
+//                NormIdx            : Target variable indices to be normalized
+//                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
+//                JeansMinPres_Coeff : Coefficient used by JeansMinPres
+//-------------------------------------------------------------------------------------------------------
+void CPU_InputGeoSource( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], real PriVar[][NCOMP_TOTAL],
+                         real GeoSrc_In[][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dh[],
+                         const double Corner[], const real Gamma_m1, const real MinPres, const bool NormPassive, const int NNorm,
+                         const int NormIdx[], const bool JeansMinPres, const real JeansMinPres_Coeff )
+{
+
+   const bool NormPassive_No  = false;
+   const bool JeansMinPres_No = false;
+   const bool SamePri         = ( !NormPassive  &&  !JeansMinPres );
+
+   int  ir0, ID1;
+   real Input[NCOMP_TOTAL], Buffer[NCOMP_TOTAL];
+
+   const CylGeo_t *Geo = CylGeo_Lookup( Corner, dh, FLU_NXT, ir0 );
+
+
+   for (int k=kBeg; k<MIN(kEnd,FLU_NXT); k++)
+   for (int j=0;    j<FLU_NXT;           j++)
+   for (int i=0;    i<FLU_NXT;           i++)
+   {
+      ID1 = (k*FLU_NXT + j)*FLU_NXT + i;
+
+      real *Pri = ( PriVar != NULL  &&  SamePri ) ? PriVar[ID1] : Buffer;
+
+      for (int v=0; v<NCOMP_TOTAL; v++)   Input[v] = Flu_Array_In[v][ID1];
+
+//    source terms adopt the raw input state
+      CPU_Con2Pri( Input, Pri, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
+
+//    x_pos is not used by the cylindrical source terms
+      GeometrySourceTerm( Pri, NULL, Geo->_r[ ir0+i ], GeoSrc_In[ID1] );
+
+//    data reconstruction adopts NormPassive and JeansMinPres
+      if ( PriVar != NULL  &&  !SamePri )
+         CPU_Con2Pri( Input, PriVar[ID1], Gamma_m1, MinPres, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff );
+   }
+
+} // FUNCTION : CPU_InputGeoSource
+#endif // #if ( COORDINATE == CYLINDRICAL )
+
+
+
+#ifdef PASSIVE_MASS_FLUX
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_PassiveFaceValue
+// Description :  Set the face-centered passive scalars for the full-step Riemann solver
+//
+// Note        :  1. Invoked when PASSIVE_MASS_FLUX is on, in which case the data reconstruction and half-step
+//                   prediction only evolve the first NCOMP_PRED (== NCOMP_FLUID) components
+//                2. The face-centered mass fractions are reconstructed from the input cell-centered mass fractions
+//                   by the minmod limiter, and then multiplied by the predicted face-centered density
+//                   --> all Riemann solvers evaluate the passive fluxes as the upwinded mass flux times the
+//                       face-centered mass fraction, so the passive scalars are advected consistently with the
+//                       mass flux of the full-step Riemann solution
+//                   --> the mass fractions are bounded by the neighboring cell-centered values
+//                3. The passive scalars are not advanced by half time-step, and the minmod slopes ignore the
+//                   curvilinear volume corrections of CPU_DataReconstruction()
+//                4. The input fluid variables must be the conserved variables, and FC_Var[] must store the
+//                   predicted conserved variables
+//
+// Parameter   :  Flu_Array_In : Array storing the input conserved variables
+//                FC_Var       : Array storing the face-centered conserved variables
+//                               --> The passive scalars are overwritten
+//                kBeg/kEnd    : Only evaluate the planes kBeg <= k < kEnd of FC_Var
+//-------------------------------------------------------------------------------------------------------
+void CPU_PassiveFaceValue( const real Flu_Array_In[][ FLU_NXT*FLU_NXT*FLU_NXT ], real FC_Var[][6][NCOMP_TOTAL],
+                           const int kBeg, const int kEnd )
+{
+
+#  if ( NCOMP_PASSIVE > 0 )
+   const int NGhost = FLU_GHOST_SIZE - 1;
+   const int dr[3]  = { 1, FLU_NXT, FLU_NXT*FLU_NXT };
+
+   int ID1, ID2;
+
+   for (int k1=kBeg, k2=NGhost+kBeg;  k1<MIN(kEnd,N_FC_VAR);  k1++, k2++)
+   for (int j1=0,    j2=NGhost;       j1<N_FC_VAR;            j1++, j2++)
+   for (int i1=0,    i2=NGhost;       i1<N_FC_VAR;            i1++, i2++)
+   {
+      ID1 = (k1*N_FC_VAR + j1)*N_FC_VAR + i1;
+      ID2 = (k2*FLU_NXT  + j2)*FLU_NXT  + i2;
+
+      const real _Rho_C = (real)1.0 / Flu_Array_In[DENS][ID2];
+
+      for (int d=0; d<3; d++)
+      {
+         const int  dL     = 2*d;
+         const int  dR     = dL+1;
+         const real _Rho_L = (real)1.0 / Flu_Array_In[DENS][ ID2-dr[d] ];
+         const real _Rho_R = (real)1.0 / Flu_Array_In[DENS][ ID2+dr[d] ];
+
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+         {
+            const real X_C   = Flu_Array_In[v][ID2      ]*_Rho_C;
+            const real X_L   = Flu_Array_In[v][ID2-dr[d]]*_Rho_L;
+            const real X_R   = Flu_Array_In[v][ID2+dr[d]]*_Rho_R;
+            const real D_L   = X_C - X_L;
+            const real D_R   = X_R - X_C;
+            const real Slope = ( D_L*D_R > (real)0.0 ) ? (  ( FABS(D_L) < FABS(D_R) ) ? D_L : D_R  ) : (real)0.0;
+
+            FC_Var[ID1][dL][v] = ( X_C - (real)0.5*Slope )*FC_Var[ID1][dL][DENS];
+            FC_Var[ID1][dR][v] = ( X_C + (real)0.5*Slope )*FC_Var[ID1][dR][DENS];
+         }
+      } // for (int d=0; d<3; d++)
+   } // i,j,k
+#  endif // #if ( NCOMP_PASSIVE > 0 )
+
+} // FUNCTION : CPU_PassiveFaceValue
+#endif // #ifdef PASSIVE_MASS_FLUX
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_MHM_TileDepth
+// Description :  Return the number of output planes along z evaluated by each k-slab of CPU_FluidSolver_MHM()
+//
+// Note        :  1. The depth is chosen so that the planes of all per-thread arrays touched by one slab fit into
+//                   the cache budget "CacheKB"
+//                   --> each array is assumed to require two planes in addition to the slab depth for the stencils
+//                       of the next stages
+//                2. Return PS2 (i.e., a single slab) if CacheKB <= 0, and at least one plane if the budget cannot
+//                   hold a single slab
+//
+// Parameter   :  CacheKB : Cache budget per OpenMP thread in KB
+//
+// Return      :  Slab depth (1 ~ PS2)
+//-------------------------------------------------------------------------------------------------------
+int CPU_MHM_TileDepth( const int CacheKB )
+{
+
+   if ( CacheKB <= 0 )  return PS2;
+
+#  if ( COORDINATE == CYLINDRICAL )
+   const int NGeo = 1;
+#  else
+   const int NGeo = 0;
+#  endif
+#  if ( FLU_SCHEME == MHM_RP )
+   const int NHalfFlux = 3*N_HF_FLUX*N_HF_FLUX;
+#  else
+   const int NHalfFlux = 0;
+#  endif
+   const int NHalo = 2;
+
+// bytes of one plane of the input, PriVar/Half_Var, GeoSrc_In, Half_Flux, FC_Var, FC_Flux, and output arrays
+   const long PlaneByte = (long)sizeof(real)*NCOMP_TOTAL*(  (2+NGeo)*FLU_NXT*FLU_NXT + NHalfFlux
+                                                          + 6*N_FC_VAR*N_FC_VAR + 3*N_FL_FLUX*N_FL_FLUX + PS2*PS2  );
+   const long NK        = (long)CacheKB*1024/PlaneByte - NHalo;
+
+   return (int)MAX( 1L, MIN( NK, (long)PS2 ) );
+
+} // FUNCTION : CPU_MHM_TileDepth
+
+
+
 #endif // #if (  !defined GPU  &&  MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  )
@@ -20,11 +20,26 @@ extern void CPU_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L
 #elif ( RSOLVER == HLLC )
 extern void CPU_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                     const real Gamma, const real MinPres );
+extern void CPU_RiemannSolver_HLLC_Batch( const int NFace, real Flux_Out[][N_FC_VAR], const real L_In[][N_FC_VAR],
+                                          const real R_In[][N_FC_VAR], const real Gamma, const real MinPres );
+
+// relative tolerance of the batched HLLC fluxes compared to the scalar solver in the debug mode
+// --> the vectorized loops may contract the operations into fused multiply-adds differently, which is amplified
+//     by the cancellation in the pressure of nearly pressureless states
+#ifdef FLOAT8
+#  define HLLC_BATCH_TOLERANCE   1.0e-8
+#else
+#  define HLLC_BATCH_TOLERANCE   1.0e-3
+#endif
 #endif
 
 #if ( COORDINATE == CYLINDRICAL )
-extern void GetCoord( const double Corner[], const real dh[], const int loop_size, real x_pos[], real face_pos[][2], 
-                      const int i, const int j, const int k );                                
+extern const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
+extern bool CPU_OrbAdv_GetVphi( const double Corner[], const real dh[], const int NGhost, const int loop_size, real Vphi[] );
+extern void CPU_OrbAdv_Con2Frame( real Con[], const real Vphi );
+extern void CPU_OrbAdv_Flux2Lab( real Flux[], const real Vphi );
+template <int Class>
+static void CylFluxScale( real Flux[], const int d, const CylGeo_t *Geo, const int ir, const int v0, const int v1 );
 #endif
 
 
@@ -37,6 +52,12 @@ extern void GetCoord( const double Corner[], const real dh[], const int loop_siz
 // Note        :  1. Currently support the exact, HLLC, HLLE, and Roe solvers
 //                2. The size of the input array "FC_Var" is assumed to be N_FC_VAR^3
 //                   --> "N_FC_VAR-1" fluxes will be computed along each direction
+//                3. For the HLLC solver, the interfaces of each strip along x are gathered and evaluated
+//                   together by CPU_RiemannSolver_HLLC_Batch()
+//                   --> the scalar solver CPU_RiemannSolver_HLLC() is kept as the reference, against which
+//                       the batched fluxes are verified when GAMER_DEBUG is on
+//                4. For OPT__ORBITAL_ADV, the phi fluxes are evaluated in the frame moving with OrbAdv_Vphi and
+//                   converted back by CPU_OrbAdv_Flux2Lab()
 //
 // Parameter   :  FC_Var          : Array storing the input face-centered conserved variables
 //                FC_Flux         : Array to store the output face-centered flux
@@ -47,11 +68,14 @@ extern void GetCoord( const double Corner[], const real dh[], const int loop_siz
 //                                      cell (i,j,k)
 //                Gap             : Number of grids to be skipped in the transverse direction
 //                                  --> "(N_FC_VAR-2*Gap)^2" fluxes will be computed on each surface
+//                kBeg/kEnd       : Only evaluate the flux planes kBeg <= k < kEnd of the array FC_Flux
+//                                  --> The flux plane k requires the planes <= k+1 of FC_Var
 //                Gamma           : Ratio of specific heats
 //                CorrHalfVel     : true --> correcting the half-step velocity by gravity (for UNSPLIT_GRAVITY only)
 //                Pot_USG         : Array storing the input potential for CorrHalfVel     (for UNSPLIT_GRAVITY only)
 //                                  --> must have the same size as FC_Var ( (PS2+2)^3 )
 //                Corner          : Array storing the physical corner coordinates of each patch group (for UNSPLIT_GRAVITY)
+//                                  --> for OPT__CYL_RGRID, the radii and radial distances are taken from CylGeo_t instead
 //                dt              : Time interval to advance the full-step solution       (for UNSPLIT_GRAVITY only)
 //                dh              : Grid size                                             (for UNSPLIT_GRAVITY only)
 //                Time            : Current physical time                                 (for UNSPLIT_GRAVITY only)
@@ -60,7 +84,7 @@ extern void GetCoord( const double Corner[], const real dh[], const int loop_siz
 //                MinPres         : Minimum allowed pressure
 //-------------------------------------------------------------------------------------------------------
 void CPU_ComputeFlux( const real FC_Var[][6][NCOMP_TOTAL], real FC_Flux[][3][NCOMP_TOTAL], const int NFlux, const int Gap,
-                      const real Gamma, const bool CorrHalfVel, const real Pot_USG[], const double Corner[],
+                      const int kBeg, const int kEnd, const real Gamma, const bool CorrHalfVel, const real Pot_USG[], const double Corner[],
                       const real dt, const real dh[], const double Time, const OptGravityType_t GravityType,
                       const double ExtAcc_AuxArray[], const real MinPres )
 {
@@ -91,12 +115,19 @@ void CPU_ComputeFlux( const real FC_Var[][6][NCOMP_TOTAL], real FC_Flux[][3][NCO
    int  ID1, ID2, dL, dR, start2[3]={0}, end1[3]={0};
    
 #  if ( COORDINATE == CYLINDRICAL )
-   real x_pos[3], face_pos[1][2]; 
+   int  ir0;
+   const CylGeo_t *Geo = CylGeo_Lookup( Corner, dh, N_FC_VAR, ir0 );
+
+   real Vphi[ SQR(N_FC_VAR) ];
+   const bool OrbAdv = CPU_OrbAdv_GetVphi( Corner, dh, (N_FC_VAR-PS2)/2, N_FC_VAR, Vphi );
 #  endif
 
 #  if ( RSOLVER == EXACT )
    const real Gamma_m1 = Gamma - (real)1.0;
    real PriVar_L[NCOMP_TOTAL], PriVar_R[NCOMP_TOTAL];
+#  elif ( RSOLVER == HLLC )
+   int  Rot[NCOMP_TOTAL];                                   // component order of the rotated states
+   real L_Strip[NCOMP_TOTAL][N_FC_VAR], R_Strip[NCOMP_TOTAL][N_FC_VAR], F_Strip[NCOMP_TOTAL][N_FC_VAR];
 #  endif
 
 #  ifdef UNSPLIT_GRAVITY
@@ -111,7 +142,7 @@ void CPU_ComputeFlux( const real FC_Var[][6][NCOMP_TOTAL], real FC_Flux[][3][NCO
    double xyz[3], CrShift[3];
 
 // assuming N_FC_VAR = PS2+2 (ghostzone = 1 on each side) --> CrShift is the central coordinates of FC_Var[0]
-   if (  CorrHalfVel  &&  ( GravityType == GRAVITY_EXTERNAL || GravityType == GRAVITY_BOTH )  )
+   if (  CorrHalfVel  &&  ( GravityType == GRAVITY_EXTERNAL || GravityType == GRAVITY_BOTH || COORDINATE == CYLINDRICAL )  )
       for (int d=0; d<3; d++)    CrShift[d] = Corner[d] - (double)dh[d];
 #  endif
 
@@ -143,127 +174,223 @@ void CPU_ComputeFlux( const real FC_Var[][6][NCOMP_TOTAL], real FC_Flux[][3][NCO
                   end1  [0] = N_FC_VAR-2*Gap;   end1  [1] = N_FC_VAR-2*Gap;   end1  [2] = N_FC_VAR-1;       break;
       }
 
-      for (int k1=0, k2=start2[2];  k1<end1[2];  k1++, k2++)
-      for (int j1=0, j2=start2[1];  j1<end1[1];  j1++, j2++)
-      for (int i1=0, i2=start2[0];  i1<end1[0];  i1++, i2++)
-      {
-         ID1 = (k1*NFlux    + j1)*NFlux    + i1;
-         ID2 = (k2*N_FC_VAR + j2)*N_FC_VAR + i2;
+#     if ( RSOLVER == HLLC )
+//    the rotated component 1+t is the original component 1+(t+d)%3 (see CPU_Rotate3D)
+      for (int v=0; v<NCOMP_TOTAL; v++)   Rot[v]   = v;
+      for (int t=0; t<3; t++)             Rot[1+t] = 1 + (t+d)%3;
+#     endif
 
-         for (int v=0; v<NCOMP_TOTAL; v++)
+      for (int k1=kBeg, k2=start2[2]+kBeg;  k1<MIN(kEnd,end1[2]);  k1++, k2++)
+      for (int j1=0,    j2=start2[1];       j1<end1[1];            j1++, j2++)
+      {
+         for (int i1=0, i2=start2[0];  i1<end1[0];  i1++, i2++)
          {
-            ConVar_L[v] = FC_Var[ ID2         ][dR][v];
-            ConVar_R[v] = FC_Var[ ID2+dID2[d] ][dL][v];
-         }
+            ID1 = (k1*NFlux    + j1)*NFlux    + i1;
+            ID2 = (k2*N_FC_VAR + j2)*N_FC_VAR + i2;
 
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            {
+               ConVar_L[v] = FC_Var[ ID2         ][dR][v];
+               ConVar_R[v] = FC_Var[ ID2+dID2[d] ][dL][v];
+            }
 
-//       correct the half-step velocity by gravity
-#        ifdef UNSPLIT_GRAVITY
-         if ( CorrHalfVel )
-         {
-            Acc[0] = (real)0.0;
-            Acc[1] = (real)0.0;
-            Acc[2] = (real)0.0;
 
-//          external gravity
-            if ( GravityType == GRAVITY_EXTERNAL  ||  GravityType == GRAVITY_BOTH || COORDINATE == CYLINDRICAL )
+//          correct the half-step velocity by gravity
+#           ifdef UNSPLIT_GRAVITY
+            if ( CorrHalfVel )
+            {
+               Acc[0] = (real)0.0;
+               Acc[1] = (real)0.0;
+               Acc[2] = (real)0.0;
+
+//             external gravity
+               if ( GravityType == GRAVITY_EXTERNAL  ||  GravityType == GRAVITY_BOTH || COORDINATE == CYLINDRICAL )
+               {
+                  xyz[0]  = CrShift[0] + (double)(i2*dh[0]);
+                  xyz[1]  = CrShift[1] + (double)(j2*dh[1]);
+                  xyz[2]  = CrShift[2] + (double)(k2*dh[2]);
+                  xyz[d] += dh_half[d];
+
+//                radius of the cell center (or of the outer radial face for d == 0) for OPT__CYL_RGRID
+#                 if ( COORDINATE == CYLINDRICAL )
+                  if ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+                     xyz[0] = ( d == 0 ) ? (double)Geo->rR[ ir0+i2 ] : (double)Geo->r[ ir0+i2 ];
+#                 endif
+
+                  CPU_ExternalAcc( Acc, xyz[0], xyz[1], xyz[2], Time, ExtAcc_AuxArray );
+
+                  for (int d=0; d<3; d++)    Acc[d] *= dt_half;
+               }
+            
+#              if (COORDINATE == CYLINDRICAL)
+               //### this can be faster!
+               //### it assumes avearging two potential at the same r first, then do the derevative
+               GraConst[1] = -dt_half/(dh[1]*xyz[0]) ; 
+
+//             radial potential differences over the actual distances between the cell centers for OPT__CYL_RGRID
+//             --> across the radial face for d1 == 0 and across the cell i2 (with the factor 0.25 below) otherwise
+               if ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+                  GraConst[0] = ( d1 == 0 ) ? -dt_half/( Geo->r[ ir0+i2+1 ] - Geo->r[ ir0+i2   ] )
+                                            : -(real)2.0*dt_half/( Geo->r[ ir0+i2+1 ] - Geo->r[ ir0+i2-1 ] );
+#              endif
+
+//             self-gravity
+               if ( GravityType == GRAVITY_SELF  ||  GravityType == GRAVITY_BOTH )
+               {
+                  ID3      = ( (k2+didx)*USG_NXT_F + (j2+didx) )*USG_NXT_F + (i2+didx);
+
+                  Acc[d1] +=            GraConst[d1]*( Pot_USG[ ID3+dID3[d1] ] - Pot_USG[ ID3                   ] );               
+                  Acc[d2] += (real)0.25*GraConst[d2]*( Pot_USG[ ID3+dID3[d2] ] + Pot_USG[ ID3+dID3[d2]+dID3[d1] ]
+                                                      -Pot_USG[ ID3-dID3[d2] ] - Pot_USG[ ID3-dID3[d2]+dID3[d1] ] );
+                  Acc[d3] += (real)0.25*GraConst[d3]*( Pot_USG[ ID3+dID3[d3] ] + Pot_USG[ ID3+dID3[d3]+dID3[d1] ]
+                                                      -Pot_USG[ ID3-dID3[d3] ] - Pot_USG[ ID3-dID3[d3]+dID3[d1] ] );
+               }
+
+//             store the internal energy density
+               eL = ConVar_L[4] - (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
+               eR = ConVar_R[4] - (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+
+//             advance velocity by gravity
+               for (int t=0; t<3; t++)
+               {
+                  ConVar_L[t+1] += ConVar_L[0]*Acc[t];
+                  ConVar_R[t+1] += ConVar_R[0]*Acc[t];
+               }
+
+//             update total energy density with the internal energy density fixed
+               ConVar_L[4] = eL + (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
+               ConVar_R[4] = eR + (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+            } // if ( CorrHalfVel )
+#           endif // #ifdef UNSPLIT_GRAVITY
+
+
+//          evaluate the phi fluxes in the frame moving with the mean azimuthal velocity
+#           if ( COORDINATE == CYLINDRICAL )
+            if ( OrbAdv  &&  d == 1 )
             {
-               xyz[0]  = CrShift[0] + (double)(i2*dh[0]);
-               xyz[1]  = CrShift[1] + (double)(j2*dh[1]);
-               xyz[2]  = CrShift[2] + (double)(k2*dh[2]);
-               xyz[d] += dh_half[d];
+               CPU_OrbAdv_Con2Frame( ConVar_L, Vphi[ k2*N_FC_VAR + i2 ] );
+               CPU_OrbAdv_Con2Frame( ConVar_R, Vphi[ k2*N_FC_VAR + i2 ] );
+            }
+#           endif
 
-               CPU_ExternalAcc( Acc, xyz[0], xyz[1], xyz[2], Time, ExtAcc_AuxArray );
 
-               for (int d=0; d<3; d++)    Acc[d] *= dt_half;
+#           if   ( RSOLVER == EXACT )
+            const bool NormPassive_No  = false; // do NOT convert any passive variable to mass fraction for the Riemann solvers
+            const bool JeansMinPres_No = false;
+
+            CPU_Con2Pri( ConVar_L, PriVar_L, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
+            CPU_Con2Pri( ConVar_R, PriVar_R, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
+
+            CPU_RiemannSolver_Exact( d, NULL, NULL, NULL, FC_Flux[ID1][d], PriVar_L, PriVar_R, Gamma );
+#           elif ( RSOLVER == ROE )
+            CPU_RiemannSolver_Roe ( d, FC_Flux[ID1][d], ConVar_L, ConVar_R, Gamma, MinPres );
+#           elif ( RSOLVER == HLLE )
+            CPU_RiemannSolver_HLLE( d, FC_Flux[ID1][d], ConVar_L, ConVar_R, Gamma, MinPres );
+#           elif ( RSOLVER == HLLC )
+//          store the rotated states of the strip (see CPU_RiemannSolver_HLLC_Batch)
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            {
+               L_Strip[v][i1] = ConVar_L[ Rot[v] ];
+               R_Strip[v][i1] = ConVar_R[ Rot[v] ];
             }
-            
-#           if (COORDINATE == CYLINDRICAL)
-            //### this can be faster!
-            //### it assumes avearging two potential at the same r first, then do the derevative
-            GraConst[1] = -dt_half/(dh[1]*xyz[0]) ; 
+#           else
+#           error : ERROR : unsupported Riemann solver (EXACT/ROE) !!
 #           endif
+         } // for (int i1=0, i2=start2[0];  i1<end1[0];  i1++, i2++)
 
-//          self-gravity
-            if ( GravityType == GRAVITY_SELF  ||  GravityType == GRAVITY_BOTH )
-            {
-               ID3      = ( (k2+didx)*USG_NXT_F + (j2+didx) )*USG_NXT_F + (i2+didx);
 
-               Acc[d1] +=            GraConst[d1]*( Pot_USG[ ID3+dID3[d1] ] - Pot_USG[ ID3                   ] );               
-               Acc[d2] += (real)0.25*GraConst[d2]*( Pot_USG[ ID3+dID3[d2] ] + Pot_USG[ ID3+dID3[d2]+dID3[d1] ]
-                                                   -Pot_USG[ ID3-dID3[d2] ] - Pot_USG[ ID3-dID3[d2]+dID3[d1] ] );
-               Acc[d3] += (real)0.25*GraConst[d3]*( Pot_USG[ ID3+dID3[d3] ] + Pot_USG[ ID3+dID3[d3]+dID3[d1] ]
-                                                   -Pot_USG[ ID3-dID3[d3] ] - Pot_USG[ ID3-dID3[d3]+dID3[d1] ] );
+//       evaluate the HLLC fluxes of the whole strip
+#        if ( RSOLVER == HLLC )
+         CPU_RiemannSolver_HLLC_Batch( end1[0], F_Strip, L_Strip, R_Strip, Gamma, MinPres );
+
+         for (int i1=0; i1<end1[0]; i1++)
+         {
+            ID1 = (k1*NFlux + j1)*NFlux + i1;
+
+            for (int v=0; v<NCOMP_TOTAL; v++)   FC_Flux[ID1][d][ Rot[v] ] = F_Strip[v][i1];
+
+#           ifdef GAMER_DEBUG
+//          compare with the scalar reference solver
+            real Flux_Ref[NCOMP_TOTAL], Flux_Max=(real)0.0;
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            {
+               ConVar_L[ Rot[v] ] = L_Strip[v][i1];
+               ConVar_R[ Rot[v] ] = R_Strip[v][i1];
             }
 
-//          store the internal energy density
-            eL = ConVar_L[4] - (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
-            eR = ConVar_R[4] - (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
+            CPU_RiemannSolver_HLLC( d, Flux_Ref, ConVar_L, ConVar_R, Gamma, MinPres );
+
+            for (int v=0; v<NCOMP_TOTAL; v++)   Flux_Max = FMAX( Flux_Max, FABS(Flux_Ref[v]) );
 
-//          advance velocity by gravity
-            for (int t=0; t<3; t++)
+            for (int v=0; v<NCOMP_TOTAL; v++)
             {
-               ConVar_L[t+1] += ConVar_L[0]*Acc[t];
-               ConVar_R[t+1] += ConVar_R[0]*Acc[t];
+               if (  FABS( FC_Flux[ID1][d][v] - Flux_Ref[v] ) > HLLC_BATCH_TOLERANCE*Flux_Max  )
+                  Aux_Message( stderr, "WARNING : batched HLLC flux mismatch (d %d, v %d, i/j/k %d/%d/%d): %20.13e vs. %20.13e !!\n",
+                               d, v, i1, j1, k1, FC_Flux[ID1][d][v], Flux_Ref[v] );
             }
+#           endif // #ifdef GAMER_DEBUG
+         } // for (int i1=0; i1<end1[0]; i1++)
+#        endif // #if ( RSOLVER == HLLC )
+
 
-//          update total energy density with the internal energy density fixed
-            ConVar_L[4] = eL + (real)0.5*( SQR(ConVar_L[1]) + SQR(ConVar_L[2]) + SQR(ConVar_L[3]) )/ConVar_L[0];
-            ConVar_R[4] = eR + (real)0.5*( SQR(ConVar_R[1]) + SQR(ConVar_R[2]) + SQR(ConVar_R[3]) )/ConVar_R[0];
-         } // if ( CorrHalfVel )
-#        endif // #ifdef UNSPLIT_GRAVITY
-
-
-#        if   ( RSOLVER == EXACT )
-         const bool NormPassive_No  = false; // do NOT convert any passive variable to mass fraction for the Riemann solvers
-         const bool JeansMinPres_No = false;
-
-         CPU_Con2Pri( ConVar_L, PriVar_L, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-         CPU_Con2Pri( ConVar_R, PriVar_R, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-
-         CPU_RiemannSolver_Exact( d, NULL, NULL, NULL, FC_Flux[ID1][d], PriVar_L, PriVar_R, Gamma );
-#        elif ( RSOLVER == ROE )
-         CPU_RiemannSolver_Roe ( d, FC_Flux[ID1][d], ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLE )
-         CPU_RiemannSolver_HLLE( d, FC_Flux[ID1][d], ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLC )
-         CPU_RiemannSolver_HLLC( d, FC_Flux[ID1][d], ConVar_L, ConVar_R, Gamma, MinPres );
-#        else
-#        error : ERROR : unsupported Riemann solver (EXACT/ROE) !!
-#        endif
-         
-         
 #        if ( COORDINATE == CYLINDRICAL )
-         GetCoord( Corner, dh, N_FC_VAR, x_pos, face_pos, i2, j2, k2);
-         
-         //### check if this part is vectorized
-         if ( d==0 ) {   
-            for (int v=0; v<NCOMP_TOTAL; v++) {
-               if (v==MOMY) FC_Flux[ID1][d][v] *= SQR(face_pos[0][1]) ;
-               else         FC_Flux[ID1][d][v] *= face_pos[0][1] ;
-            }
-         }
-         
-         else if ( d==1 ) {   
-            for (int v=0; v<NCOMP_TOTAL; v++) 
-               if (v==MOMY) FC_Flux[ID1][d][v] *= x_pos[0] ;
-         }  
-         
-         else if ( d==2 ) {
-            for (int v=0; v<NCOMP_TOTAL; v++) {
-               if (v==MOMY) FC_Flux[ID1][d][v] *= SQR(x_pos[0]) ;
-               else         FC_Flux[ID1][d][v] *= x_pos[0] ;
-            }
-         }
-         
-#        endif
-         
-         
-      } // i,j,k
+         for (int i1=0, i2=start2[0];  i1<end1[0];  i1++, i2++)
+         {
+            const int ir = ir0 + i2;
+
+            ID1 = (k1*NFlux + j1)*NFlux + i1;
+
+            if ( OrbAdv  &&  d == 1 )  CPU_OrbAdv_Flux2Lab( FC_Flux[ID1][d], Vphi[ k2*N_FC_VAR + i2 ] );
+
+#           define CYL_FLUX_SCALE( Class, v0, v1 )                                                      \
+            CylFluxScale<Class>( FC_Flux[ID1][d], d, Geo, ir, v0, v1 );
+
+            FOR_EACH_COMP_CLASS( CYL_FLUX_SCALE )
+#           undef CYL_FLUX_SCALE
+         } // for (int i1=0, i2=start2[0];  i1<end1[0];  i1++, i2++)
+#        endif // #if ( COORDINATE == CYLINDRICAL )
+      } // j,k
    } // for (int d=0; d<3; d++)
 
 } // FUNCTION : CPU_ComputeFlux
 
 
 
+#if ( COORDINATE == CYLINDRICAL )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFluxScale
+// Description :  Multiply the face fluxes of the components [v0, v1) of class Class by the face area factors
+//
+// Note        :  1. The azimuthal momentum (COMP_MOMPHI) carries one more power of r, and the other components
+//                   need no factor along phi, both of which are resolved at compile time
+//
+// Parameter   :  Flux  : Face fluxes to be scaled in place
+//                d     : Spatial direction of the face (0/1/2 --> r/phi/z)
+//                Geo   : Radial geometry table of this level (see CylGeo_Lookup)
+//                ir    : Table index of the cell
+//                v0/v1 : Range of the components (see FOR_EACH_COMP_CLASS)
+//-------------------------------------------------------------------------------------------------------
+template <int Class>
+void CylFluxScale( real Flux[], const int d, const CylGeo_t *Geo, const int ir, const int v0, const int v1 )
+{
+
+   const bool AngMom = ( Class == COMP_MOMPHI );
+   real Factor;
+
+   switch ( d )
+   {
+      case 0 :    Factor = ( AngMom ) ? Geo->rR2[ir] : Geo->rR[ir];   break;
+      case 1 :    if ( !AngMom )  return;
+                  Factor = Geo->r[ir];                                 break;
+      default :   Factor = ( AngMom ) ? Geo->r2 [ir] : Geo->r [ir];   break;
+   }
+
+   for (int v=v0; v<v1; v++)  Flux[v] *= Factor;
+
+} // FUNCTION : CylFluxScale
+#endif // #if ( COORDINATE == CYLINDRICAL )
+
+
+
 #endif // #if ( !defined GPU  &&  MODEL == HYDRO  &&  (FLU_SCHEME == MHM || MHM_RP || CTU) )
@@ -12,15 +12,20 @@ static void Get_EigenSystem( const real CC_Var[], real EigenVal[][NCOMP_FLUID],
                              real REigenVec[][NCOMP_FLUID], const real Gamma );
 static void LimitSlope( const real L2[], const real L1[], const real C0[], const real R1[], const real R2[],
                         const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const real EP_Coeff,
-                        const real Gamma, const int XYZ, real Slope_Limiter[], const real x_pos[], const real dh[] );
+                        const real Gamma, const int XYZ, real Slope_Limiter[], const real SlopeCorr[] );
 #ifdef CHAR_RECONSTRUCTION
 static void Pri2Char( real Var[], const real Gamma, const real Rho, const real Pres, const int XYZ );
 static void Char2Pri( real Var[], const real Gamma, const real Rho, const real Pres, const int XYZ );
 #endif
+#if (  LR_SCHEME == PLM  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  )
+static void PLM_Pencil( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][NCOMP_TOTAL], const int NOut,
+                        const int ID1_0, const int ID2_0, const int dr, const int d, const real Gamma,
+                        const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                        const real Corr[][N_FC_VAR], const real Frac[][N_FC_VAR] );
+#endif
 
 # if ( COORDINATE == CYLINDRICAL )
-extern void GetCoord( const double Corner[], const real dh[], const int loop_size, real x_pos[], real face_pos[][2], 
-                      const int i, const int j, const int k );
+extern const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
 #endif
 
 
@@ -36,6 +41,9 @@ extern void GetCoord( const double Corner[], const real dh[], const int loop_siz
 //                5. The data reconstruction can be applied to characteristic variables by
 //                   defining "CHAR_RECONSTRUCTION"
 //                6. This function is shared by MHM, MHM_RP, and CTU schemes
+//                7. For the MHM and MHM_RP schemes, all limiters except EXTPRE are evaluated for a pencil of
+//                   cells at a time by PLM_Pencil()
+//                   --> the cell-by-cell loop below is used only for EXTPRE and CTU
 //
 // Parameter   :  PriVar         : Array storing the input primitive variables
 //                FC_Var         : Array to store the output face-centered primitive variables
@@ -45,6 +53,8 @@ extern void GetCoord( const double Corner[], const real dh[], const int loop_siz
 //                                  --> The size of the output array "FC_Var" is assumed to be "(NIn-2*NGhost)^3"
 //                                  --> The reconstructed data at cell (i,j,k) will be stored in the
 //                                      array "FC_Var" with the index "(i-NGhost,j-NGhost,k-NGhost)
+//                kBeg/kEnd      : Only evaluate the output planes kBeg <= k < kEnd of the array "FC_Var"
+//                                 --> kEnd is truncated to "NIn-2*NGhost"
 //                Gamma          : Ratio of specific heats
 //                LR_Limiter     : Slope limiter for the data reconstruction in the MHM/MHM_RP/CTU schemes
 //                                 (0/1/2/3/4) = (vanLeer/generalized MinMod/vanAlbada/
@@ -56,13 +66,14 @@ extern void GetCoord( const double Corner[], const real dh[], const int loop_siz
 //                MinDens/Pres   : Minimum allowed density and pressure
 //------------------------------------------------------------------------------------------------------
 void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][NCOMP_TOTAL], const int NIn, const int NGhost,
-                             const real Gamma, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-                             const real EP_Coeff, const real dt, const real dh[], const double Corner[], 
+                             const int kBeg, const int kEnd, const real Gamma, const LR_Limiter_t LR_Limiter,
+                             const real MinMod_Coeff, const real EP_Coeff, const real dt, const real dh[], const double Corner[],
                              const real MinDens, const real MinPres )
 {
 
-   const int dr1[3] = { 1, NIn, NIn*NIn };
-   const int NOut   = NIn - 2*NGhost;                    // number of output grids
+   const int dr1[3]   = { 1, NIn, NIn*NIn };
+   const int NOut     = NIn - 2*NGhost;                  // number of output grids
+   const int kEnd_Out = MIN( kEnd, NOut );
    int  ID1, ID2, ID1_L, ID1_R, ID1_LL, ID1_RR, dL, dR;
    real Min, Max;
    real Slope_Limiter[NCOMP_TOTAL] = { (real)0.0 };
@@ -70,9 +81,58 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
    real slope_frac_R[3] = { (real)1.0, (real)1.0, (real)1.0 } ;
    
 #if ( COORDINATE == CYLINDRICAL ) 
-   real x_pos[3], face_pos[1][2]; 
+   int  ir0;
+   const CylGeo_t *Geo = CylGeo_Lookup( Corner, dh, NOut, ir0 );
 #endif
 
+
+// (1) evaluate each pencil of cells along x at once for the MHM/MHM_RP schemes
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+   if ( LR_Limiter != EXTPRE )
+   {
+#     ifdef GAMER_DEBUG
+      if ( NOut > N_FC_VAR )  Aux_Error( ERROR_INFO, "NOut (%d) > N_FC_VAR (%d) !!\n", NOut, N_FC_VAR );
+#     endif
+
+//    slope corrections (backward/forward/centered) and face fractions (left/right) of each direction
+//    --> all unity except along r in the cylindrical coordinate
+      real Corr[3][3][N_FC_VAR], Frac[3][2][N_FC_VAR];
+
+      for (int d=0; d<3; d++)
+      for (int i=0; i<NOut; i++)
+      {
+         for (int t=0; t<3; t++)    Corr[d][t][i] = (real)1.0;
+         for (int t=0; t<2; t++)    Frac[d][t][i] = (real)1.0;
+      }
+
+#     if ( COORDINATE == CYLINDRICAL )
+      for (int i=0; i<NOut; i++)
+      {
+         for (int t=0; t<3; t++)    Corr[0][t][i] = Geo->SlopeCorr[t][ ir0+i ];
+
+         Frac[0][0][i] = (real)1.0 + Geo->dh_6r[ ir0+i ];
+         Frac[0][1][i] = (real)1.0 - Geo->dh_6r[ ir0+i ];
+      }
+#     endif
+
+      for (int k2=kBeg; k2<kEnd_Out; k2++)
+      for (int j2=0;    j2<NOut;     j2++)
+      {
+         const int ID1_0 = ( (k2+NGhost)*NIn + (j2+NGhost) )*NIn + NGhost;
+         const int ID2_0 = (  k2        *NOut + j2          )*NOut;
+
+         for (int d=0; d<3; d++)
+            PLM_Pencil( PriVar, FC_Var, NOut, ID1_0, ID2_0, dr1[d], d, Gamma, LR_Limiter, MinMod_Coeff,
+                        Corr[d], Frac[d] );
+      }
+
+      return;
+   } // if ( LR_Limiter != EXTPRE )
+#  endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+
+
+// (2) cell-by-cell reconstruction
+
 // variables for the CTU scheme
 #  if ( FLU_SCHEME == CTU )
    const real dt_dh2 = (real)0.5*dt/dh;
@@ -95,9 +155,9 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
 #  endif // #if ( FLU_SCHEME ==  CTU )
 
 
-   for (int k1=NGhost, k2=0;  k1<NGhost+NOut;  k1++, k2++)
-   for (int j1=NGhost, j2=0;  j1<NGhost+NOut;  j1++, j2++)
-   for (int i1=NGhost, i2=0;  i1<NGhost+NOut;  i1++, i2++)
+   for (int k1=NGhost+kBeg, k2=kBeg;  k2<kEnd_Out;  k1++, k2++)
+   for (int j1=NGhost,      j2=0;     j1<NGhost+NOut;  j1++, j2++)
+   for (int i1=NGhost,      i2=0;     i1<NGhost+NOut;  i1++, i2++)
    {
       ID1 = (k1*NIn  + j1)*NIn  + i1;
       ID2 = (k2*NOut + j2)*NOut + i2;
@@ -109,10 +169,10 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
 #     endif
       
 #if ( COORDINATE == CYLINDRICAL )
-      GetCoord( Corner, dh, NOut, x_pos, face_pos, i2, j2, k2);
-      const real _6x1 = (real)1.0 / ((real)6.0 * x_pos[0]);
-      slope_frac_L[0] = (real)1.0 + ( dh[0] * _6x1 );
-      slope_frac_R[0] = (real)1.0 - ( dh[0] * _6x1 );
+      const int  ir           = ir0 + i2;
+      const real SlopeCorr[3] = { Geo->SlopeCorr[0][ir], Geo->SlopeCorr[1][ir], Geo->SlopeCorr[2][ir] };
+      slope_frac_L[0] = (real)1.0 + Geo->dh_6r[ir];
+      slope_frac_R[0] = (real)1.0 - Geo->dh_6r[ir];
 #endif
 
 
@@ -132,17 +192,17 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
             ID1_RR = ID1 + 2*dr1[d];
 
             LimitSlope( PriVar[ID1_LL], PriVar[ID1_L], PriVar[ID1], PriVar[ID1_R], PriVar[ID1_RR], LR_Limiter,
-                        MinMod_Coeff, EP_Coeff, Gamma, d, Slope_Limiter, NULL, NULL );
+                        MinMod_Coeff, EP_Coeff, Gamma, d, Slope_Limiter, NULL );
          }
 
          else
          {
 #           if ( COORDINATE == CARTESIAN )
             LimitSlope( NULL, PriVar[ID1_L], PriVar[ID1], PriVar[ID1_R], NULL, LR_Limiter,
-                        MinMod_Coeff, NULL_REAL, Gamma, d, Slope_Limiter, NULL, NULL );
+                        MinMod_Coeff, NULL_REAL, Gamma, d, Slope_Limiter, NULL );
 #           elif ( COORDINATE == CYLINDRICAL )
             LimitSlope( NULL, PriVar[ID1_L], PriVar[ID1], PriVar[ID1_R], NULL, LR_Limiter,
-                        MinMod_Coeff, NULL_REAL, Gamma, d, Slope_Limiter, x_pos, dh );
+                        MinMod_Coeff, NULL_REAL, Gamma, d, Slope_Limiter, SlopeCorr );
 #           endif
          }
 
@@ -348,6 +408,226 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
    } // k,j,i
 
 } // FUNCTION : CPU_DataReconstruction (PLM)
+
+
+
+#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PLM_Pencil
+// Description :  PLM reconstruction of a pencil of cells along x in the direction d
+//
+// Note        :  1. Equivalent to LimitSlope() + steps (2-2) and (2-3) of CPU_DataReconstruction() for all
+//                   limiters except EXTPRE, but the data of the pencil are stored in the structure-of-arrays
+//                   layout and each step is a loop over cells without branches
+//                   --> the loops can be vectorized by the compiler
+//                2. The projections onto the characteristic variables (CHAR_RECONSTRUCTION) are written out
+//                   as straight-line arithmetic, and the rotation of CPU_Rotate3D() is applied by permuting
+//                   the component indices instead of shuffling the data
+//                3. The limiter is selected once per pencil
+//                4. Only the first NCOMP_PRED components are reconstructed
+//                   --> passive scalars are skipped when PASSIVE_MASS_FLUX is on (see CPU_PassiveFaceValue())
+//
+// Parameter   :  PriVar       : Array storing the input primitive variables
+//                FC_Var       : Array to store the output face-centered primitive variables
+//                NOut         : Number of cells in the pencil
+//                ID1_0        : Index of the first cell of the pencil in PriVar
+//                ID2_0        : Index of the first cell of the pencil in FC_Var
+//                dr           : Stride of PriVar in the direction d
+//                d            : Target spatial direction : (0/1/2) --> (x/y/z)
+//                Gamma        : Ratio of specific heats
+//                LR_Limiter   : Slope limiter (VANLEER/GMINMOD/ALBADA/VL_GMINMOD)
+//                MinMod_Coeff : Coefficient of the generalized MinMod limiter
+//                Corr         : Backward/forward/centered slope corrections of each cell
+//                Frac         : Left/right face fractions of the limited slope of each cell
+//-------------------------------------------------------------------------------------------------------
+void PLM_Pencil( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][NCOMP_TOTAL], const int NOut,
+                 const int ID1_0, const int ID2_0, const int dr, const int d, const real Gamma,
+                 const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                 const real Corr[][N_FC_VAR], const real Frac[][N_FC_VAR] )
+{
+
+   const int dL = 2*d;
+   const int dR = dL+1;
+
+   real C0[NCOMP_PRED][N_FC_VAR], L1[NCOMP_PRED][N_FC_VAR], R1[NCOMP_PRED][N_FC_VAR];
+   real SL[NCOMP_PRED][N_FC_VAR], SR[NCOMP_PRED][N_FC_VAR], SC[NCOMP_PRED][N_FC_VAR], Lim[NCOMP_PRED][N_FC_VAR];
+
+
+// 1. gather the pencil and evaluate the backward/forward/centered slopes
+   for (int i=0; i<NOut; i++)
+   for (int v=0; v<NCOMP_PRED; v++)
+   {
+      L1[v][i] = PriVar[ ID1_0+i-dr ][v];
+      C0[v][i] = PriVar[ ID1_0+i    ][v];
+      R1[v][i] = PriVar[ ID1_0+i+dr ][v];
+   }
+
+   for (int v=0; v<NCOMP_PRED; v++)
+   for (int i=0; i<NOut; i++)
+   {
+      SL[v][i] = Corr[0][i]*C0[v][i] - Corr[0][i]*L1[v][i];
+      SR[v][i] = Corr[1][i]*R1[v][i] - Corr[1][i]*C0[v][i];
+      SC[v][i] = (real)0.5*( Corr[2][i]*R1[v][i] - Corr[2][i]*L1[v][i] );
+   }
+
+// the van Leer slope of VL_GMINMOD is evaluated from the primitive slopes
+   if ( LR_Limiter == VL_GMINMOD )
+   {
+      for (int v=0; v<NCOMP_PRED; v++)
+      for (int i=0; i<NOut; i++)
+      {
+         const real LR = SL[v][i]*SR[v][i];
+         Lim[v][i] = ( LR > (real)0.0 ) ? (real)2.0*LR/( SL[v][i] + SR[v][i] ) : (real)0.0;
+      }
+   }
+
+
+// 2. primitive variables --> characteristic variables
+//    --> the characteristic variables 1/2/3 are stored in the slots of the rotated components 1/2/3, and
+//        the transverse ones (2/3) are identical to the primitive slopes
+#  ifdef CHAR_RECONSTRUCTION
+   const int Rot1 = 1 + d;    // component rotated to the longitudinal velocity (see CPU_Rotate3D())
+   const int NSlope = ( LR_Limiter == VL_GMINMOD ) ? 4 : 3;
+   real (*Slope[4])[N_FC_VAR] = { SL, SR, SC, Lim };
+
+#  ifdef CHECK_NEGATIVE_IN_FLUID
+   for (int i=0; i<NOut; i++)
+   {
+      if ( CPU_CheckNegative(C0[4][i]) )
+         Aux_Message( stderr, "ERROR : negative pressure (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+                      C0[4][i], __FILE__, __LINE__, __FUNCTION__ );
+
+      if ( CPU_CheckNegative(C0[0][i]) )
+         Aux_Message( stderr, "ERROR : negative density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+                      C0[0][i], __FILE__, __LINE__, __FUNCTION__ );
+   }
+#  endif
+
+   for (int s=0; s<NSlope; s++)
+   {
+      real (*S)[N_FC_VAR] = Slope[s];
+
+      for (int i=0; i<NOut; i++)
+      {
+         const real Rho  = C0[0][i];
+         const real Pres = C0[4][i];
+         const real _Cs2 = (real)1.0 / ( Gamma*Pres/Rho );
+         const real _Cs  = SQRT( _Cs2 );
+         const real T0   = S[0   ][i];
+         const real T1   = S[Rot1][i];
+         const real T4   = S[4   ][i];
+
+         S[0   ][i] = -(real)0.5*Rho*_Cs*T1 + (real)0.5*_Cs2*T4;
+         S[Rot1][i] = T0 - _Cs2*T4;
+         S[4   ][i] = +(real)0.5*Rho*_Cs*T1 + (real)0.5*_Cs2*T4;
+      }
+   }
+#  endif
+
+
+// 3. apply the slope limiter
+   switch ( LR_Limiter )
+   {
+      case VANLEER:              // van-Leer
+         for (int v=0; v<NCOMP_PRED; v++)
+         for (int i=0; i<NOut; i++)
+         {
+            const real LR = SL[v][i]*SR[v][i];
+            Lim[v][i] = ( LR > (real)0.0 ) ? (real)2.0*LR/( SL[v][i] + SR[v][i] ) : (real)0.0;
+         }
+         break;
+
+      case GMINMOD:              // generalized MinMod
+         for (int v=0; v<NCOMP_PRED; v++)
+         for (int i=0; i<NOut; i++)
+         {
+            const real LR  = SL[v][i]*SR[v][i];
+            const real Min = MIN(  MIN( FABS(SL[v][i]*MinMod_Coeff), FABS(SR[v][i]*MinMod_Coeff) ),
+                                   FABS(SC[v][i])  );
+            Lim[v][i] = ( LR > (real)0.0 ) ? Min*SIGN( SC[v][i] ) : (real)0.0;
+         }
+         break;
+
+      case ALBADA:               // van-Albada
+         for (int v=0; v<NCOMP_PRED; v++)
+         for (int i=0; i<NOut; i++)
+         {
+            const real LR = SL[v][i]*SR[v][i];
+            Lim[v][i] = ( LR > (real)0.0 ) ? LR*( SL[v][i] + SR[v][i] ) / ( SL[v][i]*SL[v][i] + SR[v][i]*SR[v][i] )
+                                           : (real)0.0;
+         }
+         break;
+
+      case VL_GMINMOD:           // van-Leer + generalized MinMod
+         for (int v=0; v<NCOMP_PRED; v++)
+         for (int i=0; i<NOut; i++)
+         {
+            const real LR  = SL[v][i]*SR[v][i];
+            const real Min = MIN(  MIN( MIN( FABS(SL[v][i]*MinMod_Coeff), FABS(SR[v][i]*MinMod_Coeff) ),
+                                        FABS(SC[v][i]) ),  FABS(Lim[v][i])  );
+            Lim[v][i] = ( LR > (real)0.0 ) ? Min*SIGN( SC[v][i] ) : (real)0.0;
+         }
+         break;
+
+      default :
+         Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "LR_Limiter", LR_Limiter );
+   }
+
+
+// 4. characteristic variables --> primitive variables
+#  ifdef CHAR_RECONSTRUCTION
+   for (int i=0; i<NOut; i++)
+   {
+      const real _Rho = (real)1.0 / C0[0][i];
+      const real Cs2  = Gamma*C0[4][i]*_Rho;
+      const real Cs   = SQRT( Cs2 );
+      const real W0   = Lim[0   ][i];
+      const real W1   = Lim[Rot1][i];
+      const real W4   = Lim[4   ][i];
+
+      Lim[0   ][i] = W0 + W1 + W4;
+      Lim[Rot1][i] = Cs*_Rho*( -W0 + W4 );
+      Lim[4   ][i] = Cs2*( W0 + W4 );
+   }
+#  endif
+
+
+// 5. get the face-centered primitive variables and ensure that they lie between neighboring cell-centered values
+   for (int v=0; v<NCOMP_PRED; v++)
+   for (int i=0; i<NOut; i++)
+   {
+      const real C  = C0[v][i];
+      const real L  = L1[v][i];
+      const real R  = R1[v][i];
+      real       FL = C - (real)0.5*Lim[v][i]*Frac[0][i];
+      real       FR;
+      real       Min, Max;
+
+      Min = ( C < L ) ? C : L;
+      Max = ( C > L ) ? C : L;
+      FL  = ( FL > Min ) ? FL : Min;
+      FL  = ( FL < Max ) ? FL : Max;
+      FR  = (real)2.0*C - FL;
+
+      Min = ( C < R ) ? C : R;
+      Max = ( C > R ) ? C : R;
+      FR  = ( FR > Min ) ? FR : Min;
+      FR  = ( FR < Max ) ? FR : Max;
+      FL  = (real)2.0*C - FR;
+
+      SL[v][i] = FL;
+      SR[v][i] = FR;
+   }
+
+   for (int i=0; i<NOut; i++)
+   for (int v=0; v<NCOMP_PRED; v++)
+   {
+      FC_Var[ ID2_0+i ][dL][v] = SL[v][i];
+      FC_Var[ ID2_0+i ][dR][v] = SR[v][i];
+   }
+
+} // FUNCTION : PLM_Pencil
+#endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
 #endif // #if ( LR_SCHEME == PLM )
 
 
@@ -374,6 +654,8 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
 //                                  --> The size of the output array "FC_Var" is assumed to be "(NIn-2*NGhost)^3"
 //                                  --> The reconstructed data at cell (i,j,k) will be stored in the
 //                                      array "FC_Var" with the index "(i-NGhost,j-NGhost,k-NGhost)
+//                kBeg/kEnd      : Only evaluate the output planes kBeg <= k < kEnd of the array "FC_Var"
+//                                 --> kEnd is truncated to "NIn-2*NGhost"
 //                Gamma          : Ratio of specific heats
 //                LR_Limiter     : Slope limiter for the data reconstruction in the MHM/MHM_RP/CTU schemes
 //                                 (0/1/2/3/4) = (vanLeer/generalized MinMod/vanAlbada/
@@ -385,8 +667,9 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
 //                MinDens/Pres   : Minimum allowed density and pressure
 //------------------------------------------------------------------------------------------------------
 void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][NCOMP_TOTAL], const int NIn, const int NGhost,
-                             const real Gamma, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-                             const real EP_Coeff, const real dt, const real dh, const real MinDens, const real MinPres )
+                             const int kBeg, const int kEnd, const real Gamma, const LR_Limiter_t LR_Limiter,
+                             const real MinMod_Coeff, const real EP_Coeff, const real dt, const real dh, const real MinDens,
+                             const real MinPres )
 {
 
 // check
@@ -396,10 +679,11 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
 #  endif
 
 
-   const int NOut   = NIn - 2*NGhost;                    // number of output grids
-   const int NSlope = NOut + 2;                          // number of grids required to store the slope data
-   const int dr1[3] = { 1, NIn, NIn*NIn };
-   const int dr3[3] = { 1, NSlope, NSlope*NSlope };
+   const int NOut     = NIn - 2*NGhost;                  // number of output grids
+   const int NSlope   = NOut + 2;                        // number of grids required to store the slope data
+   const int dr1[3]   = { 1, NIn, NIn*NIn };
+   const int dr3[3]   = { 1, NSlope, NSlope*NSlope };
+   const int kEnd_Out = MIN( kEnd, NOut );
 
    int ID1, ID2, ID3, ID1_L, ID1_R, ID3_L, ID3_R, dL, dR;
    real Slope_Limiter[NCOMP_TOTAL] = { (real)0.0 };
@@ -439,9 +723,10 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
 
 
 // (2-1) evaluate the monotonic slope
-   for (int k1=NGhost-1, k2=0;  k1<NGhost-1+NSlope;  k1++, k2++)
-   for (int j1=NGhost-1, j2=0;  j1<NGhost-1+NSlope;  j1++, j2++)
-   for (int i1=NGhost-1, i2=0;  i1<NGhost-1+NSlope;  i1++, i2++)
+//       --> the output planes [kBeg, kEnd_Out) require the slope planes [kBeg, kEnd_Out+2)
+   for (int k1=NGhost-1+kBeg, k2=kBeg;  k2<kEnd_Out+2;      k1++, k2++)
+   for (int j1=NGhost-1,      j2=0;     j1<NGhost-1+NSlope;  j1++, j2++)
+   for (int i1=NGhost-1,      i2=0;     i1<NGhost-1+NSlope;  i1++, i2++)
    {
       ID1 = (k1*NIn    + j1)*NIn    + i1;
       ID2 = (k2*NSlope + j2)*NSlope + i2;
@@ -479,9 +764,9 @@ void CPU_DataReconstruction( const real PriVar[][NCOMP_TOTAL], real FC_Var[][6][
    } // k,j,i
 
 
-   for (int k1=NGhost, k2=0, k3=1;  k1<NGhost+NOut;  k1++, k2++, k3++)
-   for (int j1=NGhost, j2=0, j3=1;  j1<NGhost+NOut;  j1++, j2++, j3++)
-   for (int i1=NGhost, i2=0, i3=1;  i1<NGhost+NOut;  i1++, i2++, i3++)
+   for (int k1=NGhost+kBeg, k2=kBeg, k3=kBeg+1;  k2<kEnd_Out;     k1++, k2++, k3++)
+   for (int j1=NGhost,      j2=0,    j3=1;       j1<NGhost+NOut;  j1++, j2++, j3++)
+   for (int i1=NGhost,      i2=0,    i3=1;       i1<NGhost+NOut;  i1++, i2++, i3++)
    {
       ID1 = (k1*NIn    + j1)*NIn    + i1;
       ID2 = (k2*NOut   + j2)*NOut   + i2;
@@ -907,10 +1192,12 @@ void Get_EigenSystem( const real CC_Var[], real EigenVal[][NCOMP_FLUID], real LE
 //                XYZ            : Target spatial direction : (0/1/2) --> (x/y/z)
 //                                 --> Useful only if the option "CHAR_RECONSTRUCTION" is turned on
 //                Slope_Limiter  : Array to store the output monotonic slope
+//                SlopeCorr      : Backward/forward/centered radial slope corrections of the cylindrical
+//                                 coordinate taken from CylGeo_t::SlopeCorr (NULL --> no correction)
 //-------------------------------------------------------------------------------------------------------
 void LimitSlope( const real L2[], const real L1[], const real C0[], const real R1[], const real R2[],
                  const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const real EP_Coeff,
-                 const real Gamma, const int XYZ, real Slope_Limiter[], const real x_pos[], const real dh[] )
+                 const real Gamma, const int XYZ, real Slope_Limiter[], const real SlopeCorr[] )
 {
 
 // check
@@ -936,14 +1223,10 @@ void LimitSlope( const real L2[], const real L1[], const real C0[], const real R
 
 #if ( COORDINATE == CYLINDRICAL )
 #if ( LR_SCHEME == PLM )
-   if (XYZ == 0){
-      const real x1   = x_pos[0];
-      const real x1_L = x1-dh[0];
-      const real x1_R = x1+dh[0];
-   
-      slope_corr_L1 = slope_corr_L2 = (real)1.0 / ( (real)1.0 - SQR(dh[0]) / ((real)12.0 * x1 * x1_L) ) ;  
-      slope_corr_R1 = slope_corr_R2 = (real)1.0 / ( (real)1.0 - SQR(dh[0]) / ((real)12.0 * x1 * x1_R) ) ;
-      slope_corr_C1 = slope_corr_C2 = (real)1.0 / ( (real)1.0 - SQR(dh[0]) / ((real)12.0 * x1_L * x1_R) ) ;
+   if ( XYZ == 0  &&  SlopeCorr != NULL ){
+      slope_corr_L1 = slope_corr_L2 = SlopeCorr[0] ;  
+      slope_corr_R1 = slope_corr_R2 = SlopeCorr[1] ;
+      slope_corr_C1 = slope_corr_C2 = SlopeCorr[2] ;
    }
 #elif ( LR_SCHEME == PPM )
    
@@ -4,6 +4,10 @@
 // some functions in this file need to be defined even when using GPU
 #if ( MODEL == HYDRO )
 
+#if ( COORDINATE == CYLINDRICAL )
+const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
+#endif
+
 
 
 
@@ -455,7 +459,9 @@ void CPU_NormalizePassive( const real GasDens, real Passive[], const int NNorm,
 //                face_pos     : output face position
 //                i, j, k      : cell index - (0, 0, 0) is the corner index of the patch
 //
-// NOTE        :  could extend to all coordinate, but be careful of face_pos[][]
+// NOTE        :  1. could extend to all coordinate, but be careful of face_pos[][]
+//                2. the radius of the cylindrical coordinate is taken from the mapped radial grid of OPT__CYL_RGRID
+//                   (see Hydro_Init_CylGeo)
 //-------------------------------------------------------------------------------------------------------
 void GetCoord( const double Corner[], const real dh[], const int loop_size, real x_pos[], real face_pos[][2],
                const int i, const int j, const int k ) {
@@ -467,6 +473,17 @@ void GetCoord( const double Corner[], const real dh[], const int loop_size, real
    // r-dir's inner and outer face position
    face_pos[0][0] = x_pos[0] - (0.5 * dh[0]);
    face_pos[0][1] = x_pos[0] + (0.5 * dh[0]);
+
+#if ( COORDINATE == CYLINDRICAL )
+   if ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM ) {
+      int ir0;
+      const CylGeo_t *Geo = CylGeo_Lookup( Corner, dh, loop_size, ir0 );
+
+      x_pos   [0]    = Geo->r    [ ir0+i   ];
+      face_pos[0][0] = Geo->rFace[ ir0+i   ];
+      face_pos[0][1] = Geo->rFace[ ir0+i+1 ];
+   }
+#endif
    
 #if ( COORDINATE == SPHERICAL )
    // theta's inner and outer face position
@@ -476,27 +493,146 @@ void GetCoord( const double Corner[], const real dh[], const int loop_size, real
 }
 
 
+#if ( COORDINATE == CYLINDRICAL )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylGeo_Lookup
+// Description :  get the radial geometry table of the level with grid size dh and the table index of the
+//                loop index i = 0
+//
+// Parameter   :  Corner       : cell centered position at the corner cell of that patch, expect Corner_Array[3]
+//                dh           : Grid size
+//                loop_size    : the size of the loop (see GetCoord)
+//                i0           : output table index of i = 0 --> the cell i is at the table index i0+i
+//
+// Return      :  CylGeo[lv]
+//
+// NOTE        :  the solvers do not receive the level, which is therefore identified by dh[0]
+//-------------------------------------------------------------------------------------------------------
+const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 ) {
+   
+   int lv = 0;
+   while ( lv < NLEVEL-1  &&  dh[0] < 0.75*amr->dh[lv][0] )    lv ++;
+   
+   const CylGeo_t *Geo = &CylGeo[lv];
+   
+   i0 = (int)( ( Corner[0] - amr->BoxEdgeL[0] ) / amr->dh[lv][0] ) - (loop_size-PS2)/2 + Geo->NGhost;
+   
+#  ifdef GAMER_DEBUG
+   if ( i0 < 0  ||  i0+loop_size > Geo->N )
+      Aux_Error( ERROR_INFO, "radial table index out of range (i0 %d, loop_size %d, N %d) !!\n", i0, loop_size, Geo->N );
+#  endif
+   
+   return Geo;
+}
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_OrbAdv_GetVphi
+// Description :  get the mean azimuthal velocity of orbital advection (OrbAdv_Vphi[]) of the cells in a loop
+//
+// Note        :  1. Vphi does not depend on phi, so only the (r,z) indices of the loop are filled
+//                2. Indices outside the simulation domain are wrapped for the periodic boundary conditions
+//                   and clamped to the boundary cells otherwise
+//                3. Only the base level is supported (see Hydro_OrbAdv_SetVphi)
+//
+// Parameter   :  Corner       : cell centered position at the corner cell of that patch (group)
+//                dh           : Grid size
+//                NGhost       : number of cells in the loop before Corner along each direction
+//                loop_size    : the size of the loop along r and z
+//                Vphi         : output array --> the cell (i,k) of the loop is stored in Vphi[k*loop_size+i]
+//
+// Return      :  false if OPT__ORBITAL_ADV is off, in which case Vphi is not touched
+//-------------------------------------------------------------------------------------------------------
+bool CPU_OrbAdv_GetVphi( const double Corner[], const real dh[], const int NGhost, const int loop_size, real Vphi[] ) {
+
+   if ( OPT__ORBITAL_ADV == ORB_ADV_NONE )   return false;
+
+#  ifdef GAMER_DEBUG
+   if ( dh[0] < 0.75*amr->dh[0][0] )
+      Aux_Error( ERROR_INFO, "orbital advection only supports the base level (dh %14.7e) !!\n", dh[0] );
+#  endif
+
+   const int NR = NX0_TOT[0];
+   const int NZ = NX0_TOT[2];
+   const int i0 = (int)( ( Corner[0] - amr->BoxEdgeL[0] ) / amr->dh[0][0] ) - NGhost;
+   const int k0 = (int)( ( Corner[2] - amr->BoxEdgeL[2] ) / amr->dh[0][2] ) - NGhost;
+
+   for (int k=0; k<loop_size; k++)
+   {
+      int kk = k0 + k;
+      if ( OPT__BC_FLU[4] == BC_FLU_PERIODIC )   kk = ( kk + NZ ) % NZ;
+      else                                       kk = MIN( MAX( kk, 0 ), NZ-1 );
+
+      for (int i=0; i<loop_size; i++)
+      {
+         int ii = i0 + i;
+         if ( OPT__BC_FLU[0] == BC_FLU_PERIODIC )   ii = ( ii + NR ) % NR;
+         else                                       ii = MIN( MAX( ii, 0 ), NR-1 );
+
+         Vphi[ k*loop_size + i ] = OrbAdv_Vphi[ (long)kk*NR + ii ];
+      }
+   }
+
+   return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_OrbAdv_Con2Frame
+// Description :  transform the conserved variables to the frame moving along phi with the velocity Vphi
+//
+// NOTE        :  1. the internal energy and all other components are invariant
+//                2. CPU_OrbAdv_Flux2Lab() is the inverse transformation of the phi fluxes
+//
+// Parameter   :  Con          : conserved variables to be transformed in place
+//                Vphi         : velocity of the frame
+//-------------------------------------------------------------------------------------------------------
+void CPU_OrbAdv_Con2Frame( real Con[], const real Vphi ) {
+
+   Con[ENGY] += Vphi*( (real)0.5*Vphi*Con[DENS] - Con[MOMY] );
+   Con[MOMY] -= Vphi*Con[DENS];
+}
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_OrbAdv_Flux2Lab
+// Description :  convert the phi fluxes evaluated in the frame moving with the velocity Vphi to the fluxes of
+//                the lab-frame conserved variables across the moving face
+//
+// NOTE        :  1. the converted fluxes still exclude the advection by Vphi, which is done by Hydro_OrbAdv_Shift()
+//
+// Parameter   :  Flux         : phi fluxes to be converted in place
+//                Vphi         : velocity of the frame
+//-------------------------------------------------------------------------------------------------------
+void CPU_OrbAdv_Flux2Lab( real Flux[], const real Vphi ) {
+
+   Flux[ENGY] += Vphi*( Flux[MOMY] + (real)0.5*Vphi*Flux[DENS] );
+   Flux[MOMY] += Vphi*Flux[DENS];
+}
+#endif // #if ( COORDINATE == CYLINDRICAL )
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  GeometrySourceTerm
 // Description :  get the geometrical source terms for FV update
 //
 // Parameter   :  PriVar       : primitive var at cell center -> expect to be PriVar[NCOMP_TOTAL]
 //                x_pos        : cell-centered position
+//                _rad         : 1/x_pos[0] (e.g., CylGeo_t::_r)
 //                GeoSource    : output geometrical source terms
 //-------------------------------------------------------------------------------------------------------
-void GeometrySourceTerm( const real PriVar[], const real x_pos[], real GeoSource[] ) {
+void GeometrySourceTerm( const real PriVar[], const real x_pos[], const real _rad, real GeoSource[] ) {
    
    // initiate all source terms to zero
    for (int v=0; v<NCOMP_TOTAL; v++) GeoSource[v] = 0.0;
 
 // ** cylindrical coordinate ** //
 #if ( COORDINATE == CYLINDRICAL )
-   const real _rad = (real)1.0/x_pos[0];
    GeoSource[MOMX] = ( PriVar[DENS]*SQR(PriVar[MOMY]) + PriVar[ENGY] ) * _rad ;
    
 // ** spherical coordinate   ** //
 #elif ( COORDINATE == SPHERICAL )
-   const real _rad = (real)1.0/x_pos[0], theta = x_pos[1];
+   const real theta = x_pos[1];
    GeoSource[MOMX] = ( PriVar[DENS]*SQR(PriVar[MOMY]) + PriVar[DENS]*SQR(PriVar[MOMZ]) + 2.0*PriVar[ENGY] ) * _rad;
    GeoSource[MOMY] = ( PriVar[DENS]*SQR(PriVar[MOMZ]) + PriVar[ENGY] ) * (COS(theta)/SIN(theta)) * _rad;
    
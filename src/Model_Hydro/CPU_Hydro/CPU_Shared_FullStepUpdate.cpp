@@ -11,17 +11,20 @@
 #if ( COORDINATE == CYLINDRICAL )
 extern void GetCoord( const double Corner[], const real dh[], const int loop_size, real x_pos[], real face_pos[][2], 
                       const int i, const int j, const int k );
-extern void GeometrySourceTerm( const real PriVar[], const real x_pos[], real GeoSource[] );
-static void CurviFluxGrad( real dF[][NCOMP_TOTAL], const real x_pos[] );
-static void GetFullStepGeoSource( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], real* GeoSource, 
-                                  const real dF[][NCOMP_TOTAL], const real* x_pos, const real* dt_dh2, const real dt_2, 
+extern void GeometrySourceTerm( const real PriVar[], const real x_pos[], const real _rad, real GeoSource[] );
+extern const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
+template <int Class>
+static void CurviFluxGrad( real dF[][NCOMP_TOTAL], const real _r, const real _r2, const real dh_dr, const int v0, const int v1 );
+static void GetFullStepGeoSource( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], const real GeoSrc_In[],
+                                  real* GeoSource, const real dF[][NCOMP_TOTAL], const real* x_pos, const real _r,
+                                  const real r_m32, const real* dt_dh2, const real dt_2, 
                                   const real Gamma_m1, const real MinPres, const int ID3 ) ;
 extern void CPU_Con2Pri( const real In[], real Out[], const real Gamma_m1, const real MinPres,
                          const bool NormPassive, const int NNorm, const int NormIdx[],
                          const bool JeansMinPres, const real JeansMinPres_Coeff );
 // for cooling
 #ifdef COOLING
-extern void CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]);
+extern void CPU_CoolingRate( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N );
 #endif // COOLING
 #endif
 
@@ -37,8 +40,14 @@ extern void CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]
 //                DE_Status        : Array to store the dual-energy status
 //                Flux             : Array storing the input face-centered flux
 //                                   --> Size is assumed to be N_FL_FLUX^3
+//                kBeg/kEnd        : Only update the output planes kBeg <= k < kEnd
+//                                   --> The output plane k requires the planes <= k+1 of Flux
 //                dt               : Time interval to advance solution
 //                dh               : Grid size
+//                Corner           : Physical coordinates of the patch group corner
+//                GeoSrc_In        : Geometric source terms of the input data evaluated by CPU_InputGeoSource()
+//                                   --> Size is assumed to be FLU_NXT^3
+//                                   --> Useful only for the cylindrical coordinate
 //                Gamma            : Ratio of specific heats
 //                MinDens          : Minimum allowed density
 //                MinPres          : Minimum allowed pressure
@@ -51,8 +60,8 @@ extern void CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]
 //                                   --> Should be set to the global variable "PassiveNorm_VarIdx"
 //-------------------------------------------------------------------------------------------------------
 void CPU_FullStepUpdate( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Output[][ PS2*PS2*PS2 ], char DE_Status[],
-                         const real Flux[][3][NCOMP_TOTAL], const real dt, const real dh[], const double Corner[],
-                         const real Gamma, const real MinDens, const real MinPres, const real DualEnergySwitch,
+                         const real Flux[][3][NCOMP_TOTAL], const int kBeg, const int kEnd, const real dt, const real dh[], const double Corner[],
+                         const real GeoSrc_In[][NCOMP_TOTAL], const real Gamma, const real MinDens, const real MinPres, const real DualEnergySwitch,
                          const bool NormPassive, const int NNorm, const int NormIdx[] )
 {
 
@@ -70,11 +79,12 @@ void CPU_FullStepUpdate( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Out
    const real dt_2      = (real)0.5 * dt ;
    const real dt_dh2[3] = {dt_2/dh[0], dt_2/dh[1], dt_2/dh[2]};
    real x_pos[3], face_pos[1][2], GeoSource[NCOMP_TOTAL] ;
+   int  ir0;
+   const CylGeo_t *Geo = CylGeo_Lookup( Corner, dh, PS2, ir0 );
 #  ifndef DUAL_ENERGY
    const real  Gamma_m1 = Gamma - (real)1.0; //### this has already been declared in DUAL_ENERGY
 #  endif // #ifndef DUAL_ENERGY
 #  ifdef MODEL_MSTAR
-   const real Edge_x1_L = amr->BoxEdgeL[0];
    real dist2center, r_i;
    double d_star_mom_r, d_star_mom_theta, cos_theta, sin_theta;
    const double star_pos[3] = {ExtAcc_AuxArray[0], ExtAcc_AuxArray[1], ExtAcc_AuxArray[2]};
@@ -86,9 +96,9 @@ void CPU_FullStepUpdate( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Out
 #  endif
 
 
-   for (int k1=0, k2=FLU_GHOST_SIZE;  k1<PS2;  k1++, k2++)
-   for (int j1=0, j2=FLU_GHOST_SIZE;  j1<PS2;  j1++, j2++)
-   for (int i1=0, i2=FLU_GHOST_SIZE;  i1<PS2;  i1++, i2++)
+   for (int k1=kBeg, k2=FLU_GHOST_SIZE+kBeg;  k1<MIN(kEnd,PS2);  k1++, k2++)
+   for (int j1=0,    j2=FLU_GHOST_SIZE;       j1<PS2;            j1++, j2++)
+   for (int i1=0,    i2=FLU_GHOST_SIZE;       i1<PS2;            i1++, i2++)
    {
 
       ID1 = (k1*N_FL_FLUX + j1)*N_FL_FLUX + i1;
@@ -99,18 +109,22 @@ void CPU_FullStepUpdate( const real Input[][ FLU_NXT*FLU_NXT*FLU_NXT ], real Out
       for (int v=0; v<NCOMP_TOTAL; v++)   dF[d][v] = Flux[ ID1+dID1[d] ][d][v] - Flux[ID1][d][v];
       
 #     if (COORDINATE == CYLINDRICAL)
+      const int ir = ir0 + i1;
       GetCoord( Corner, dh, PS2, x_pos, face_pos, i1, j1, k1);
-      CurviFluxGrad(dF, x_pos) ;
-      GetFullStepGeoSource( Input, GeoSource, dF, x_pos, dt_dh2, dt_2, Gamma_m1, MinPres, ID3);
+#     define CURVI_FLUX_GRAD( Class, v0, v1 )   CurviFluxGrad<Class>( dF, Geo->_r[ir], Geo->_r2[ir], Geo->dh_dr[ir], v0, v1 );
+      FOR_EACH_COMP_CLASS( CURVI_FLUX_GRAD )
+#     undef CURVI_FLUX_GRAD
+      GetFullStepGeoSource( Input, GeoSrc_In[ID3], GeoSource, dF, x_pos, Geo->_r[ir], Geo->r_m32[ir], dt_dh2, dt_2,
+                            Gamma_m1, MinPres, ID3 );
       
 #     ifdef MODEL_MSTAR
       // only account for the flux from the inner most r-grid; be carful about ghost zone
-      r_i         = x_pos[0]-0.5*dh[0] ;
+      r_i         = face_pos[0][0] ;
       //dist2center = SQRT( SQR(r_i) + SQR(x_pos[2]) ) ;
       dist2center = SQRT( SQR(r_i) + SQR(star_pos[0]) - 2*r_i*star_pos[0]*cos(x_pos[1]-star_pos[1]) 
                         + SQR(x_pos[2]-star_pos[2]) ) ;
       
-      if (x_pos[0] > Edge_x1_L && x_pos[0] < Edge_x1_L+dh[0] && dist2center < ACCRETE_RADIUS ) {
+      if ( ir == Geo->NGhost && dist2center < ACCRETE_RADIUS ) {
          //### Note that Flux = physical_flux*r_i
          d_MStar         += FMAX( -Flux[ID1][0][DENS], 0 ) * dt * (dh[1]*dh[2]) ; 
          
@@ -277,30 +291,31 @@ void CPU_StoreFlux( real Flux_Array[][NCOMP_TOTAL][ PS2*PS2 ], const real FC_Flu
 #if ( COORDINATE == CYLINDRICAL )
 // //-------------------------------------------------------------------------------------------------------
 // Function    :  CurviFluxGrad
-// Description :  get transverse flux gradient in curvilinear coordinate, used in FullStepUpdate 
+// Description :  get transverse flux gradient of the components [v0, v1) of class Class in curvilinear
+//                coordinate, used in FullStepUpdate 
 //
-// Parameter   :  Flux         : cell centered position at the corner cell of that patch, expect Corner_Array[3]
-//                dF           : 
-//                x_pos        : xyz position of the cell
-//                face_pos     : xyz position of cell faces
-//                v            : from 0 - (NCOMP_TOTAL-1)
+// Parameter   :  dF           : flux gradient to be scaled in place
+//                _r           : 1/r of the cell (CylGeo_t::_r)
+//                _r2          : 1/r^2 of the cell (CylGeo_t::_r2)
+//                dh_dr        : dh/dr of the cell (CylGeo_t::dh_dr)
+//                v0/v1        : range of the components (see FOR_EACH_COMP_CLASS)
 //
-// NOTE        :  could extend to all coordinate, but be careful of face_pos[][]
+// NOTE        :  1. the azimuthal momentum (COMP_MOMPHI) is scaled by 1/r^2, which is resolved at compile time
+//                2. the radial difference is converted from per dh to per dr by dh_dr (see OPT__CYL_RGRID)
 //-------------------------------------------------------------------------------------------------------
-void CurviFluxGrad( real dF[][NCOMP_TOTAL], const real x_pos[] ) {
+template <int Class>
+void CurviFluxGrad( real dF[][NCOMP_TOTAL], const real _r, const real _r2, const real dh_dr, const int v0, const int v1 ) {
 
-   // pre-calculate geo-factor
-   const real _x1    = (real)1.0/x_pos[0];
-   
-   for (int d=0; d<3; d++)
-   for (int v=0; v<NCOMP_TOTAL; v++) {
-      if (v==MOMY) dF[d][v] *= SQR(_x1) ;
-      else         dF[d][v] *= _x1      ;
-   }
+   const real Factor = ( Class == COMP_MOMPHI ) ? _r2 : _r;
+
+   for (int v=v0; v<v1; v++)  dF[0][v] *= Factor*dh_dr;
+
+   for (int d=1; d<3; d++)
+   for (int v=v0; v<v1; v++)  dF[d][v] *= Factor;
    
 #  ifdef GAMER_DEBUG
    for (int d=0; d<3; d++)
-   for (int v=0; v<NCOMP_TOTAL; v++) {
+   for (int v=v0; v<v1; v++) {
       if ( ! isfinite( dF[d][v] ) ) {
          Aux_Message( stderr, "WARNING : dF NaN'ed at (d, v) = (%d, %d) at file <%s>, line <%d>, function <%s>\n",
                       d, v, __FILE__, __LINE__, __FUNCTION__ );
@@ -318,45 +333,48 @@ void CurviFluxGrad( real dF[][NCOMP_TOTAL], const real x_pos[] ) {
 //                use this corrected half step pri var to find GeoSource for full step update
 //
 // Parameter   :  ConInput     : 
+//                GeoSrc_In    : geometric source terms of ConInput[][ID3] (see CPU_InputGeoSource)
 //                GeoSource    : 
 //                dF           : 
 //                x_pos        : 
+//                _r           : 1/r of the cell (CylGeo_t::_r)
+//                r_m32        : r^(-3/2) of the cell for the cooling rate (CylGeo_t::r_m32)
 //                dt_dh2       : 
 //                dt_2         : dt/2
 //
 //-------------------------------------------------------------------------------------------------------
-void GetFullStepGeoSource( const real ConInput[][ FLU_NXT*FLU_NXT*FLU_NXT ], real* GeoSource, 
-                           const real dF[][NCOMP_TOTAL], const real* x_pos, const real* dt_dh2, const real dt_2, 
-                           const real Gamma_m1, const real MinPres, const int ID3 ) {
+void GetFullStepGeoSource( const real ConInput[][ FLU_NXT*FLU_NXT*FLU_NXT ], const real GeoSrc_In[],
+                           real* GeoSource, const real dF[][NCOMP_TOTAL], const real* x_pos, const real _r,
+                           const real r_m32, const real* dt_dh2, const real dt_2, const real Gamma_m1, const real MinPres,
+                           const int ID3 ) {
                              
    real ConVar_Buffer[NCOMP_TOTAL], PriVar_Buffer[NCOMP_TOTAL];
    const bool NormPassive_No  = false; 
    const bool JeansMinPres_No = false;
    
-   for (int v=0; v<NCOMP_TOTAL; v++) ConVar_Buffer[v] = ConInput[v][ID3] ;
-   
-   CPU_Con2Pri( ConVar_Buffer, PriVar_Buffer, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, 
-                JeansMinPres_No, NULL_REAL );
-   
-   GeometrySourceTerm( PriVar_Buffer, x_pos, GeoSource );
-   
+   // the source terms of the input state are shared with the half-step prediction
    for (int v=0; v<NCOMP_TOTAL; v++) {
+      ConVar_Buffer[v]  = ConInput[v][ID3] ;
       ConVar_Buffer[v] -= dF[0][v]*dt_dh2[0] + dF[1][v]*dt_dh2[1] + dF[2][v]*dt_dh2[2] ;
-      ConVar_Buffer[v] += GeoSource[v] * dt_2 ;
+      ConVar_Buffer[v] += GeoSrc_In[v] * dt_2 ;
    }
    
    CPU_Con2Pri( ConVar_Buffer, PriVar_Buffer, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, 
                 JeansMinPres_No, NULL_REAL );
    
-   GeometrySourceTerm( PriVar_Buffer, x_pos, GeoSource );
+   GeometrySourceTerm( PriVar_Buffer, x_pos, _r, GeoSource );
 
 #ifdef COOLING   
    
-   real cool_rate;
-   CoolingFunc(&cool_rate, PriVar_Buffer, x_pos);
+   // cooling is applied by Hydro_Cooling_AdvanceDt() instead when OPT__COOL_SUBCYCLE is on
+   if ( !OPT__COOL_SUBCYCLE )
+   {
+      real cool_rate;
+      CPU_CoolingRate( &cool_rate, &PriVar_Buffer[DENS], &PriVar_Buffer[ENGY], &r_m32, 1 );
    
-   // ### note that GeoSource now includes both GeoSource and Cooling
-   GeoSource[ENGY] -= cool_rate ; 
+      // ### note that GeoSource now includes both GeoSource and Cooling
+      GeoSource[ENGY] -= cool_rate ; 
+   }
    
 #endif
 }
@@ -205,4 +205,157 @@ void CPU_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[],
 
 
 
+#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_RiemannSolver_HLLC_Batch
+// Description :  Batched version of CPU_RiemannSolver_HLLC() evaluating the fluxes of a strip of interfaces
+//
+// Note        :  1. The input data should be conserved variables stored in the structure-of-arrays layout
+//                   --> L_In[v][f] = component v of the left state of the interface f
+//                2. The input states must have been rotated so that the component 1 is the normal momentum
+//                   (i.e., as done by CPU_Rotate3D()), and the output fluxes are NOT rotated back
+//                   --> no shuffle is required inside the loop over interfaces
+//                3. The arithmetic follows CPU_RiemannSolver_HLLC() operation by operation, but all branches
+//                   are replaced by selections and CPU_CheckMinPres()/FMAX()/FMIN() by comparisons, so that
+//                   the loops over interfaces can be vectorized by the compiler
+//                   --> the two solvers agree bitwise for finite inputs unless the compiler contracts the
+//                       operations differently (e.g., into fused multiply-adds)
+//                   --> CPU_ComputeFlux() compares the two solvers when GAMER_DEBUG is on
+//                4. Passive scalars are evaluated in a separate loop for each component
+//                5. Invoked by CPU_ComputeFlux()
+//
+// Parameter   :  NFace    : Number of interfaces in the strip (<= N_FC_VAR)
+//                Flux_Out : Array to store the output fluxes (in the rotated order)
+//                L_In     : Input left  states (conserved variables in the rotated order)
+//                R_In     : Input right states (conserved variables in the rotated order)
+//                Gamma    : Ratio of specific heats
+//                MinPres  : Minimum allowed pressure
+//-------------------------------------------------------------------------------------------------------
+void CPU_RiemannSolver_HLLC_Batch( const int NFace, real Flux_Out[][N_FC_VAR], const real L_In[][N_FC_VAR],
+                                   const real R_In[][N_FC_VAR], const real Gamma, const real MinPres )
+{
+
+   const real Gamma_m1 = Gamma - (real)1.0;
+
+#  ifdef CHECK_NEGATIVE_IN_FLUID
+   for (int f=0; f<NFace; f++)
+   {
+      if ( CPU_CheckNegative(L_In[0][f]) )
+         Aux_Message( stderr, "ERROR : negative density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+                      L_In[0][f], __FILE__, __LINE__, __FUNCTION__ );
+
+      if ( CPU_CheckNegative(R_In[0][f]) )
+         Aux_Message( stderr, "ERROR : negative density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+                      R_In[0][f], __FILE__, __LINE__, __FUNCTION__ );
+   }
+#  endif
+
+
+// 1. fluid variables
+   for (int f=0; f<NFace; f++)
+   {
+//    1-1. Roe's average values
+      const real L0 = L_In[0][f],  L1 = L_In[1][f],  L2 = L_In[2][f],  L3 = L_In[3][f],  L4 = L_In[4][f];
+      const real R0 = R_In[0][f],  R1 = R_In[1][f],  R2 = R_In[2][f],  R3 = R_In[3][f],  R4 = R_In[4][f];
+
+      const real  TempRho = (real)0.5*( L0 + R0 );
+      const real _TempRho = (real)1.0/TempRho;
+      const real _RhoL    = (real)1.0 / L0;
+      const real _RhoR    = (real)1.0 / R0;
+
+      real P_L = Gamma_m1*(  L4 - (real)0.5*( L1*L1 + L2*L2 + L3*L3 )*_RhoL  );
+      real P_R = Gamma_m1*(  R4 - (real)0.5*( R1*R1 + R2*R2 + R3*R3 )*_RhoR  );
+      P_L = ( P_L > MinPres ) ? P_L : MinPres;
+      P_R = ( P_R > MinPres ) ? P_R : MinPres;
+
+      const real H_L             = ( L4 + P_L )*_RhoL;
+      const real H_R             = ( R4 + P_R )*_RhoR;
+      const real RhoL_sqrt       = SQRT( L0 );
+      const real RhoR_sqrt       = SQRT( R0 );
+      const real _RhoL_sqrt      = (real)1.0 / RhoL_sqrt;
+      const real _RhoR_sqrt      = (real)1.0 / RhoR_sqrt;
+      const real _RhoLR_sqrt_sum = (real)1.0 / (RhoL_sqrt + RhoR_sqrt);
+
+      const real u  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L1 + _RhoR_sqrt*R1 );
+      const real v  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L2 + _RhoR_sqrt*R2 );
+      const real w  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L3 + _RhoR_sqrt*R3 );
+      const real V2 = u*u + v*v + w*w;
+      const real H  = _RhoLR_sqrt_sum*(  RhoL_sqrt*H_L  +  RhoR_sqrt*H_R  );
+
+      real GammaP_Rho, TempPres;
+      GammaP_Rho = Gamma_m1*( H - (real)0.5*V2 );
+      TempPres   = GammaP_Rho*TempRho/Gamma;
+      TempPres   = ( TempPres > MinPres ) ? TempPres : MinPres;
+      GammaP_Rho = Gamma*TempPres*_TempRho;
+
+      const real Cs = SQRT( GammaP_Rho );
+
+
+//    1-2. maximum wave speeds
+      const real EVal_L = u - Cs;
+      const real EVal_R = u + Cs;
+      const real u_L    = _RhoL*L1;
+      const real u_R    = _RhoR*R1;
+      const real Cs_L   = SQRT( Gamma*P_L*_RhoL );
+      const real Cs_R   = SQRT( Gamma*P_R*_RhoR );
+      const real W_L    = ( EVal_L < u_L-Cs_L ) ? EVal_L : u_L-Cs_L;
+      const real W_R    = ( EVal_R > u_R+Cs_R ) ? EVal_R : u_R+Cs_R;
+      const real MaxV_L = ( W_L < (real)0.0 ) ? W_L : (real)0.0;
+      const real MaxV_R = ( W_R > (real)0.0 ) ? W_R : (real)0.0;
+
+
+//    1-3. star-region velocity and pressure
+      const real temp1_L = L0*(  (EVal_L<u_L-Cs_L) ? (u_L-EVal_L) : (+Cs_L)  );
+      const real temp1_R = R0*(  (EVal_R>u_R+Cs_R) ? (u_R-EVal_R) : (-Cs_R)  );
+      const real temp2_L = P_L + temp1_L*u_L;
+      const real temp2_R = P_R + temp1_R*u_R;
+      const real temp3   = real(1.0) / ( temp1_L - temp1_R );
+
+      const real V_S = temp3*( P_L - P_R + temp1_L*u_L - temp1_R*u_R );
+      real       P_S = temp3*( temp1_L*temp2_R - temp1_R*temp2_L );
+      P_S = ( P_S > MinPres ) ? P_S : MinPres;
+
+
+//    1-4. select the upwind side and evaluate the HLLC fluxes
+//         --> the fluxes of the upwind state are identical to those of CPU_Con2Flux()
+      const bool Left  = ( V_S >= (real)0.0 );
+      const real S0    = Left ? L0     : R0;
+      const real S1    = Left ? L1     : R1;
+      const real S2    = Left ? L2     : R2;
+      const real S3    = Left ? L3     : R3;
+      const real S4    = Left ? L4     : R4;
+      const real P     = Left ? P_L    : P_R;
+      const real MaxV  = Left ? MaxV_L : MaxV_R;
+      const real Vx    = S1 / S0;
+
+      const real temp4    = (real)1.0 / ( V_S - MaxV );
+      const real Coeff_LR = temp4*V_S;
+      const real Coeff_S  = -temp4*MaxV*P_S;
+
+      Flux_Out[0][f] = Coeff_LR*( S1                - MaxV*S0 );
+      Flux_Out[1][f] = Coeff_LR*( Vx*S1 + P         - MaxV*S1 ) + Coeff_S;
+      Flux_Out[2][f] = Coeff_LR*( Vx*S2             - MaxV*S2 );
+      Flux_Out[3][f] = Coeff_LR*( Vx*S3             - MaxV*S3 );
+      Flux_Out[4][f] = Coeff_LR*( Vx*( S4 + P )     - MaxV*S4 ) + Coeff_S*V_S;
+   } // for (int f=0; f<NFace; f++)
+
+
+// 2. passive scalars
+#  if ( NCOMP_PASSIVE > 0 )
+   for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+   for (int f=0; f<NFace; f++)
+   {
+      const real Flux_Dens = Flux_Out[FLUX_DENS][f];
+      const real Flux_L    = L_In[v][f]*( Flux_Dens*((real)1.0/L_In[0][f]) );
+      const real Flux_R    = R_In[v][f]*( Flux_Dens*((real)1.0/R_In[0][f]) );
+
+      Flux_Out[v][f] = ( Flux_Dens >= (real)0.0 ) ? Flux_L : Flux_R;
+   }
+#  endif
+
+} // FUNCTION : CPU_RiemannSolver_HLLC_Batch
+#endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+
+
+
 #endif // #if ( MODEL == HYDRO )
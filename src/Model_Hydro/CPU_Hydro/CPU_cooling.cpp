@@ -6,75 +6,390 @@
 
 #ifdef COOLING
 extern double  Time[NLEVEL];
-extern void    CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]);
+
+void CPU_CoolingRate( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N );
+
+// beta cooling of the PopIII disk
+#define COOL_T_ORBIT          0.79                    // outer orbital time: POPIII: 0.79; SG: 125
+#define COOL_R                4.64952804093003e+0     // Boltzmann R in the unit of popIII setting (T = P/(rho*R))
+#define COOL_BETA             15.0                    // cooling time = COOL_BETA * (dynamical time)
+#define COOL_T_MIN            100.0                   // no cooling below this temperature (in K)
+
+// log-spaced temperature tables of the POPIII rates
+#define COOL_TAB_NT           4096                    // number of temperature nodes
+#define COOL_TAB_T_MIN        1.0e1                   // temperature range of the tables (in K)
+#define COOL_TAB_T_MAX        1.0e6
+#define COOL_TAB_FLOOR        1.0e-300                // floor of the tabulated rates (their logarithms are tabulated)
+#define COOL_TAB_TOLERANCE    1.0e-2                  // maximum relative error accepted by OPT__CK_COOL_TABLE
+
+enum { COOL_TAB_K5=0, COOL_TAB_HII, COOL_TAB_H2, COOL_TAB_LY, COOL_TAB_BREM, COOL_NTAB };
+
+static double *CoolTab = NULL;                        // ln(rate) of all tables --> CoolTab[ Tab*COOL_TAB_NT + node ]
+static double  CoolTab_lnT0, CoolTab__dlnT;
+
+static double CoolTab_Analytic( const int Tab, const double T );
+static double CoolTab_Lookup( const int Tab, const double lnT );
+static double HII_Fraction( const double c1 );
+static double H2_Fraction( const double n_cgs, const double tau_dyn_cgs, const double k4, const double k5 );
+static void   CoolingRate_Beta( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N,
+                                const real Coeff, const real Floor );
+static void   CoolTab_Validate();
 
 // for POPIII
-static double rate_k4_func(const real T);
-static double rate_k5_func(const real T);
-static double f_HII_func(const real n_cgs, const real T);
-static double f_H2_func(const real n_cgs, const real T, const real tau_dyn_cgs);
-static double H2_cool_func(const real rho_cgs, const real T, const real f_H2, const real m_H_cgs, const double X);
-static double CIE_cool_func(const real rho_cgs, const real T, const real f_H2, const double X);
-static double Ly_cool_func(const real T, const real n_e, const double n_HI);
-static double Brem_cool_func(const real T, const real n_e, const double n_HII);
-
-//-------------------------------------------------------------------------------------------------------
-// Function    :  CoolingFunc
-// Description :  get cooling rate; 
+double rate_k4_func(const real T);
+double rate_k5_func(const real T);
+double f_HII_func(const real n_cgs, const real T);
+double f_H2_func(const real n_cgs, const real T, const real tau_dyn_cgs);
+double H2_cool_func(const real rho_cgs, const real T, const real f_H2, const real m_H_cgs, const double X);
+double CIE_cool_func(const real rho_cgs, const real T, const real f_H2, const double X);
+double Ly_cool_func(const real T, const real n_e, const double n_HI);
+double Brem_cool_func(const real T, const real n_e, const double n_HII);
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_Init_CoolTable
+// Description :  Tabulate the temperature dependence of the POPIII rates
+//
+// Note        :  1. Invoked by Init_GAMER()
+//                2. ln(rate) is tabulated on COOL_TAB_NT nodes uniformly spaced in ln(T) between COOL_TAB_T_MIN and
+//                   COOL_TAB_T_MAX, and linearly interpolated by CoolTab_Lookup()
+//                   --> a lookup costs one LOG and one EXP, shared by all terms of the original analytic rates
+//                   --> rates below COOL_TAB_FLOOR are floored, and temperatures outside the table adopt the
+//                       end values
+//                3. Only the factors depending solely on temperature are tabulated (see CoolTab_Analytic());
+//                   the density dependence is applied analytically by the rate functions
+//                4. OPT__CK_COOL_TABLE compares all tables and the beta-cooling kernel against the analytic
+//                   expressions (see CoolTab_Validate())
+//-------------------------------------------------------------------------------------------------------
+void Hydro_Init_CoolTable()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
+
+
+   CoolTab_lnT0  = log( COOL_TAB_T_MIN );
+   CoolTab__dlnT = ( COOL_TAB_NT - 1 )/( log(COOL_TAB_T_MAX) - CoolTab_lnT0 );
+
+   CoolTab = new double [ COOL_NTAB*COOL_TAB_NT ];
+
+   for (int Tab=0; Tab<COOL_NTAB; Tab++)
+   for (int t=0; t<COOL_TAB_NT; t++)
+   {
+      const double T = exp( CoolTab_lnT0 + t/CoolTab__dlnT );
+
+      CoolTab[ Tab*COOL_TAB_NT + t ] = log(  MAX( CoolTab_Analytic(Tab,T), COOL_TAB_FLOOR )  );
+   }
+
+   if ( OPT__CK_COOL_TABLE )  CoolTab_Validate();
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+
+} // FUNCTION : Hydro_Init_CoolTable
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_End_CoolTable
+// Description :  Free the tables allocated by Hydro_Init_CoolTable()
+//-------------------------------------------------------------------------------------------------------
+void Hydro_End_CoolTable()
+{
+
+   delete [] CoolTab;
+   CoolTab = NULL;
+
+} // FUNCTION : Hydro_End_CoolTable
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_CoolingRate
+// Description :  Get the cooling rate (energy per volume per time) of a pencil of N cells
+//
+// Note        :  1. Beta cooling: cooling time = COOL_BETA * (Keplerian dynamical time at the cylindrical radius)
+//                   --> no cooling below COOL_T_MIN, and the rate is ramped up linearly during the first
+//                       3 outer orbits
+//                2. The dynamical time is taken from CylGeo_t::r_m32, so the kernel involves no transcendental
+//                   function and has no data-dependent branch
+//                   --> the caller should pass contiguous arrays along r so that the loop vectorizes
+//                3. Invoked by CPU_RiemannPredict() for whole i-pencils and by GetFullStepGeoSource() and
+//                   CPU_dtSolver_HydroCFL() for single cells (N=1)
+//                   --> or only by Hydro_Cooling_AdvanceDt() for single cells when OPT__COOL_SUBCYCLE is on
+//
+// Parameter   :  cool_rate : Array to store the cooling rates
+//                Dens      : Mass density
+//                Pres      : Pressure
+//                r_m32     : r^(-3/2) of the target cells (CylGeo_t::r_m32)
+//                N         : Number of cells
 //
-// Parameter   :  cool_rate    : 
-//                PriVar       : 
+// Return      :  cool_rate[]
+//-------------------------------------------------------------------------------------------------------
+void CPU_CoolingRate( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N )
+{
+
+   const double t_relax = 3.0*COOL_T_ORBIT;
+   const double t_curr  = Time[0];
+   const double Ramp    = ( t_curr < t_relax ) ? FABS( t_curr/t_relax ) : 1.0;
+   const double GM      = ExtAcc_AuxArray[3];
+
+   CoolingRate_Beta( cool_rate, Dens, Pres, r_m32, N, (real)( Ramp*sqrt(GM)/(COOL_BETA*(GAMMA-1.0)) ),
+                     (real)( Ramp*TINY_NUMBER ) );
+
+} // FUNCTION : CPU_CoolingRate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CoolingRate_Beta
+// Description :  Beta-cooling kernel of CPU_CoolingRate()
+//
+// Note        :  1. cool_rate = (Pres/(Gamma-1)) / (COOL_BETA*sqrt(r^3/GM)) = Coeff*Pres*r^(-3/2) for
+//                   T = Pres/(Dens*COOL_R) >= COOL_T_MIN, and Floor otherwise
+//
+// Parameter   :  Coeff : sqrt(GM)/(COOL_BETA*(Gamma-1)) times the ramp factor
+//                Floor : Cooling rate below COOL_T_MIN
+//                Others: See CPU_CoolingRate()
+//-------------------------------------------------------------------------------------------------------
+void CoolingRate_Beta( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N,
+                       const real Coeff, const real Floor )
+{
+
+   const real Pres_Dens_Min = (real)( COOL_T_MIN*COOL_R );
+
+   for (int i=0; i<N; i++)
+      cool_rate[i] = ( Pres[i] >= Pres_Dens_Min*Dens[i] ) ? Coeff*Pres[i]*r_m32[i] : Floor;
+
+} // FUNCTION : CoolingRate_Beta
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CoolTab_Lookup
+// Description :  Interpolate the table Tab at ln(T)
+//
+// Note        :  1. Linear interpolation of ln(rate) on the uniform ln(T) grid --> O(1) per lookup
+//                2. ln(T) outside the table is clamped to the end nodes
+//-------------------------------------------------------------------------------------------------------
+double CoolTab_Lookup( const int Tab, const double lnT )
+{
+
+   const double  x = MAX( (lnT-CoolTab_lnT0)*CoolTab__dlnT, 0.0 );
+   const int     t = MIN( (int)x, COOL_TAB_NT-2 );
+   const double  w = MIN( x-t, 1.0 );
+   const double *F = CoolTab + Tab*COOL_TAB_NT + t;
+
+   return exp( F[0] + w*( F[1] - F[0] ) );
+
+} // FUNCTION : CoolTab_Lookup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CoolTab_Analytic
+// Description :  Analytic temperature factors tabulated by Hydro_Init_CoolTable()
+//
+// Note        :  1. COOL_TAB_K5   : rate_k5 in cgs
+//                   COOL_TAB_HII  : (2*pi*m_e*k_B*T/h^2)^1.5*exp(-chi/(k_B*T)) --> f_HII = HII_Fraction( this/n )
+//                   COOL_TAB_H2   : H2 cooling rate per H2 molecule
+//                   COOL_TAB_LY   : Lyman-alpha cooling rate per n_e*n_HI
+//                   COOL_TAB_BREM : Bremsstrahlung cooling rate per n_e*n_HII
+//-------------------------------------------------------------------------------------------------------
+double CoolTab_Analytic( const int Tab, const double T )
+{
+
+   switch ( Tab )
+   {
+      case COOL_TAB_K5 :
+         return 6.5e-7 * pow(T, -0.5) * exp(-52000/T) * (1-exp(-6000/T));
+
+      case COOL_TAB_HII :
+      {
+         const double consts  = 2.86457498307206e+09 ;     // m_e*k_B/h^2 in units of K^(-1) cm^(-2)
+         const double T_ratio = 1.57821462222688e+05 / T ;
+
+         return pow(2*M_PI*consts*T, 1.5) * exp(- T_ratio);
+      }
+
+      case COOL_TAB_H2 :
+      {
+         const double T3 = T*1e-3;
+
+         return (9.5e-22*pow(T3,3.76))/(1+0.12*pow(T3,2.1)) * exp(-pow(0.13/T3,3)) + 3e-24*exp(-0.51/T3)
+                + 6.7e-19*exp(-5.86/T3) + 1.6e-18*exp(-11.7/T3);
+      }
+
+      case COOL_TAB_LY :
+         return 7.5e-19/(1+sqrt(T*1e-5)) * exp(-118348/T);
+
+      case COOL_TAB_BREM :
+         return 1.43e-27*sqrt(T) * (1.1 + 0.34*exp(- SQR(5.5-log10(T))/3.0 ) );
+
+      default :
+         Aux_Error( ERROR_INFO, "unsupported table %d !!\n", Tab );
+         return NULL_REAL;
+   }
+
+} // FUNCTION : CoolTab_Analytic
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CoolTab_Validate
+// Description :  Compare the tabulated rates and the beta-cooling kernel against the analytic expressions
 //
-// NOTE        :  
-//-------------------------------------------------------------------------------------------------------
-void CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]) {
-   
-   // Boltzmann R in the unit of popIII setting
-   const double t_orbit     = 0.79 ;                  // outer orbital time: POPIII: 0.79; SG: 125
-   const double R           = 4.64952804093003e+0 ;   // needed for converting to T (temperature)
-   
-   const double t_curr      = Time[0];
-   const double t_relax     = 3*t_orbit ; 
-   
-   
-   const double GM          = ExtAcc_AuxArray[3] ;
-   const double rho         = PriVar[DENS]; 
-   const double pres        = PriVar[ENGY];
-   const double ie          = PriVar[ENGY]/(GAMMA-1.0) ;
-   const double T           = pres / ( rho * R ) ;
-   const double v_abs       = SQRT( SQR(PriVar[MOMX]) + SQR(PriVar[MOMY]) + SQR(PriVar[MOMZ]) ) ;
-   const double sph_rad     = SQRT( SQR(x_pos[0]) + SQR(x_pos[2]) );
-   
-   //const double tau_dyn     = SQRT( CUBE(sph_rad) / GM );
-   const double tau_dyn     = SQRT( CUBE(x_pos[0]) / GM );
-   
-   // cooling parameter: cooling time = beta * (dynamical time)
-   // relax the system w/ cooling time = 15 dyn_tau
-   const double beta        = 15.0;
-   const double cool_time   = beta * tau_dyn;
-   
-   *cool_rate = ie/cool_time;
-   
-   // below for popIII
-   // check if temperature is smaller than 100K
-   if (T>= 100)   *cool_rate = ie / cool_time ;
-   else           *cool_rate = TINY_NUMBER ;
-   
-   // ramp down cooling? 
-   if (t_curr < t_relax) *cool_rate *= FABS( t_curr/t_relax ) ; 
-   
-
-   
-} // FUNCTION: CoolingFunc
+// Note        :  1. Enabled by OPT__CK_COOL_TABLE and invoked by Hydro_Init_CoolTable()
+//                2. Tables are sampled half way between the nodes, where the interpolation error peaks
+//                   --> samples bracketed by floored nodes are skipped
+//                3. The beta-cooling kernel is evaluated over all base-level radii as a single pencil (with
+//                   GM=1 and without the ramp factor)
+//                4. Terminate the program if any relative error exceeds COOL_TAB_TOLERANCE
+//-------------------------------------------------------------------------------------------------------
+void CoolTab_Validate()
+{
+
+   const char  *TabName[COOL_NTAB] = { "k5", "HII", "H2", "Ly", "Brem" };
+   const double lnFloor            = log( COOL_TAB_FLOOR );
+   const double n_cgs[5]           = { 1.0e0, 1.0e4, 1.0e8, 1.0e12, 1.0e16 };
+   const double tau_dyn_cgs        = 1.0e20;
+
+   double MaxErr[COOL_NTAB+3];
+   bool   Fail = false;
+
+   for (int e=0; e<COOL_NTAB+3; e++)   MaxErr[e] = 0.0;
+
+
+// 1. temperature tables
+   for (int Tab=0; Tab<COOL_NTAB; Tab++)
+   for (int t=0; t<COOL_TAB_NT-1; t++)
+   {
+      const double *F = CoolTab + Tab*COOL_TAB_NT + t;
+
+      if ( F[0] <= lnFloor  ||  F[1] <= lnFloor )  continue;
+
+      const double lnT = CoolTab_lnT0 + (t+0.5)/CoolTab__dlnT;
+      const double Ref = CoolTab_Analytic( Tab, exp(lnT) );
+
+      MaxErr[Tab] = MAX( MaxErr[Tab], fabs(CoolTab_Lookup(Tab,lnT) - Ref)/Ref );
+   }
+
+
+// 2. ionized and molecular fractions, which depend on the tables nonlinearly
+   for (int d=0; d<5; d++)
+   for (int t=0; t<COOL_TAB_NT-1; t++)
+   {
+      const double *F_HII = CoolTab + COOL_TAB_HII*COOL_TAB_NT + t;
+      const double *F_K5  = CoolTab + COOL_TAB_K5 *COOL_TAB_NT + t;
+      const double  T     = exp( CoolTab_lnT0 + (t+0.5)/CoolTab__dlnT );
+
+      if ( F_HII[0] > lnFloor  &&  F_HII[1] > lnFloor )
+      {
+         const double Ref = HII_Fraction( CoolTab_Analytic(COOL_TAB_HII,T)/n_cgs[d] );
+
+         MaxErr[COOL_NTAB+0] = MAX( MaxErr[COOL_NTAB+0], fabs(f_HII_func(n_cgs[d],T) - Ref)/Ref );
+      }
+
+      if ( F_K5[0] > lnFloor  &&  F_K5[1] > lnFloor )
+      {
+         const double Ref = H2_Fraction( n_cgs[d], tau_dyn_cgs, rate_k4_func(T), CoolTab_Analytic(COOL_TAB_K5,T) );
+
+         MaxErr[COOL_NTAB+1] = MAX( MaxErr[COOL_NTAB+1], fabs(f_H2_func(n_cgs[d],T,tau_dyn_cgs) - Ref)/Ref );
+      }
+   }
+
+
+// 3. beta-cooling kernel
+   const CylGeo_t &Geo  = CylGeo[0];
+   const int       N    = NX0_TOT[0];
+   const real      Dens = 1.0;
+   const real      Pres = 2.0*COOL_T_MIN*COOL_R;
+
+   real *Dens_1D = new real [N];
+   real *Pres_1D = new real [N];
+   real *Rate_1D = new real [N];
+
+   for (int i=0; i<N; i++)
+   {
+      Dens_1D[i] = Dens;
+      Pres_1D[i] = Pres;
+   }
+
+   CoolingRate_Beta( Rate_1D, Dens_1D, Pres_1D, Geo.r_m32+Geo.NGhost, N, (real)( 1.0/(COOL_BETA*(GAMMA-1.0)) ),
+                     TINY_NUMBER );
+
+   for (int i=0; i<N; i++)
+   {
+      const double r   = Geo.r[ Geo.NGhost + i ];
+      const double Ref = Pres/(GAMMA-1.0) / ( COOL_BETA*sqrt(CUBE(r)) );
+
+      MaxErr[COOL_NTAB+2] = MAX( MaxErr[COOL_NTAB+2], fabs(Rate_1D[i] - Ref)/Ref );
+   }
+
+   delete [] Dens_1D;
+   delete [] Pres_1D;
+   delete [] Rate_1D;
+
+
+// 4. report
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "   Maximum relative errors of the cooling tables (tolerance = %13.7e):\n", COOL_TAB_TOLERANCE );
+
+      for (int Tab=0; Tab<COOL_NTAB; Tab++)
+      Aux_Message( stdout, "      %-10s : %13.7e\n", TabName[Tab], MaxErr[Tab] );
+      Aux_Message( stdout, "      %-10s : %13.7e\n", "f_HII",      MaxErr[COOL_NTAB+0] );
+      Aux_Message( stdout, "      %-10s : %13.7e\n", "f_H2",       MaxErr[COOL_NTAB+1] );
+      Aux_Message( stdout, "      %-10s : %13.7e\n", "beta",       MaxErr[COOL_NTAB+2] );
+   }
+
+   for (int e=0; e<COOL_NTAB+3; e++)   Fail |= ( MaxErr[e] > COOL_TAB_TOLERANCE );
+
+   if ( Fail )
+      Aux_Error( ERROR_INFO, "cooling tables exceed the tolerance %13.7e (consider increasing COOL_TAB_NT) !!\n",
+                 COOL_TAB_TOLERANCE );
+
+} // FUNCTION : CoolTab_Validate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  HII_Fraction
+// Description :  Ionized fraction of the Saha equation x^2/(1-x) = c1
+//-------------------------------------------------------------------------------------------------------
+double HII_Fraction( const double c1 ) {
+
+   return 0.5*( -c1 + sqrt(c1*c1 + 4.0*c1) );
+}
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  H2_Fraction
+// Description :  Molecular fraction limited by the chemical time-scale 1/(k4*n^2)
+//-------------------------------------------------------------------------------------------------------
+double H2_Fraction( const double n_cgs, const double tau_dyn_cgs, const double k4, const double k5 ) {
+   const double coeff = k5/(2*k4);
+
+   double n_HI, n_H2_estimate, n_H2, tau_chem;
+
+   n_HI          = 0.5*( -coeff + sqrt(coeff*coeff + 4*coeff*n_cgs) ) ;
+   n_H2_estimate = (k4/k5)*SQR(n_HI) ;
+
+   tau_chem = 1 / ( k4*SQR(n_cgs) ) ;
+   n_H2     = n_H2_estimate * exp(-tau_chem / tau_dyn_cgs);
+
+   return MAX(2*n_H2 / n_cgs, 1.0e-8) ;
+}
 
 
 // POPIII
+// --> the temperature factors are interpolated from the tables of Hydro_Init_CoolTable()
 //-------------------------------------------------------------------------------------------------------
 // Function    :  rate_k4 in cgs
 //-------------------------------------------------------------------------------------------------------
 double rate_k4_func(const real T) {
-   double rate_k4 = 5.5e-29 * POW(T, -1) ;
-   
+   double rate_k4 = 5.5e-29 / T ;
+
    return rate_k4 ;
 }
 
@@ -82,56 +397,37 @@ double rate_k4_func(const real T) {
 // Function    :  rate_k5 in cgs
 //-------------------------------------------------------------------------------------------------------
 double rate_k5_func(const real T) {
-   double rate_k5 = 6.5e-7 * POW(T, -0.5) * EXP(-52000/T) * (1-EXP(-6000/T))  ;   
-   
-   return rate_k5 ;
+
+   return CoolTab_Lookup( COOL_TAB_K5, log(T) ) ;
 }
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  f_HII 
+// Function    :  f_HII
 //-------------------------------------------------------------------------------------------------------
 double f_HII_func(const real n_cgs, const real T) {
-   const double consts  = 2.86457498307206e+09 ;     // m_e*k_B/h^2 in units of K^(-1) cm^(-2)
-   const double T_ratio = 1.57821462222688e+05 / T ;
-   
-   double c1 = POW(2*M_PI*consts*T, 1.5) / n_cgs * EXP(- T_ratio); 
-   double x  = 0.5*( -c1 + SQRT(c1*c1 + 4.0*c1) );
-      
-   return x ;
+
+   return HII_Fraction( CoolTab_Lookup(COOL_TAB_HII, log(T)) / n_cgs );
 }
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  f_H2
 //-------------------------------------------------------------------------------------------------------
 double f_H2_func(const real n_cgs, const real T, const real tau_dyn_cgs) {
-   const double k4    = rate_k4_func(T);
-   const double k5    = rate_k5_func(T); 
-   const double coeff = k5/(2*k4);
-   
-   double n_HI, n_H2_estimate, n_H2, tau_chem;
-   
-   n_HI          = 0.5*( -coeff + SQRT(coeff*coeff + 4*coeff*n_cgs) ) ;
-   n_H2_estimate = (k4/k5)*SQR(n_HI) ;
-   
-   tau_chem = 1 / ( k4*SQR(n_cgs) ) ;
-   n_H2     = n_H2_estimate * EXP(-tau_chem / tau_dyn_cgs);
-   
-   return FMAX(2*n_H2 / n_cgs, 1.0e-8) ;
+
+   return H2_Fraction( n_cgs, tau_dyn_cgs, rate_k4_func(T), rate_k5_func(T) );
 }
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  H2_cool rate in erg cm^(-3) s^(-1)
 //-------------------------------------------------------------------------------------------------------
 double H2_cool_func(const real rho_cgs, const real T, const real f_H2, const real m_H_cgs, const double X) {
-   const double T3 = T*1e-3;
    double rate;
-   
+
    // rate in erg g-1 s-1
-   rate = X*f_H2/m_H_cgs*( (9.5e-22*POW(T3,3.76))/(1+0.12*POW(T3,2.1)) * EXP(-POW(0.13/T3,3)) + 3e-24*EXP(-0.51/T3)
-                          + 6.7e-19*EXP(-5.86/T3) + 1.6e-18*EXP(-11.7/T3) ) ;    
+   rate = X*f_H2/m_H_cgs*CoolTab_Lookup( COOL_TAB_H2, log(T) ) ;
    // rate = rate * rho
    rate *= rho_cgs ;
-   
+
    return rate;
 }
 
@@ -139,12 +435,12 @@ double H2_cool_func(const real rho_cgs, const real T, const real f_H2, const rea
 // Function    :  CIE_cool rate in erg cm^(-3) s^(-1)
 //-------------------------------------------------------------------------------------------------------
 double CIE_cool_func(const real rho_cgs, const real T, const real f_H2, const double X) {
-   
+
    // rate in erg g-1 s-1
-   double rate = 7.2e-2*rho_cgs*POW(T, 4)*X*f_H2 ;
+   double rate = 7.2e-2*rho_cgs*SQR(SQR(T))*X*f_H2 ;
    // rate = rate * rho
    rate *= rho_cgs;
-   
+
    return rate;
 }
 
@@ -152,11 +448,10 @@ double CIE_cool_func(const real rho_cgs, const real T, const real f_H2, const do
 // Function    :  Ly_cool rate in erg cm^(-3) s^(-1)
 //-------------------------------------------------------------------------------------------------------
 double Ly_cool_func(const real T, const real n_e, const double n_HI) {
-   const double T5 = T*1e-5;
-   
+
    // rate in erg cm-3 s-1
-   double rate = 7.5e-19/(1+SQRT(T5)) * EXP(-118348/T) *n_e * n_HI ;
-   
+   double rate = CoolTab_Lookup( COOL_TAB_LY, log(T) ) *n_e * n_HI ;
+
    return rate;
 }
 
@@ -164,10 +459,10 @@ double Ly_cool_func(const real T, const real n_e, const double n_HI) {
 // Function    :  Brem_cool rate in erg cm^(-3) s^(-1)
 //-------------------------------------------------------------------------------------------------------
 double Brem_cool_func(const real T, const real n_e, const double n_HII) {
-   
+
    // rate in erg cm-3 s-1
-   double rate = 1.43e-27*SQRT(T) * (1.1 + 0.34*EXP(- SQR(5.5-log10(T))/3.0 ) ) * n_e * n_HII ;
-   
+   double rate = CoolTab_Lookup( COOL_TAB_BREM, log(T) ) * n_e * n_HII ;
+
    return rate;
 }
 
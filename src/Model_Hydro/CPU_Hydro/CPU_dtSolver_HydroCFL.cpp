@@ -3,7 +3,11 @@
 #if ( !defined GPU  &&  MODEL == HYDRO )
 
 #ifdef COOLING
-extern void CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]);
+extern void CPU_CoolingRate( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N );
+#endif
+#if ( COORDINATE == CYLINDRICAL )
+extern bool CPU_OrbAdv_GetVphi( const double Corner[], const real dh[], const int NGhost, const int loop_size, real Vphi[] );
+extern const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
 #endif
 
 
@@ -18,6 +22,9 @@ extern void CoolingFunc(real* cool_rate, const real PriVar[], const real x_pos[]
 //                   --> We convert dt back to the physical time interval, which equals "delta(scale_factor)"
 //                       in the comoving coordinates, in Mis_GetTimeStep()
 //                2. time-step is estimated by the stability criterion from the von Neumann stability analysis
+//                3. For OPT__ORBITAL_ADV, the azimuthal velocity is measured relative to OrbAdv_Vphi, and the
+//                   shift of OrbAdv_Vphi between neighboring rings is limited to one cell per time-step
+//                4. For OPT__CYL_RGRID, the radial signal speed is divided by the local cell width dr
 //
 // Parameter   :  dt_Array     : Array to store the minimum dt in each target patch
 //                Flu_Array    : Array storing the prepared fluid data of each target patch
@@ -49,10 +56,16 @@ void CPU_dtSolver_HydroCFL( real dt_Array[], const real Flu_Array[][NCOMP_FLUID]
    {
       MaxCFL = (real)0.0;
       real _dh[3] = { (real)1.0/dh[0], (real)1.0/dh[1], (real)1.0/dh[2] };
-      real x_pos[3] ;
       int ID; 
 #     ifdef COOLING
-      real _dt_cool, cool_rate, PriVar[NCOMP_TOTAL];
+      real _dt_cool, cool_rate;
+#     endif
+#     if ( COORDINATE == CYLINDRICAL )
+      real Vphi[ SQR(PS1+1) ];
+      const bool OrbAdv = CPU_OrbAdv_GetVphi( Corner_Array[p], dh, 0, PS1+1, Vphi );
+      const bool RGrid  = ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM );
+      int  ir0;
+      const CylGeo_t *Geo = CylGeo_Lookup( Corner_Array[p], dh, PS2, ir0 );
 #     endif
 
       for (int k=0; k<PS1; k++)
@@ -63,17 +76,26 @@ void CPU_dtSolver_HydroCFL( real dt_Array[], const real Flu_Array[][NCOMP_FLUID]
          for (int v=0; v<NCOMP_FLUID; v++)   fluid[v] = Flu_Array[p][v][ID];
          
 #        if ( COORDINATE == CYLINDRICAL )
-         x_pos[0] = Corner_Array[p][0] + i*dh[0] ;
-         x_pos[1] = Corner_Array[p][1] + j*dh[1] ;
-         x_pos[2] = Corner_Array[p][2] + k*dh[2] ;
-         
-         const real radius = Corner_Array[p][0] + i*dh[0] ;
+         const real radius   = ( RGrid ) ? Geo->r[ ir0+i   ] : Corner_Array[p][0] + i*dh[0] ;
+         const real radius_R = ( RGrid ) ? Geo->r[ ir0+i+1 ] : radius + dh[0] ;
+         _dh[0] = Geo->dh_dr[ ir0+i ] / dh[0] ;
          _dh[1] = (real)1.0/ ( dh[1]*radius ) ;
 #        endif
 
         _Rho  = (real)1.0 / fluid[DENS];
          Vx   = FABS( fluid[MOMX] )*_Rho;
          Vy   = FABS( fluid[MOMY] )*_Rho;
+#        if ( COORDINATE == CYLINDRICAL )
+         if ( OrbAdv )
+         {
+            const real W  = Vphi[ k*(PS1+1) + i ];
+            const real WR = Vphi[ k*(PS1+1) + i+1 ];
+            const real WZ = Vphi[ (k+1)*(PS1+1) + i ];
+
+            Vy     = FABS( fluid[MOMY]*_Rho - W );
+            MaxCFL = FMAX( FMAX( FABS(WR/radius_R - W/radius), FABS(WZ - W)/radius )/dh[1], MaxCFL );
+         }
+#        endif
          Vz   = FABS( fluid[MOMZ] )*_Rho;
          Pres = CPU_GetPressure( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY],
                                  Gamma_m1, CheckMinPres_Yes, MinPres );
@@ -89,16 +111,14 @@ void CPU_dtSolver_HydroCFL( real dt_Array[], const real Flu_Array[][NCOMP_FLUID]
          MaxCFL  = FMAX( CurrCFL, MaxCFL );
          
          //### may also need cool_dt_safty: _dt_cool * safty (safty > 1; probably 10)
+//       --> no cooling constraint when OPT__COOL_SUBCYCLE is on since cooling is then subcycled by Hydro_Cooling_AdvanceDt()
 #        ifdef COOLING
-         PriVar[0] = fluid[DENS];
-         PriVar[1] = Vx;
-         PriVar[2] = Vy;
-         PriVar[3] = Vz;
-         PriVar[4] = Pres;
-         
-         CoolingFunc(&cool_rate, PriVar, x_pos);
-         _dt_cool = cool_rate * (Gamma-1.0) / Pres ;
-         MaxCFL   = FMAX(_safety_cool*_dt_cool, MaxCFL) ;
+         if ( !OPT__COOL_SUBCYCLE )
+         {
+            CPU_CoolingRate( &cool_rate, &fluid[DENS], &Pres, Geo->r_m32+ir0+i, 1 );
+            _dt_cool = cool_rate * (Gamma-1.0) / Pres ;
+            MaxCFL   = FMAX(_safety_cool*_dt_cool, MaxCFL) ;
+         }
 #        endif // #ifdef COOLING
          
 #        endif
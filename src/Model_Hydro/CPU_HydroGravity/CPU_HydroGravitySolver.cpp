@@ -2,6 +2,10 @@
 
 #if ( !defined GPU  &&  MODEL == HYDRO  &&  defined GRAVITY )
 
+#if ( COORDINATE == CYLINDRICAL )
+extern const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
+#endif
+
 
 
 
@@ -14,6 +18,8 @@
 //                   --> This consistency breaks only for cells with the dual-energy status labelled
 //                       as DE_UPDATED_BY_ETOT_GRA
 //                   --> We restore this consistency in Gra_Close()
+//                2. For OPT__CYL_RGRID, the radial potential gradient is converted from per dh to per dr by
+//                   CylGeo_t::dh_dr, and the external acceleration is evaluated at the mapped radius
 //
 // Parameter   :  Flu_Array_New    : Array to store the input and output fluid variables
 //                Pot_Array_New    : Array storing the input potential (at the current step)
@@ -80,22 +86,23 @@ void CPU_HydroGravitySolver(       real Flu_Array_New[][GRA_NIN][PS1][PS1][PS1],
 #  else
    real AccNew[3], PxNew, PyNew, PzNew, RhoNew;
 #  endif
-   real Eint_in, Ek_out, _Rho2;
+   real Eint_in, Ek_out, _Rho2, GraR;
    double x, y, z;
    
    double geo_factor = 1.0 ;
 #  if (COORDINATE == CYLINDRICAL)
    double radius ;
+   const bool RGrid = ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM );
 #  endif
 
 
 // loop over all patches
 #  ifdef UNSPLIT_GRAVITY
 #  pragma omp parallel for private( AccNew, AccOld, PxNew, PxOld, PyNew, PyOld, PzNew, PzOld, RhoNew, RhoOld, \
-                                    x, y, z, Eint_in, Ek_out, _Rho2, radius, geo_factor ) schedule( runtime )
+                                    x, y, z, Eint_in, Ek_out, _Rho2, radius, geo_factor, GraR ) schedule( runtime )
 #  else
 #  pragma omp parallel for private( AccNew, PxNew, PyNew, PzNew, RhoNew, \
-                                    x, y, z, Eint_in, Ek_out, _Rho2, radius, geo_factor ) schedule( runtime )
+                                    x, y, z, Eint_in, Ek_out, _Rho2, radius, geo_factor, GraR ) schedule( runtime )
 #  endif
    for (int P=0; P<NPatch; P++)
    {
@@ -119,8 +126,20 @@ void CPU_HydroGravitySolver(       real Flu_Array_New[][GRA_NIN][PS1][PS1][PS1],
          AccOld[2] = (real)0.0;
 #        endif
          
+         GraR = Gra_Const[0];
+
 #        if (COORDINATE == CYLINDRICAL)
          radius     = Corner_Array[P][0] + (double)(ii*dh[0]);
+
+         if ( RGrid )
+         {
+            int ir0;
+            const CylGeo_t *Geo = CylGeo_Lookup( Corner_Array[P], dh, PS2, ir0 );
+
+            radius = 0.5*( Geo->rFace[ ir0+ii ] + Geo->rFace[ ir0+ii+1 ] );
+            GraR   = Gra_Const[0]*Geo->dh_dr[ ir0+ii ];
+         }
+
          geo_factor = 1.0 / radius; 
 #        endif
 
@@ -130,6 +149,9 @@ void CPU_HydroGravitySolver(       real Flu_Array_New[][GRA_NIN][PS1][PS1][PS1],
             z = Corner_Array[P][2] + (double)(kk*dh[2]);
             y = Corner_Array[P][1] + (double)(jj*dh[1]);
             x = Corner_Array[P][0] + (double)(ii*dh[0]);
+#           if (COORDINATE == CYLINDRICAL)
+            if ( RGrid )   x = radius;
+#           endif
 
             CPU_ExternalAcc( AccNew, x, y, z, TimeNew, ExtAcc_AuxArray );
             for (int d=0; d<3; d++)    AccNew[d] *= dt;
@@ -145,7 +167,7 @@ void CPU_HydroGravitySolver(       real Flu_Array_New[][GRA_NIN][PS1][PS1][PS1],
          {
             if ( P5_Gradient )
             {
-               AccNew[0] += Gra_Const[0] * ( -         Pot_Array_New[P][k1  ][j1  ][i1+2] +         Pot_Array_New[P][k1  ][j1  ][i1-2]
+               AccNew[0] += GraR         * ( -         Pot_Array_New[P][k1  ][j1  ][i1+2] +         Pot_Array_New[P][k1  ][j1  ][i1-2]
                                              + Const_8*Pot_Array_New[P][k1  ][j1  ][i1+1] - Const_8*Pot_Array_New[P][k1  ][j1  ][i1-1] );
                AccNew[1] += Gra_Const[1] * ( -         Pot_Array_New[P][k1  ][j1+2][i1  ] +         Pot_Array_New[P][k1  ][j1-2][i1  ]
                                              + Const_8*Pot_Array_New[P][k1  ][j1+1][i1  ] - Const_8*Pot_Array_New[P][k1  ][j1-1][i1  ] ) * geo_factor;
@@ -153,7 +175,7 @@ void CPU_HydroGravitySolver(       real Flu_Array_New[][GRA_NIN][PS1][PS1][PS1],
                                              + Const_8*Pot_Array_New[P][k1+1][j1  ][i1  ] - Const_8*Pot_Array_New[P][k1-1][j1  ][i1  ] );
 
 #              ifdef UNSPLIT_GRAVITY
-               AccOld[0] += Gra_Const[0] * ( -         Pot_Array_USG[P][k2  ][j2  ][i2+2] +         Pot_Array_USG[P][k2  ][j2  ][i2-2]
+               AccOld[0] += GraR         * ( -         Pot_Array_USG[P][k2  ][j2  ][i2+2] +         Pot_Array_USG[P][k2  ][j2  ][i2-2]
                                              + Const_8*Pot_Array_USG[P][k2  ][j2  ][i2+1] - Const_8*Pot_Array_USG[P][k2  ][j2  ][i2-1] );
                AccOld[1] += Gra_Const[1] * ( -         Pot_Array_USG[P][k2  ][j2+2][i2  ] +         Pot_Array_USG[P][k2  ][j2-2][i2  ]
                                              + Const_8*Pot_Array_USG[P][k2  ][j2+1][i2  ] - Const_8*Pot_Array_USG[P][k2  ][j2-1][i2  ] ) * geo_factor;
@@ -164,12 +186,12 @@ void CPU_HydroGravitySolver(       real Flu_Array_New[][GRA_NIN][PS1][PS1][PS1],
 
             else
             {
-               AccNew[0] += Gra_Const[0] * ( Pot_Array_New[P][k1  ][j1  ][i1+1] - Pot_Array_New[P][k1  ][j1  ][i1-1] );
+               AccNew[0] += GraR         * ( Pot_Array_New[P][k1  ][j1  ][i1+1] - Pot_Array_New[P][k1  ][j1  ][i1-1] );
                AccNew[1] += Gra_Const[1] * ( Pot_Array_New[P][k1  ][j1+1][i1  ] - Pot_Array_New[P][k1  ][j1-1][i1  ] ) * geo_factor;
                AccNew[2] += Gra_Const[2] * ( Pot_Array_New[P][k1+1][j1  ][i1  ] - Pot_Array_New[P][k1-1][j1  ][i1  ] );
 
 #              ifdef UNSPLIT_GRAVITY
-               AccOld[0] += Gra_Const[0] * ( Pot_Array_USG[P][k2  ][j2  ][i2+1] - Pot_Array_USG[P][k2  ][j2  ][i2-1] );
+               AccOld[0] += GraR         * ( Pot_Array_USG[P][k2  ][j2  ][i2+1] - Pot_Array_USG[P][k2  ][j2  ][i2-1] );
                AccOld[1] += Gra_Const[1] * ( Pot_Array_USG[P][k2  ][j2+1][i2  ] - Pot_Array_USG[P][k2  ][j2-1][i2  ] ) * geo_factor;
                AccOld[2] += Gra_Const[2] * ( Pot_Array_USG[P][k2+1][j2  ][i2  ] - Pot_Array_USG[P][k2-1][j2  ][i2  ] );
 #              endif
@@ -2,6 +2,9 @@
 
 #if ( !defined GPU  &&  MODEL == HYDRO  &&  defined GRAVITY )
 
+#if ( COORDINATE == CYLINDRICAL )
+extern const CylGeo_t* CylGeo_Lookup( const double Corner[], const real dh[], const int loop_size, int &i0 );
+#endif
 
 
 
@@ -16,6 +19,8 @@
 //                   --> We convert dt back to the physical time interval, which equals "delta(scale_factor)"
 //                       in the comoving coordinates, in Mis_GetTimeStep()
 //                2. time-step is estimated by the free-fall time of the maximum gravitational acceleration
+//                3. For OPT__CYL_RGRID, the radius is taken from CylGeo_t::r, and the radial gradient and cell width
+//                   are converted from the uniform index space by CylGeo_t::dh_dr
 //
 // Parameter   :  dt_Array        : Array to store the minimum dt in each target patch
 //                Pot_Array       : Array storing the prepared potential data of each target patch
@@ -57,19 +62,22 @@ void CPU_dtSolver_HydroGravity( real dt_Array[],
    real   Acc[3], dx_Acc_Min;
    double x, y, z;
    int    id;
-   
-   real dx[3] = {dh[0], dh[1], dh[2]} ;
-   real geo_factor = (real) 1.0 ;
-   
-#  if (COORDINATE == CYLINDRICAL)
-   real radius ;
-#  endif
 
 
 // loop over all patches
 #  pragma omp parallel for private( Acc, dx_Acc_Min, x, y, z, id ) schedule( runtime )
    for (int P=0; P<NPatch; P++)
    {
+      real dx[3]      = { dh[0], dh[1], dh[2] };
+      real geo_factor = (real)1.0;
+      real Gra_ConstR = Gra_Const[0];    // radial gradient constant of the current cell
+#     if (COORDINATE == CYLINDRICAL)
+      real radius, dh_dr;
+      int  ir0;
+      const bool      RGrid = ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM );
+      const CylGeo_t *Geo   = CylGeo_Lookup( Corner_Array[P], dh, PS2, ir0 );
+#     endif
+
       dx_Acc_Min = HUGE_NUMBER;
 
       for (int k=GRA_GHOST_SIZE, kk=0; k<GRA_NXT-GRA_GHOST_SIZE; k++, kk++)
@@ -82,8 +90,11 @@ void CPU_dtSolver_HydroGravity( real dt_Array[],
          Acc[2] = (real)0.0;
          
 #        if (COORDINATE == CYLINDRICAL)
-         radius     = Corner_Array[P][0] + (double)(ii*dh[0]);
+         radius     = ( RGrid ) ? Geo->r[ ir0+ii ] : Corner_Array[P][0] + (double)(ii*dh[0]);
+         dh_dr      = Geo->dh_dr[ ir0+ii ];
          geo_factor = (real)1.0 / radius; 
+         dx[0]      = dh[0] / dh_dr ;
+         Gra_ConstR = Gra_Const[0] * dh_dr ;
          dx[1]      = radius * dh[1] ;
 #        endif
 
@@ -93,6 +104,9 @@ void CPU_dtSolver_HydroGravity( real dt_Array[],
             x = Corner_Array[P][0] + (double)ii*dh[0];
             y = Corner_Array[P][1] + (double)jj*dh[1];
             z = Corner_Array[P][2] + (double)kk*dh[2];
+#           if (COORDINATE == CYLINDRICAL)
+            x = radius;
+#           endif
 
             CPU_ExternalAcc( Acc, x, y, z, ExtAcc_Time, ExtAcc_AuxArray );
          }
@@ -102,7 +116,7 @@ void CPU_dtSolver_HydroGravity( real dt_Array[],
          {
             if ( P5_Gradient )
             {
-               Acc[0] += Gra_Const[0] * ( -         Pot_Array[P][ id + did2[0] ] +         Pot_Array[P][ id - did2[0] ]
+               Acc[0] += Gra_ConstR   * ( -         Pot_Array[P][ id + did2[0] ] +         Pot_Array[P][ id - did2[0] ]
                                           + Const_8*Pot_Array[P][ id + did1[0] ] - Const_8*Pot_Array[P][ id - did1[0] ] );
                Acc[1] += Gra_Const[1] * ( -         Pot_Array[P][ id + did2[1] ] +         Pot_Array[P][ id - did2[1] ]
                                           + Const_8*Pot_Array[P][ id + did1[1] ] - Const_8*Pot_Array[P][ id - did1[1] ] ) * geo_factor;
@@ -112,7 +126,7 @@ void CPU_dtSolver_HydroGravity( real dt_Array[],
 
             else
             {
-               Acc[0] += Gra_Const[0] * ( Pot_Array[P][ id + did1[0] ] - Pot_Array[P][ id - did1[0] ] );
+               Acc[0] += Gra_ConstR   * ( Pot_Array[P][ id + did1[0] ] - Pot_Array[P][ id - did1[0] ] );
                Acc[1] += Gra_Const[1] * ( Pot_Array[P][ id + did1[1] ] - Pot_Array[P][ id - did1[1] ] ) * geo_factor ;
                Acc[2] += Gra_Const[2] * ( Pot_Array[P][ id + did1[2] ] - Pot_Array[P][ id - did1[2] ] );
             }
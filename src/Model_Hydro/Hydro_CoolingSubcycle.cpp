@@ -0,0 +1,186 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  defined COOLING )
+
+extern void CPU_CoolingRate( real cool_rate[], const real Dens[], const real Pres[], const real r_m32[], const int N );
+
+static double Cool_Subcycle( const real Dens, const double Pres, const real *r_m32, const double dt, int &NSub );
+static double Cool_InvTime( const real Dens, const double Pres, const real *r_m32 );
+
+
+// cooling substep statistics of this rank
+// --> accumulated by Hydro_Cooling_AdvanceDt() and reset by Aux_Record_CoolSubcycle()
+long Cool_NCell  [NLEVEL];
+long Cool_NSub   [NLEVEL];
+int  Cool_NSubMax[NLEVEL];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_Cooling_AdvanceDt
+// Description :  Advance the internal energy of all real patches at lv by the cooling source term with
+//                per-cell adaptive subcycling
+//
+// Note        :  1. Enabled by OPT__COOL_SUBCYCLE and invoked by EvolveLevel() after the fluid and gravity
+//                   updates (operator splitting)
+//                   --> the in-stage cooling source of the fluid solver and the cooling time-step criterion
+//                       are disabled, so the hydro time-step is set by the CFL condition alone
+//                2. Each cell is integrated independently by Cool_Subcycle() at fixed density and kinetic energy
+//                3. The number of substeps of each patch is stored in patch_t::CoolNSub and used as the
+//                   load-balance weighting of cooling (see COOL_LB_WEIGHT and LB_EstimateWorkload_AllPatchGroup())
+//                   --> statistics are recorded by Aux_Record_CoolSubcycle()
+//                4. Dual-energy variable is updated to be consistent with the new pressure
+//
+// Parameter   :  lv      : Target refinement level
+//                TimeNew : Target physical time to reach
+//                TimeOld : Physical time before update
+//                dt      : Time interval to advance solution
+//                SaveSg  : Sandglass to store the updated data
+//-------------------------------------------------------------------------------------------------------
+void Hydro_Cooling_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg )
+{
+
+   const bool      CheckMinPres_Yes = true;
+   const real      Gamma_m1         = GAMMA - (real)1.0;
+   const real     _Gamma_m1         = (real)1.0 / Gamma_m1;
+   const int       NPatch           = amr->NPatchComma[lv][1];
+   const CylGeo_t &Geo              = CylGeo[lv];
+
+   long NSub_Sum = 0;
+   int  NSub_Max = 0;
+
+
+#  pragma omp parallel for reduction( +:NSub_Sum ) reduction( max:NSub_Max ) schedule( runtime )
+   for (int PID=0; PID<NPatch; PID++)
+   {
+      real (*fluid)[PS1][PS1][PS1] = amr->patch[SaveSg][lv][PID]->fluid;
+      const real *r_m32            = Geo.r_m32 + amr->patch[0][lv][PID]->corner[0]/amr->scale[lv] + Geo.NGhost;
+      int   NSub_Patch             = 0;
+
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      for (int i=0; i<PS1; i++)
+      {
+         const real Dens = fluid[DENS][k][j][i];
+         const real MomX = fluid[MOMX][k][j][i];
+         const real MomY = fluid[MOMY][k][j][i];
+         const real MomZ = fluid[MOMZ][k][j][i];
+         const real Ek   = (real)0.5*( SQR(MomX) + SQR(MomY) + SQR(MomZ) )/Dens;
+
+         real Pres = CPU_GetPressure( Dens, MomX, MomY, MomZ, fluid[ENGY][k][j][i], Gamma_m1, CheckMinPres_Yes, MIN_PRES );
+         int  NSub;
+
+         Pres = (real)Cool_Subcycle( Dens, Pres, r_m32+i, dt, NSub );
+         Pres = CPU_CheckMinPres( Pres, MIN_PRES );
+
+         fluid[ENGY][k][j][i] = Pres*_Gamma_m1 + Ek;
+
+#        ifdef DUAL_ENERGY
+#        if   ( DUAL_ENERGY == DE_ENPY )
+         fluid[ENPY][k][j][i] = CPU_DensPres2Entropy( Dens, Pres, Gamma_m1 );
+#        elif ( DUAL_ENERGY == DE_EINT )
+#        error : DE_EINT is NOT supported yet !!
+#        endif
+#        endif
+
+         NSub_Patch += NSub;
+         NSub_Max    = MAX( NSub_Max, NSub );
+      } // k,j,i
+
+      amr->patch[0][lv][PID]->CoolNSub = NSub_Patch;
+      NSub_Sum                        += NSub_Patch;
+   } // for (int PID=0; PID<NPatch; PID++)
+
+
+   Cool_NCell  [lv] += (long)NPatch*CUBE(PS1);
+   Cool_NSub   [lv] += NSub_Sum;
+   Cool_NSubMax[lv]  = MAX( Cool_NSubMax[lv], NSub_Max );
+
+} // FUNCTION : Hydro_Cooling_AdvanceDt
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Cool_Subcycle
+// Description :  Integrate dP/dt = -(Gamma-1)*cool_rate of a single cell over dt
+//
+// Note        :  1. Semi-implicit (linearized backward Euler) update P' = P/(1+h/t_cool), which is
+//                   unconditionally stable and keeps the pressure positive
+//                2. Error controller by step doubling: a substep h is accepted if one step of h and two steps
+//                   of h/2 agree to a relative error COOL_SUBCYCLE_TOL, and h is rescaled by sqrt(TOL/error)
+//                   for the first-order scheme
+//                   --> the initial h assumes an error (h/t_cool)^2/2
+//                3. The COOL_SUBCYCLE_NMAX-th substep covers the remaining interval regardless of the error
+//
+// Parameter   :  Dens  : Mass density
+//                Pres  : Pressure before cooling
+//                r_m32 : r^(-3/2) of the cell (CylGeo_t::r_m32)
+//                dt    : Time interval
+//                NSub  : Number of substeps taken, including the rejected ones
+//
+// Return      :  Pressure after cooling, NSub
+//-------------------------------------------------------------------------------------------------------
+double Cool_Subcycle( const real Dens, const double Pres, const real *r_m32, const double dt, int &NSub )
+{
+
+   const double Tol  = COOL_SUBCYCLE_TOL;
+   const double Safe = 0.9;
+
+   double P      = Pres;
+   double t      = 0.0;
+   double InvT   = Cool_InvTime( Dens, P, r_m32 );
+   double h      = ( InvT*dt > sqrt(2.0*Tol) ) ? sqrt(2.0*Tol)/InvT : dt;
+   bool   Finish = false;
+
+   NSub = 0;
+
+   while ( !Finish )
+   {
+      const bool Last = ( h >= dt-t  ||  NSub+1 >= COOL_SUBCYCLE_NMAX );
+
+      if ( Last )    h = dt - t;
+
+      const double P1  = P/( 1.0 + h*InvT );
+      const double Ph  = P/( 1.0 + 0.5*h*InvT );
+      const double P2  = Ph/( 1.0 + 0.5*h*Cool_InvTime(Dens,Ph,r_m32) );
+      const double Err = fabs( P1 - P2 )/P2;
+
+      NSub ++;
+
+      if ( Err <= Tol  ||  NSub >= COOL_SUBCYCLE_NMAX )
+      {
+         P      = P2;
+         t     += h;
+         InvT   = Cool_InvTime( Dens, P, r_m32 );
+         Finish = Last;
+      }
+
+      h *= MIN(  4.0, MAX( 0.25, Safe*sqrt( Tol/MAX(Err,TINY_NUMBER) ) )  );
+   }
+
+   return P;
+
+} // FUNCTION : Cool_Subcycle
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Cool_InvTime
+// Description :  Inverse cooling time (Gamma-1)*cool_rate/Pres of a single cell (see CPU_CoolingRate())
+//-------------------------------------------------------------------------------------------------------
+double Cool_InvTime( const real Dens, const double Pres, const real *r_m32 )
+{
+
+   const real Pres_r = (real)Pres;
+   real       cool_rate;
+
+   CPU_CoolingRate( &cool_rate, &Dens, &Pres_r, r_m32, 1 );
+
+   return ( GAMMA - 1.0 )*cool_rate/Pres;
+
+} // FUNCTION : Cool_InvTime
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  defined COOLING )
@@ -115,16 +115,29 @@ void Hydro_Init_ByFunction_AssignData( const int lv )
       for (int k=0; k<PS1; k++)  {  Z0 = amr->patch[0][lv][PID]->EdgeL[2] + k*dh[2] + 0.5*dh_sub[2];
       for (int j=0; j<PS1; j++)  {  Y0 = amr->patch[0][lv][PID]->EdgeL[1] + j*dh[1] + 0.5*dh_sub[1];
       for (int i=0; i<PS1; i++)  {  X0 = amr->patch[0][lv][PID]->EdgeL[0] + i*dh[0] + 0.5*dh_sub[0];
+
+         double dX_sub = dh_sub[0];
          
 #if ( COORDINATE == CYLINDRICAL )
          _geo = 1.0 / ( amr->patch[0][lv][PID]->EdgeL[0] + i*dh[0] + 0.5*dh[0] );
+
+//       sub-cells are uniform in r within the cells of the mapped radial grid
+         if ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+         {
+            const double r  = Aux_Coord_CellIdx2AdoptedCoord( lv, PID, 0, i );
+            const double dr = Aux_Coord_CellIdx2CellWidth   ( lv, PID, 0, i );
+
+            dX_sub = dr/NSub;
+            X0     = r - 0.5*dr + 0.5*dX_sub;
+            _geo   = 1.0 / r;
+         }
 #endif
 
          for (int v=0; v<NCOMP_TOTAL; v++)   fluid[v] = 0.0;
 
          for (int kk=0; kk<NSub; kk++)    {  Z = Z0 + kk*dh_sub[2];
          for (int jj=0; jj<NSub; jj++)    {  Y = Y0 + jj*dh_sub[1];
-         for (int ii=0; ii<NSub; ii++)    {  X = X0 + ii*dh_sub[0];
+         for (int ii=0; ii<NSub; ii++)    {  X = X0 + ii*dX_sub;
             
 #if ( COORDINATE == CYLINDRICAL )
             geo_sub = X;
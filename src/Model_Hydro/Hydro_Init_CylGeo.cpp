@@ -0,0 +1,252 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+
+
+
+
+// face radii of the base level loaded from RGRID_TABLE_FILE for OPT__CYL_RGRID == CYL_RGRID_TABLE
+#define RGRID_TABLE_FILE   "Input__CylRGrid"
+
+static double *RGrid_Table = NULL;
+
+static double CylGeo_Map( const double x );
+static void   CylGeo_Cell( const int lv, const int t, double &r, double &dr );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_Init_CylGeo
+// Description :  Construct the radial geometry tables CylGeo[] of the cylindrical hydro solver
+//
+// Note        :  1. Invoked by Init_GAMER() after amr->dh[] and amr->BoxEdgeL[] are set
+//                2. The geometry factors depend only on the radial index and level, so the fluid solvers
+//                   look them up by CylGeo_Lookup() instead of recomputing the divisions for every cell
+//                   and stage
+//                3. Each level stores FLU_GHOST_SIZE ghost cells on both sides of the domain, which covers
+//                   all loops of the MHM/MHM_RP/CTU solvers
+//                4. All factors are evaluated in double precision and then stored as real
+//                5. OPT__CYL_RGRID maps the uniform computational coordinate x (with the grid size amr->dh[lv][0])
+//                   to the radius r(x) (see CylGeo_Map())
+//                   --> the AMR structure, patch corners, and the solver loops all remain uniform in x, while the
+//                       face radii, cell widths dr, and all geometry factors are taken from the mapped grid
+//                   --> the radial flux differences of the solvers are converted from per dh to per dr by dh_dr
+//                   --> the cell-centre radius is the mid-point of the two faces so that r*dr is the exact volume
+//                   --> the PLM corrections adopt the local dr, which assumes a smooth mapping
+//-------------------------------------------------------------------------------------------------------
+void Hydro_Init_CylGeo()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
+
+
+// load the face radii of the base level
+   if ( OPT__CYL_RGRID == CYL_RGRID_TABLE )
+   {
+      const int NFace  = NX0_TOT[0] + 1;
+      const int TCol[] = { 0 };
+
+      if ( !Aux_CheckFileExist(RGRID_TABLE_FILE) )
+         Aux_Error( ERROR_INFO, "file \"%s\" does not exist for OPT__CYL_RGRID == %d !!\n", RGRID_TABLE_FILE, CYL_RGRID_TABLE );
+
+      const int NRow = Aux_LoadTable( RGrid_Table, RGRID_TABLE_FILE, 1, TCol, true, true );
+
+      if ( NRow != NFace )
+         Aux_Error( ERROR_INFO, "number of face radii in \"%s\" (%d) != NX0_TOT[0]+1 (%d) !!\n",
+                    RGRID_TABLE_FILE, NRow, NFace );
+
+      for (int t=1; t<NFace; t++)
+         if ( RGrid_Table[t] <= RGrid_Table[t-1] )
+            Aux_Error( ERROR_INFO, "face radii in \"%s\" are not strictly increasing ([%d]=%14.7e, [%d]=%14.7e) !!\n",
+                       RGRID_TABLE_FILE, t-1, RGrid_Table[t-1], t, RGrid_Table[t] );
+
+      if (  !Mis_CompareRealValue( RGrid_Table[0],       amr->BoxEdgeL[0], NULL, false )  ||
+            !Mis_CompareRealValue( RGrid_Table[NFace-1], amr->BoxEdgeR[0], NULL, false )    )
+         Aux_Error( ERROR_INFO, "face radii in \"%s\" ([%14.7e, %14.7e]) do not match the box ([%14.7e, %14.7e]) !!\n",
+                    RGRID_TABLE_FILE, RGrid_Table[0], RGrid_Table[NFace-1], amr->BoxEdgeL[0], amr->BoxEdgeR[0] );
+   }
+
+
+   const int NArray = 16;  // total number of real arrays in CylGeo_t
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      CylGeo_t &Geo = CylGeo[lv];
+      const double dh = amr->dh[lv][0];
+
+      Geo.NGhost = FLU_GHOST_SIZE;
+      Geo.N      = NX0_TOT[0]*(1<<lv) + 2*Geo.NGhost;
+
+//    allocate all arrays in a single block
+      real *Data = new real [ NArray*Geo.N ];
+
+      real **Array[NArray] = { &Geo.r, &Geo.r2, &Geo._r, &Geo._r2, &Geo.rR, &Geo.rR2, &Geo.rL_r, &Geo.rR_r,
+                               &Geo.rL2_r2, &Geo.rR2_r2, &Geo.dh_6r, &Geo.SlopeCorr[0], &Geo.SlopeCorr[1],
+                               &Geo.SlopeCorr[2], &Geo.dh_dr, &Geo.r_m32 };
+
+      for (int a=0; a<NArray; a++)  *Array[a] = Data + a*Geo.N;
+
+      Geo.rFace = new double [ Geo.N + 1 ];
+
+      for (int t=0; t<Geo.N; t++)
+      {
+         double r, dr, r_L, dr_L, r_R, dr_R;
+
+         CylGeo_Cell( lv, t,   r,   dr   );
+         CylGeo_Cell( lv, t-1, r_L, dr_L );  // centre of the left  neighbour
+         CylGeo_Cell( lv, t+1, r_R, dr_R );  // centre of the right neighbour
+
+         const double rL  = r - 0.5*dr;
+         const double rR  = r + 0.5*dr;
+         const double dr2 = SQR( dr );
+
+         Geo.r           [t] = (real)r;
+         Geo.r2          [t] = (real)SQR( r );
+         Geo._r          [t] = (real)( 1.0/r );
+         Geo._r2         [t] = (real)( 1.0/SQR(r) );
+         Geo.rR          [t] = (real)rR;
+         Geo.rR2         [t] = (real)SQR( rR );
+         Geo.rL_r        [t] = (real)( rL/r );
+         Geo.rR_r        [t] = (real)( rR/r );
+         Geo.rL2_r2      [t] = (real)SQR( rL/r );
+         Geo.rR2_r2      [t] = (real)SQR( rR/r );
+         Geo.dh_6r       [t] = (real)( dr/(6.0*r) );
+         Geo.SlopeCorr[0][t] = (real)( 1.0/( 1.0 - dr2/(12.0*r  *r_L) ) );
+         Geo.SlopeCorr[1][t] = (real)( 1.0/( 1.0 - dr2/(12.0*r  *r_R) ) );
+         Geo.SlopeCorr[2][t] = (real)( 1.0/( 1.0 - dr2/(12.0*r_L*r_R) ) );
+         Geo.dh_dr       [t] = ( OPT__CYL_RGRID == CYL_RGRID_UNIFORM ) ? (real)1.0 : (real)( dh/dr );
+         Geo.r_m32       [t] = (real)pow( fabs(r), -1.5 );
+         Geo.rFace       [t] = rL;
+
+         if ( t == Geo.N-1 )  Geo.rFace[ Geo.N ] = rR;
+      }
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+   if ( MPI_Rank == 0  &&  OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+   {
+      const CylGeo_t &Geo = CylGeo[0];
+      const int       t0  = Geo.NGhost;
+      const int       t1  = Geo.NGhost + NX0_TOT[0] - 1;
+
+      Aux_Message( stdout, "   Mapped radial grid: dr/r = %13.7e (inner) ... %13.7e (outer), dr_max/dr_min = %13.7e\n",
+                   ( Geo.rFace[t0+1] - Geo.rFace[t0] )/Geo.r[t0], ( Geo.rFace[t1+1] - Geo.rFace[t1] )/Geo.r[t1],
+                   (double)Geo.dh_dr[t0]/(double)Geo.dh_dr[t1] );
+   }
+
+} // FUNCTION : Hydro_Init_CylGeo
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylGeo_Map
+// Description :  Map the computational coordinate x to the radius r(x) for OPT__CYL_RGRID
+//
+// Note        :  1. CYL_RGRID_UNIFORM : r = x
+//                   CYL_RGRID_LOG     : r = BoxEdgeL*(BoxEdgeR/BoxEdgeL)^((x-BoxEdgeL)/(BoxEdgeR-BoxEdgeL))
+//                                       --> dr/r is constant
+//                   CYL_RGRID_TABLE   : piecewise-linear interpolation of the base-level face radii loaded
+//                                       from RGRID_TABLE_FILE
+//                2. The map is monotonic and preserves the box edges
+//                3. The ghost cells outside the box are extrapolated by the same map (CYL_RGRID_LOG) or by the
+//                   width of the boundary cells (CYL_RGRID_TABLE)
+//
+// Parameter   :  x : Computational coordinate
+//
+// Return      :  r(x)
+//-------------------------------------------------------------------------------------------------------
+double CylGeo_Map( const double x )
+{
+
+   const double L = amr->BoxEdgeL[0];
+   const double R = amr->BoxEdgeR[0];
+
+   switch ( OPT__CYL_RGRID )
+   {
+      case CYL_RGRID_LOG :
+         return L*pow( R/L, (x-L)/(R-L) );
+
+      case CYL_RGRID_TABLE :
+      {
+         const int    NX = NX0_TOT[0];
+         const double s  = (x-L)/amr->dh[0][0];
+         const int    i  = MIN( MAX( (int)floor(s), 0 ), NX-1 );
+
+         return RGrid_Table[i] + ( s - i )*( RGrid_Table[i+1] - RGrid_Table[i] );
+      }
+
+      default :
+         return x;
+   }
+
+} // FUNCTION : CylGeo_Map
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylGeo_Cell
+// Description :  Get the centre radius and width of the radial table cell t of the level lv
+//
+// Note        :  1. t = Geo.NGhost corresponds to the first cell inside the box
+//                2. The uniform grid adopts the original expressions so that its tables are not affected by
+//                   the round-off errors of the face differences
+//
+// Parameter   :  lv : Target level
+//                t  : Table index, which can lie outside [0, N)
+//                r  : Output centre radius
+//                dr : Output cell width
+//-------------------------------------------------------------------------------------------------------
+void CylGeo_Cell( const int lv, const int t, double &r, double &dr )
+{
+
+   const double dh = amr->dh[lv][0];
+   const double xL = amr->BoxEdgeL[0] + ( t - FLU_GHOST_SIZE )*dh;
+
+   if ( OPT__CYL_RGRID == CYL_RGRID_UNIFORM )
+   {
+      r  = xL + 0.5*dh;
+      dr = dh;
+   }
+
+   else
+   {
+      const double rL = CylGeo_Map( xL );
+      const double rR = CylGeo_Map( xL + dh );
+
+      r  = 0.5*( rL + rR );
+      dr = rR - rL;
+   }
+
+} // FUNCTION : CylGeo_Cell
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_End_CylGeo
+// Description :  Free the radial geometry tables allocated by Hydro_Init_CylGeo()
+//-------------------------------------------------------------------------------------------------------
+void Hydro_End_CylGeo()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+//    all real arrays share the block starting at CylGeo[lv].r
+      delete [] CylGeo[lv].r;
+      delete [] CylGeo[lv].rFace;
+
+      CylGeo[lv].r     = NULL;
+      CylGeo[lv].rFace = NULL;
+      CylGeo[lv].N     = 0;
+   }
+
+   delete [] RGrid_Table;
+   RGrid_Table = NULL;
+
+} // FUNCTION : Hydro_End_CylGeo
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
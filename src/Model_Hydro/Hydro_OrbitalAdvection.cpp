@@ -0,0 +1,397 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+
+// user-specified mean azimuthal velocity for OPT__ORBITAL_ADV == ORB_ADV_USER (set by the test problem initializer)
+double (*OrbAdv_Vphi_User_Ptr)( const double R, const double Z, const double Time ) = NULL;
+
+static void OrbAdv_ShiftRing( real U[], real Slope[], real Flux[], const int NPhi, const double Shift );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_OrbAdv_Init
+// Description :  Allocate the table of the mean azimuthal velocity OrbAdv_Vphi[] of orbital advection
+//
+// Note        :  1. Invoked by Init_GAMER() when OPT__ORBITAL_ADV is on
+//                   --> must be called after Init_TestProb() so that OrbAdv_Vphi_User_Ptr can be checked
+//                2. OrbAdv_Vphi[] stores one value for each (r,z) ring of the base level
+//-------------------------------------------------------------------------------------------------------
+void Hydro_OrbAdv_Init()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
+
+
+   if ( OPT__ORBITAL_ADV == ORB_ADV_USER  &&  OrbAdv_Vphi_User_Ptr == NULL )
+      Aux_Error( ERROR_INFO, "OrbAdv_Vphi_User_Ptr == NULL for OPT__ORBITAL_ADV == %d !!\n", ORB_ADV_USER );
+
+   const long NRing = (long)NX0_TOT[0]*NX0_TOT[2];
+
+   OrbAdv_Vphi = new real [NRing];
+
+   for (long t=0; t<NRing; t++)  OrbAdv_Vphi[t] = (real)0.0;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+} // FUNCTION : Hydro_OrbAdv_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_OrbAdv_End
+// Description :  Free the table allocated by Hydro_OrbAdv_Init()
+//-------------------------------------------------------------------------------------------------------
+void Hydro_OrbAdv_End()
+{
+
+   delete [] OrbAdv_Vphi;
+
+   OrbAdv_Vphi = NULL;
+
+} // FUNCTION : Hydro_OrbAdv_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_OrbAdv_SetVphi
+// Description :  Set the mean azimuthal velocity OrbAdv_Vphi[] of each (r,z) ring
+//
+// Note        :  1. Invoked by EvolveLevel() at the beginning of each base-level step before estimating the
+//                   time-step, so that the time-step and the fluid solver adopt the same table
+//                2. ORB_ADV_AVERAGE : azimuthal average of v_phi over the ring
+//                   ORB_ADV_USER    : OrbAdv_Vphi_User_Ptr( r, z, TTime )
+//                3. OrbAdv_Vphi[] is indexed by k*NX0_TOT[0]+i, where i/k are the global cell indices along r/z,
+//                   and is identical on all ranks
+//
+// Parameter   :  lv    : Target refinement level (must be 0)
+//                FluSg : Sandglass of the current fluid data
+//                TTime : Current physical time
+//-------------------------------------------------------------------------------------------------------
+void Hydro_OrbAdv_SetVphi( const int lv, const int FluSg, const double TTime )
+{
+
+#  ifdef GAMER_DEBUG
+   if ( lv != 0 )    Aux_Error( ERROR_INFO, "orbital advection only supports the base level (lv %d) !!\n", lv );
+#  endif
+
+
+   const int  NR    = NX0_TOT[0];
+   const int  NZ    = NX0_TOT[2];
+   const long NRing = (long)NR*NZ;
+
+   if ( OPT__ORBITAL_ADV == ORB_ADV_USER )
+   {
+      for (int k=0; k<NZ; k++)
+      for (int i=0; i<NR; i++)
+      {
+         const double r = 0.5*( CylGeo[lv].rFace[ i+CylGeo[lv].NGhost ] + CylGeo[lv].rFace[ i+CylGeo[lv].NGhost+1 ] );
+         const double z = amr->BoxEdgeL[2] + ( k + 0.5 )*amr->dh[lv][2];
+
+         OrbAdv_Vphi[ (long)k*NR + i ] = (real)OrbAdv_Vphi_User_Ptr( r, z, TTime );
+      }
+   }
+
+   else // ORB_ADV_AVERAGE
+   {
+      double *Sum_ThisRank = new double [NRing];
+      double *Sum_AllRank  = new double [NRing];
+
+      for (long t=0; t<NRing; t++)  Sum_ThisRank[t] = 0.0;
+
+//    sum over the real patches of this rank
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         const int i0 = amr->patch[0][lv][PID]->corner[0] / amr->scale[lv];
+         const int k0 = amr->patch[0][lv][PID]->corner[2] / amr->scale[lv];
+         const real (*Fluid)[PS1][PS1][PS1] = amr->patch[FluSg][lv][PID]->fluid;
+
+         for (int k=0; k<PS1; k++)
+         for (int j=0; j<PS1; j++)
+         for (int i=0; i<PS1; i++)
+            Sum_ThisRank[ (long)(k0+k)*NR + i0+i ] += Fluid[MOMY][k][j][i] / Fluid[DENS][k][j][i];
+      }
+
+//    sum over all ranks
+      MPI_Allreduce( Sum_ThisRank, Sum_AllRank, (int)NRing, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      for (long t=0; t<NRing; t++)  OrbAdv_Vphi[t] = (real)( Sum_AllRank[t] / NX0_TOT[1] );
+
+      delete [] Sum_ThisRank;
+      delete [] Sum_AllRank;
+   } // if ( OPT__ORBITAL_ADV == ORB_ADV_USER ) ... else ...
+
+} // FUNCTION : Hydro_OrbAdv_SetVphi
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_OrbAdv_Shift
+// Description :  Transport the fluid along phi by the mean azimuthal velocity OrbAdv_Vphi[] (FARGO-style
+//                orbital advection)
+//
+// Note        :  1. Invoked by EvolveLevel() right after the base-level fluid solver
+//                   --> the fluid solver only transports the fluid along phi by the residual velocity
+//                       v_phi - OrbAdv_Vphi (see CPU_OrbAdv_Con2Frame() and CPU_OrbAdv_Flux2Lab())
+//                2. Each (r,z) ring is shifted by OrbAdv_Vphi*dt/r along phi
+//                   --> the integer part of the shift is a cyclic permutation of the cells, and the fractional
+//                       part is a conservative upwind advection with the van Leer slopes
+//                   --> not limited by the CFL condition, and all fluid variables are conserved on each ring
+//                3. All base-level patches of a column of rings (cx,cz) are collected on the rank
+//                   (cz*NX0_TOT[0]/PS1+cx) % MPI_NRank, shifted there, and then sent back to their owners
+//                4. Only the real patches are updated --> the buffer patches are filled later by Buf_GetBufferData()
+//                5. MIN_DENS and MIN_PRES are applied to the shifted cells
+//
+// Parameter   :  lv    : Target refinement level (must be 0)
+//                FluSg : Sandglass of the fluid data to be shifted
+//                dt    : Time interval of the fluid solver
+//-------------------------------------------------------------------------------------------------------
+void Hydro_OrbAdv_Shift( const int lv, const int FluSg, const double dt )
+{
+
+#  ifdef GAMER_DEBUG
+   if ( lv != 0 )    Aux_Error( ERROR_INFO, "orbital advection only supports the base level (lv %d) !!\n", lv );
+#  endif
+
+
+   const int  NR        = NX0_TOT[0];
+   const int  NPhi      = NX0_TOT[1];
+   const int  NColR     = NX0_TOT[0]/PS1;
+   const int  NCol      = NColR*( NX0_TOT[2]/PS1 );
+   const int  NPatchPhi = NX0_TOT[1]/PS1;
+   const int  PatchSize = NCOMP_TOTAL*CUBE(PS1);
+   const int  NReal     = amr->NPatchComma[lv][1];
+   const int  Scale     = amr->scale[lv];
+   const real Gamma_m1  = GAMMA - (real)1.0;
+   const real _Gamma_m1 = (real)1.0 / Gamma_m1;
+
+   int NSend[MPI_NRank], NRecv[MPI_NRank], SendDisp[MPI_NRank], RecvDisp[MPI_NRank], Counter[MPI_NRank];
+   int NSend_Data[MPI_NRank], NRecv_Data[MPI_NRank], SendDisp_Data[MPI_NRank], RecvDisp_Data[MPI_NRank];
+
+
+// 1. collect the patches of each column of rings on its owner
+// 1-1. get the number of patches sent to each rank
+   int *SendRank = new int [NReal];
+   int *SendPos  = new int [NReal];
+
+   for (int r=0; r<MPI_NRank; r++)  NSend[r] = 0;
+
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const int cx = amr->patch[0][lv][PID]->corner[0] / Scale / PS1;
+      const int cz = amr->patch[0][lv][PID]->corner[2] / Scale / PS1;
+
+      SendRank[PID] = ( cz*NColR + cx ) % MPI_NRank;
+      NSend[ SendRank[PID] ] ++;
+   }
+
+   MPI_Alltoall( NSend, 1, MPI_INT, NRecv, 1, MPI_INT, MPI_COMM_WORLD );
+
+   SendDisp[0] = 0;
+   RecvDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      SendDisp[r] = SendDisp[r-1] + NSend[r-1];
+      RecvDisp[r] = RecvDisp[r-1] + NRecv[r-1];
+   }
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NSend_Data   [r] = NSend   [r]*PatchSize;
+      NRecv_Data   [r] = NRecv   [r]*PatchSize;
+      SendDisp_Data[r] = SendDisp[r]*PatchSize;
+      RecvDisp_Data[r] = RecvDisp[r]*PatchSize;
+      Counter      [r] = 0;
+   }
+
+   const int NRecvTotal = RecvDisp[MPI_NRank-1] + NRecv[MPI_NRank-1];
+
+
+// 1-2. prepare the send buffers
+//      --> the index of each patch is its position in the column list (cz*NColR+cx)*NPatchPhi+cy
+   int  *SendIdx = new int  [NReal];
+   int  *RecvIdx = new int  [NRecvTotal];
+   real *SendBuf = new real [ (long)NReal*PatchSize ];
+   real *RecvBuf = new real [ (long)NRecvTotal*PatchSize ];
+
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const int cx  = amr->patch[0][lv][PID]->corner[0] / Scale / PS1;
+      const int cy  = amr->patch[0][lv][PID]->corner[1] / Scale / PS1;
+      const int cz  = amr->patch[0][lv][PID]->corner[2] / Scale / PS1;
+      const int Pos = SendDisp[ SendRank[PID] ] + Counter[ SendRank[PID] ] ++;
+
+      SendPos[PID] = Pos;
+      SendIdx[Pos] = ( cz*NColR + cx )*NPatchPhi + cy;
+
+      memcpy( SendBuf + (long)Pos*PatchSize, amr->patch[FluSg][lv][PID]->fluid, PatchSize*sizeof(real) );
+   }
+
+
+// 1-3. exchange data by MPI
+   MPI_Alltoallv( SendIdx, NSend,      SendDisp,      MPI_INT,
+                  RecvIdx, NRecv,      RecvDisp,      MPI_INT,    MPI_COMM_WORLD );
+
+#  ifdef FLOAT8
+   MPI_Alltoallv( SendBuf, NSend_Data, SendDisp_Data, MPI_DOUBLE,
+                  RecvBuf, NRecv_Data, RecvDisp_Data, MPI_DOUBLE, MPI_COMM_WORLD );
+#  else
+   MPI_Alltoallv( SendBuf, NSend_Data, SendDisp_Data, MPI_FLOAT,
+                  RecvBuf, NRecv_Data, RecvDisp_Data, MPI_FLOAT,  MPI_COMM_WORLD );
+#  endif
+
+
+// 2. shift all rings of the local columns
+// 2-1. record the received patch of each phi position in the local columns
+   const int NLocalCol = ( MPI_Rank < NCol ) ? ( NCol - 1 - MPI_Rank )/MPI_NRank + 1 : 0;
+   int *ColPatch = new int [ NLocalCol*NPatchPhi ];
+
+#  ifdef GAMER_DEBUG
+   if ( NRecvTotal != NLocalCol*NPatchPhi )
+      Aux_Error( ERROR_INFO, "NRecvTotal (%d) != NLocalCol*NPatchPhi (%d) !!\n", NRecvTotal, NLocalCol*NPatchPhi );
+#  endif
+
+   for (int t=0; t<NRecvTotal; t++)
+   {
+      const int Col = RecvIdx[t] / NPatchPhi;
+      const int cy  = RecvIdx[t] % NPatchPhi;
+
+      ColPatch[ (Col/MPI_NRank)*NPatchPhi + cy ] = t;
+   }
+
+
+// 2-2. shift each ring
+#  pragma omp parallel
+   {
+      real *Ring  = new real [ NCOMP_TOTAL*NPhi ];
+      real *Slope = new real [ NPhi ];
+      real *Flux  = new real [ NPhi ];
+
+#     pragma omp for schedule( runtime )
+      for (int t=0; t<NLocalCol*SQR(PS1); t++)
+      {
+         const int    LocalCol = t / SQR(PS1);
+         const int    k        = ( t % SQR(PS1) ) / PS1;
+         const int    i        = t % PS1;
+         const int    Col      = LocalCol*MPI_NRank + MPI_Rank;
+         const int    gi       = ( Col % NColR )*PS1 + i;
+         const int    gk       = ( Col / NColR )*PS1 + k;
+         const double r        = 0.5*( CylGeo[lv].rFace[ gi+CylGeo[lv].NGhost ] + CylGeo[lv].rFace[ gi+CylGeo[lv].NGhost+1 ] );
+         const double Shift    = OrbAdv_Vphi[ (long)gk*NR + gi ]*dt/( r*amr->dh[lv][1] );
+
+//       gather the ring
+         for (int cy=0; cy<NPatchPhi; cy++)
+         {
+            const real *Patch = RecvBuf + (long)ColPatch[ LocalCol*NPatchPhi + cy ]*PatchSize;
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            for (int j=0; j<PS1; j++)
+               Ring[ v*NPhi + cy*PS1 + j ] = Patch[ ( (v*PS1 + k)*PS1 + j )*PS1 + i ];
+         }
+
+//       shift all components
+         for (int v=0; v<NCOMP_TOTAL; v++)   OrbAdv_ShiftRing( Ring+v*NPhi, Slope, Flux, NPhi, Shift );
+
+//       ensure positive density and pressure
+         for (int j=0; j<NPhi; j++)
+         {
+            real *Dens = Ring + DENS*NPhi + j;
+            real *Engy = Ring + ENGY*NPhi + j;
+
+            *Dens = FMAX( *Dens, (real)MIN_DENS );
+            *Engy = CPU_CheckMinPresInEngy( *Dens, Ring[MOMX*NPhi+j], Ring[MOMY*NPhi+j], Ring[MOMZ*NPhi+j], *Engy,
+                                            Gamma_m1, _Gamma_m1, (real)MIN_PRES );
+#           if ( NCOMP_PASSIVE > 0 )
+            for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+            Ring[ v*NPhi + j ] = FMAX( Ring[ v*NPhi + j ], TINY_NUMBER );
+#           endif
+         }
+
+//       scatter the ring
+         for (int cy=0; cy<NPatchPhi; cy++)
+         {
+            real *Patch = RecvBuf + (long)ColPatch[ LocalCol*NPatchPhi + cy ]*PatchSize;
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            for (int j=0; j<PS1; j++)
+               Patch[ ( (v*PS1 + k)*PS1 + j )*PS1 + i ] = Ring[ v*NPhi + cy*PS1 + j ];
+         }
+      } // for (int t=0; t<NLocalCol*SQR(PS1); t++)
+
+      delete [] Ring;
+      delete [] Slope;
+      delete [] Flux;
+   } // OpenMP parallel region
+
+
+// 3. send the shifted patches back to their owners
+#  ifdef FLOAT8
+   MPI_Alltoallv( RecvBuf, NRecv_Data, RecvDisp_Data, MPI_DOUBLE,
+                  SendBuf, NSend_Data, SendDisp_Data, MPI_DOUBLE, MPI_COMM_WORLD );
+#  else
+   MPI_Alltoallv( RecvBuf, NRecv_Data, RecvDisp_Data, MPI_FLOAT,
+                  SendBuf, NSend_Data, SendDisp_Data, MPI_FLOAT,  MPI_COMM_WORLD );
+#  endif
+
+   for (int PID=0; PID<NReal; PID++)
+      memcpy( amr->patch[FluSg][lv][PID]->fluid, SendBuf + (long)SendPos[PID]*PatchSize, PatchSize*sizeof(real) );
+
+
+   delete [] SendRank;
+   delete [] SendPos;
+   delete [] SendIdx;
+   delete [] RecvIdx;
+   delete [] SendBuf;
+   delete [] RecvBuf;
+   delete [] ColPatch;
+
+} // FUNCTION : Hydro_OrbAdv_Shift
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  OrbAdv_ShiftRing
+// Description :  Shift a periodic ring of cells by a given number of cells
+//
+// Note        :  1. The shift is split into the integer part NInt and the fractional part 0 <= f < 1
+//                   --> the fractional part is applied first by the upwind fluxes f*( U + 0.5*(1-f)*Slope )
+//                       across the right face of each cell, where Slope is the van Leer slope
+//                   --> the cells are then rotated by NInt
+//                2. A negative shift is handled by NInt < 0 with the same 0 <= f < 1
+//
+// Parameter   :  U     : Cell averages of the ring to be shifted in place
+//                Slope : Work array with NPhi elements
+//                Flux  : Work array with NPhi elements
+//                NPhi  : Number of cells in the ring
+//                Shift : Number of cells to be shifted along +phi
+//-------------------------------------------------------------------------------------------------------
+void OrbAdv_ShiftRing( real U[], real Slope[], real Flux[], const int NPhi, const double Shift )
+{
+
+   const int  NInt  = (int)floor( Shift );
+   const int  NRoll = ( NInt%NPhi + NPhi )%NPhi;
+   const real f     = (real)( Shift - NInt );
+
+// 1. fractional shift
+   for (int j=0; j<NPhi; j++)
+   {
+      const real dL = U[j] - U[ (j-1+NPhi)%NPhi ];
+      const real dR = U[ (j+1)%NPhi ] - U[j];
+
+      Slope[j] = ( dL*dR > (real)0.0 ) ? (real)2.0*dL*dR/( dL + dR ) : (real)0.0;
+   }
+
+   for (int j=0; j<NPhi; j++)    Flux[j] = f*(  U[j] + (real)0.5*( (real)1.0 - f )*Slope[j]  );
+
+// 2. integer shift (reuse Slope[] to store the result)
+   for (int j=0; j<NPhi; j++)    Slope[ (j+NRoll)%NPhi ] = U[j] - Flux[j] + Flux[ (j-1+NPhi)%NPhi ];
+
+   memcpy( U, Slope, NPhi*sizeof(real) );
+
+} // FUNCTION : OrbAdv_ShiftRing
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
@@ -23,6 +23,7 @@ Data structure:
      |                      | -> KeyInfo   dset (compound)
      |                      | -> Makefile  dset (compound)
      |                      | -> SymConst  dset (compound)
+     |                      | -> CylRFace  dset (CYLINDRICAL only)
      |
      | -> Tree group     -> | -> Corner  dset -> Cvt2Phy attrs
      |                      | -> LBIdx   dset
@@ -286,6 +287,21 @@ void Output_DumpData_Total_HDF5( const char *FileName )
       H5_Status          = H5Dwrite( H5_SetID_InputPara, H5_TypeID_Com_InputPara, H5S_ALL, H5S_ALL, H5P_DEFAULT, &InputPara );
       H5_Status          = H5Dclose( H5_SetID_InputPara );
 
+//    3-3-5. face radii of the base-level radial grid (NX0_TOT[0]+1 values, see OPT__CYL_RGRID)
+#     if ( MODEL == HYDRO  &&  COORDINATE == CYLINDRICAL )
+      const hsize_t H5_SetDims_RFace = NX0_TOT[0] + 1;
+      hid_t         H5_SpaceID_RFace, H5_SetID_RFace;
+
+      H5_SpaceID_RFace   = H5Screate_simple( 1, &H5_SetDims_RFace, NULL );
+      H5_SetID_RFace     = H5Dcreate( H5_GroupID_Info, "CylRFace", H5T_NATIVE_DOUBLE, H5_SpaceID_RFace,
+                                      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+      if ( H5_SetID_RFace < 0 )     Aux_Error( ERROR_INFO, "failed to create the dataset \"%s\" !!\n", "CylRFace" );
+      H5_Status          = H5Dwrite( H5_SetID_RFace, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                                     CylGeo[0].rFace + CylGeo[0].NGhost );
+      H5_Status          = H5Dclose( H5_SetID_RFace );
+      H5_Status          = H5Sclose( H5_SpaceID_RFace );
+#     endif
+
       H5_Status = H5Gclose( H5_GroupID_Info );
       H5_Status = H5Fclose( H5_FileID );
    } // if ( MPI_Rank == 0 )
@@ -1833,6 +1849,9 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Opt__WAF_Limiter        = OPT__WAF_LIMITER;
    InputPara.Opt__1stFluxCorr        = OPT__1ST_FLUX_CORR;
    InputPara.Opt__1stFluxCorrScheme  = OPT__1ST_FLUX_CORR_SCHEME;
+#  if ( COORDINATE == CYLINDRICAL )
+   InputPara.Opt__CylRGrid           = OPT__CYL_RGRID;
+#  endif
 #  endif
 
 // ELBDM solvers
@@ -2542,6 +2561,9 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Opt__WAF_Limiter",        HOFFSET(InputPara_t,Opt__WAF_Limiter       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__1stFluxCorr",        HOFFSET(InputPara_t,Opt__1stFluxCorr       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__1stFluxCorrScheme",  HOFFSET(InputPara_t,Opt__1stFluxCorrScheme ), H5T_NATIVE_INT     );
+#  if ( COORDINATE == CYLINDRICAL )
+   H5Tinsert( H5_TypeID, "Opt__CylRGrid",           HOFFSET(InputPara_t,Opt__CylRGrid          ), H5T_NATIVE_INT     );
+#  endif
 #  endif
 
 // ELBDM solvers
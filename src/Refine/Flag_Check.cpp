@@ -145,7 +145,7 @@ bool Flag_Check( const int lv, const int PID, const int i, const int j, const in
       dh_max = fmax( dh_max, dz );
 
 #     elif ( COORDINATE == CYLINDRICAL )
-      const double dr   = amr->dh[lv][0];
+      const double dr   = Aux_Coord_CellIdx2CellWidth( lv, PID, 0, i );
       const double dphi = amr->dh[lv][1];
       const double dz   = amr->dh[lv][2];
       const double r    = Aux_Coord_CellIdx2AdoptedCoord( lv, PID, 0, i );
@@ -1,57 +1,331 @@
 #include "GAMER.h"
 
-#include <vector>
-#include <iterator>
-
-using std::vector;
-
 #if (COORDINATE == CYLINDRICAL)
 #ifdef GRAVITY
 
 static void Pot_Isolated( real ** RhoK, real ** PhiK, const long slab_size ) ;
+static void Pot_Isolated_Dense( real ** RhoK, const int i0, const int ni, const long row_size_hf ) ;
+static void Pot_Isolated_HMatrix( real ** RhoK, const long row_size_hf ) ;
+static void Pot_TruncationError( real ** RhoK, const double PrepTime ) ;
+
+// target size of each radial block of PhiK_All reduced by a single MPI_Ireduce in Pot_Isolated()
+#define PHIK_BLOCK_MB   4.0
 
+// unique z wavenumber of the k-space row kz_row, whose rows are ordered as kz = 0, 2, 4, ..., 1, 3, 5, ...
+// (see CylFFTW_Forward) and whose kernel is even in kz (see Init_CylKernel)
+static inline int KzUnique( const int kz_row )
+{
+   const int kz = ( kz_row < NX0_TOT[2] ) ? 2*kz_row : 2*( kz_row - NX0_TOT[2] ) + 1;
+
+   return ( kz <= NX0_TOT[2] ) ? kz : 2*NX0_TOT[2] - kz;
+}
 
-template <class T>
-static void Flatten2DVec( vector< vector<T> > Vec, T Array[] ) ;
 
-extern rfftwnd_plan FFTW_Plan, FFTW_Plan_Inv;
+
+// persistent slab <-> patch communication schedule (see CylPoisson_BuildSchedule)
+// --> only density and potential values are exchanged in each Poisson solve
+static bool         Sch_Valid     = false;
+static int          Sch_NSlab     = 0;       // number of local patch slices
+static int          Sch_NSendSlab = 0;       // number of patch slices of the owned PhiK rows
+static int         *Sch_RhoPos    = NULL;    // position of each local patch slice in SendBuf_Rho
+static int         *Sch_PhiPos    = NULL;    // position of each owned patch slice in SendBuf_Phi
+static int          Sch_NReq_Rho  = 0;
+static int          Sch_NReq_Phi  = 0;
+static MPI_Request *Sch_Req_Rho   = NULL;    // persistent requests of Patch2Slab
+static MPI_Request *Sch_Req_Phi   = NULL;    // persistent requests of Slab2Patch
+
+static void CylPoisson_BuildSchedule( const int local_ny, const int global_nxp_start, const int global_nx_start );
+static void Sch_InitRequest( MPI_Request *Req, int &NReq, void *SendBuf, void *RecvBuf, const int SendCount[],
+                             const int SendDisp[], const int RecvCount[], const int RecvDisp[], const int Tag );
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylPoisson_BuildSchedule
+// Description :  Construct the persistent slab <-> patch communication schedule of Patch2Slab() and Slab2Patch()
+//
+// Note        :  1. Invoked by CPU_CylPoissonSolver() when the schedule is invalid
+//                   --> invalidated by CylPoisson_FreeSchedule(), which is called by LB_Init_LoadBalance()
+//                       after redistributing the base-level patches and by End_MemFree_CylPoisson()
+//                2. Patch2Slab: all patch slices are sent to the rank with TRANK_I=0 and TRANK_IP determined by r'
+//                   --> their target positions in RhoK are exchanged and broadcast along rank_ip_comm here
+//                       and kept in RecvBuf_IDPlanXp/YZ
+//                3. Slab2Patch: each rank sends the patch slices of its owned PhiK rows back to the patch owners
+//                   --> the target PID and radial index are exchanged here and kept in RecvBuf_PID/I
+//                4. Send/recv buffers depending on the number of local patches are (re)allocated here
+//                5. Each pair of ranks exchanges one message per solve in each direction through persistent
+//                   point-to-point requests
+//
+// Parameter   :  local_ny         : Padded y size of each slab
+//                global_nxp_start : Global index of the first r' of this rank
+//                global_nx_start  : Global index of the first r of this rank
+//-------------------------------------------------------------------------------------------------------
+void CylPoisson_BuildSchedule( const int local_ny, const int global_nxp_start, const int global_nx_start )
+{
+
+   const int  PSSize          = PS1*PS1;
+   const int  Scale0          = amr->scale[0];
+   const int  NPatchY         = NX0_TOT[1]/PS1;
+   const int  NPatchZ         = NX0_TOT[2]/PS1;
+   const int  NSlab           = amr->NPatchComma[0][1]*PS1;
+   const long NSlabTotal      = (long)NPatchTotal[0]*PS1;
+   const int  global_nxp_slab = global_nxp * NPatchY * NPatchZ;
+   const int  NOwn            = PhiK_OwnStart[RANK_IP+1] - PhiK_OwnStart[RANK_IP];
+   const int  own_nx_start    = global_nx_start + PhiK_OwnStart[RANK_IP];   // global radial index of PhiK[0]
+   const int  NSendSlab       = NOwn*NPatchZ*NPatchY;
+
+   int SendCount[MPI_NRank], RecvCount[MPI_NRank], SendDisp[MPI_NRank], RecvDisp[MPI_NRank], Counter[MPI_NRank];
+
+
+// 1. (re)allocate the buffers depending on the number of local patches
+   CylPoisson_FreeSchedule();
+
+   delete [] SendBuf_Rho;        SendBuf_Rho      = new real [ (long)NSlab*PSSize ];
+   delete [] SendBuf_IDPlanXp;   SendBuf_IDPlanXp = new int  [ NSlab ];
+   delete [] SendBuf_IDPlanYZ;   SendBuf_IDPlanYZ = new long [ NSlab ];
+   delete [] RecvBuf_Phi;        RecvBuf_Phi      = new real [ (long)NSlab*PSSize ];
+   delete [] RecvBuf_PID;        RecvBuf_PID      = new long [ NSlab ];
+   delete [] RecvBuf_I;          RecvBuf_I        = new int  [ NSlab ];
+
+   Sch_NSlab     = NSlab;
+   Sch_NSendSlab = NSendSlab;
+   Sch_RhoPos    = new int [NSlab];
+   Sch_PhiPos    = new int [NSendSlab];
+   Sch_Req_Rho   = new MPI_Request [ 2*MPI_NRank ];
+   Sch_Req_Phi   = new MPI_Request [ 2*MPI_NRank ];
+
+
+// 2. Patch2Slab
+// 2.1 target rank of each patch slice (patch slice at fixed r')
+   int *Slab_TRank = new int [NSlab];
+
+   for (int r=0; r<MPI_NRank; r++)  SendCount[r] = 0;
+
+   for (int PID=0; PID<amr->NPatchComma[0][1]; PID++)
+   for (int ip=0; ip<PS1; ip++) {
+      const int BPos_Xp  = amr->patch[0][0][PID]->corner[0] / Scale0 + ip;
+      const int TRANK_IP = int( BPos_Xp/global_nxp_unit );
+      const int TRANK_I  = 0;
+      const int TRank    = TRANK_IP*(RANK_I_TOT) + TRANK_I ;
+
+      Slab_TRank[ PID*PS1 + ip ] = TRank;
+      SendCount[TRank] ++;
+   }
+
+   SendDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  SendDisp[r] = SendDisp[r-1] + SendCount[r-1];
+
+// 2.2 position of each patch slice in the send buffer (slices sent to the same rank are ordered by PID and ip)
+//     and its target position in RhoK
+   for (int r=0; r<MPI_NRank; r++)  Counter[r] = 0;
+
+   for (int PID=0; PID<amr->NPatchComma[0][1]; PID++)
+   for (int ip=0; ip<PS1; ip++) {
+      const int idx = PID*PS1 + ip;
+      const int Pos = SendDisp[ Slab_TRank[idx] ] + Counter[ Slab_TRank[idx] ] ++;
+      const int *Corner = amr->patch[0][0][PID]->corner;
+
+      Sch_RhoPos[idx]       = Pos;
+      SendBuf_IDPlanXp[Pos] = Corner[0]/Scale0 + ip;
+      SendBuf_IDPlanYZ[Pos] = (long)( Corner[2]/Scale0 )*local_ny + Corner[1]/Scale0;
+   }
+
+   delete [] Slab_TRank;
+
+// 2.3 exchange the target positions once
+   MPI_Alltoall( SendCount, 1, MPI_INT, RecvCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   RecvDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  RecvDisp[r] = RecvDisp[r-1] + RecvCount[r-1];
+
+   MPI_Alltoallv( SendBuf_IDPlanXp, SendCount, SendDisp, MPI_INT,
+                  RecvBuf_IDPlanXp, RecvCount, RecvDisp, MPI_INT,  MPI_COMM_WORLD );
+
+   MPI_Alltoallv( SendBuf_IDPlanYZ, SendCount, SendDisp, MPI_LONG,
+                  RecvBuf_IDPlanYZ, RecvCount, RecvDisp, MPI_LONG, MPI_COMM_WORLD );
+
+   MPI_Bcast( RecvBuf_IDPlanXp, global_nxp_slab, MPI_INT,  0, rank_ip_comm );
+   MPI_Bcast( RecvBuf_IDPlanYZ, global_nxp_slab, MPI_LONG, 0, rank_ip_comm );
+
+// 2.4 persistent requests of the density exchange
+   Sch_InitRequest( Sch_Req_Rho, Sch_NReq_Rho, SendBuf_Rho, RecvBuf_Rho, SendCount, SendDisp, RecvCount, RecvDisp, 0 );
+
+
+// 3. Slab2Patch
+// 3.1 owner rank and PID of each patch slice
+//     --> slice index SlabID = ( i*NPatchZ + Cr2/PS1 )*NPatchY + Cr1/PS1 with i the global radial index
+   int  ListAllNSlab[MPI_NRank], NSlabDisp[MPI_NRank];
+   long *LocalPID      = new long [NSlab];
+   long *LocalSlabID   = new long [NSlab];
+   long *ListAllPID    = new long [NSlabTotal];
+   long *ListAllSlabID = new long [NSlabTotal];
+   int  *SlabID2Rank   = new int  [NSlabTotal];
+   long *SlabID2PID    = new long [NSlabTotal];
+
+   for (int PID=0; PID<amr->NPatchComma[0][1]; PID++)
+   for (int ip=0; ip<PS1; ip++) {
+      const int *Corner = amr->patch[0][0][PID]->corner;
+      const int  idx    = PID*PS1 + ip;
+
+      LocalPID   [idx] = PID;
+      LocalSlabID[idx] = (long)( ( Corner[0]/Scale0 + ip )*NPatchZ + Corner[2]/Scale0/PS1 )*NPatchY
+                         + Corner[1]/Scale0/PS1;
+   }
+
+   MPI_Allgather( &NSlab, 1, MPI_INT, ListAllNSlab, 1, MPI_INT, MPI_COMM_WORLD );
+
+   NSlabDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  NSlabDisp[r] = NSlabDisp[r-1] + ListAllNSlab[r-1];
+
+   MPI_Allgatherv( LocalPID,    NSlab, MPI_LONG, ListAllPID,    ListAllNSlab, NSlabDisp, MPI_LONG, MPI_COMM_WORLD );
+   MPI_Allgatherv( LocalSlabID, NSlab, MPI_LONG, ListAllSlabID, ListAllNSlab, NSlabDisp, MPI_LONG, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)
+   for (int t=NSlabDisp[r]; t<NSlabDisp[r]+ListAllNSlab[r]; t++) {
+      SlabID2Rank[ ListAllSlabID[t] ] = r;
+      SlabID2PID [ ListAllSlabID[t] ] = ListAllPID[t];
+   }
+
+   delete [] LocalPID;
+   delete [] LocalSlabID;
+   delete [] ListAllPID;
+   delete [] ListAllSlabID;
+
+// 3.2 target rank and send buffer position of each owned patch slice (slices sent to the same rank are ordered by t)
+   for (int r=0; r<MPI_NRank; r++)  SendCount[r] = Counter[r] = 0;
+
+   for (int t=0; t<NSendSlab; t++) {
+      const long SlabID = (long)own_nx_start*NPatchZ*NPatchY + t;
+      SendCount[ SlabID2Rank[SlabID] ] ++ ;
+   }
+
+   SendDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  SendDisp[r] = SendDisp[r-1] + SendCount[r-1];
+
+   for (int t=0; t<NSendSlab; t++) {
+      const long SlabID = (long)own_nx_start*NPatchZ*NPatchY + t;
+      const int  TRank  = SlabID2Rank[SlabID];
+      const int  Pos    = SendDisp[TRank] + Counter[TRank] ++;
+
+      Sch_PhiPos [t]   = Pos;
+      SendBuf_PID[Pos] = SlabID2PID[SlabID];
+      SendBuf_I  [Pos] = own_nx_start + t/(NPatchZ*NPatchY);
+   }
+
+   delete [] SlabID2Rank;
+   delete [] SlabID2PID;
+
+// 3.3 exchange the target PID and radial index once
+   MPI_Alltoall( SendCount, 1, MPI_INT, RecvCount, 1, MPI_INT, MPI_COMM_WORLD );
+
+   RecvDisp[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  RecvDisp[r] = RecvDisp[r-1] + RecvCount[r-1];
+
+   MPI_Alltoallv( SendBuf_PID, SendCount, SendDisp, MPI_LONG,
+                  RecvBuf_PID, RecvCount, RecvDisp, MPI_LONG, MPI_COMM_WORLD );
+
+   MPI_Alltoallv( SendBuf_I,   SendCount, SendDisp, MPI_INT,
+                  RecvBuf_I,   RecvCount, RecvDisp, MPI_INT,  MPI_COMM_WORLD );
+
+// 3.4 persistent requests of the potential exchange
+   Sch_InitRequest( Sch_Req_Phi, Sch_NReq_Phi, SendBuf_Phi, RecvBuf_Phi, SendCount, SendDisp, RecvCount, RecvDisp, 1 );
+
+
+   Sch_Valid = true;
+
+} // FUNCTION : CylPoisson_BuildSchedule
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Sch_InitRequest
+// Description :  Create the persistent point-to-point requests of an all-to-all exchange of patch slices
+//
+// Note        :  1. Counts and displacements are in units of patch slices (PS1*PS1 reals)
+//                2. Ranks without data to exchange are skipped
+//
+// Parameter   :  Req       : Array to store the requests (with at least 2*MPI_NRank elements)
+//                NReq      : Number of requests created
+//                SendBuf   : Send buffer
+//                RecvBuf   : Recv buffer
+//                SendCount : Number of patch slices sent to each rank
+//                SendDisp  : Offset of the patch slices sent to each rank
+//                RecvCount : Number of patch slices received from each rank
+//                RecvDisp  : Offset of the patch slices received from each rank
+//                Tag       : MPI tag
+//-------------------------------------------------------------------------------------------------------
+void Sch_InitRequest( MPI_Request *Req, int &NReq, void *SendBuf, void *RecvBuf, const int SendCount[],
+                      const int SendDisp[], const int RecvCount[], const int RecvDisp[], const int Tag )
+{
+
+   const int PSSize = PS1*PS1;
+
+   NReq = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( RecvCount[r] > 0 )
+         MPI_Recv_init( (real*)RecvBuf + (long)RecvDisp[r]*PSSize, RecvCount[r]*PSSize, MPI_DOUBLE, r, Tag,
+                        MPI_COMM_WORLD, &Req[ NReq ++ ] );
+
+      if ( SendCount[r] > 0 )
+         MPI_Send_init( (real*)SendBuf + (long)SendDisp[r]*PSSize, SendCount[r]*PSSize, MPI_DOUBLE, r, Tag,
+                        MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+} // FUNCTION : Sch_InitRequest
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylPoisson_FreeSchedule
+// Description :  Free the persistent slab <-> patch communication schedule
+//
+// Note        :  1. Invoked by LB_Init_LoadBalance() and End_MemFree_CylPoisson()
+//                2. The schedule will be reconstructed in the next call to CPU_CylPoissonSolver()
+//-------------------------------------------------------------------------------------------------------
+void CylPoisson_FreeSchedule()
+{
+
+   for (int t=0; t<Sch_NReq_Rho; t++)  MPI_Request_free( &Sch_Req_Rho[t] );
+   for (int t=0; t<Sch_NReq_Phi; t++)  MPI_Request_free( &Sch_Req_Phi[t] );
+
+   delete [] Sch_RhoPos;      Sch_RhoPos  = NULL;
+   delete [] Sch_PhiPos;      Sch_PhiPos  = NULL;
+   delete [] Sch_Req_Rho;     Sch_Req_Rho = NULL;
+   delete [] Sch_Req_Phi;     Sch_Req_Phi = NULL;
+
+   Sch_NReq_Rho  = 0;
+   Sch_NReq_Phi  = 0;
+   Sch_NSlab     = 0;
+   Sch_NSendSlab = 0;
+   Sch_Valid     = false;
+
+} // FUNCTION : CylPoisson_FreeSchedule
+
 
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Patch2Slab
 // Description :  (prepare for density)
+//
+// Note        :  1. Use the persistent schedule constructed by CylPoisson_BuildSchedule()
+//                   --> only the density values are exchanged
+//                2. The density is weighted by r' and, for OPT__CYL_RGRID, by the radial cell width dr'/dh
+//                   (see CylKernel_Pair)
 //-------------------------------------------------------------------------------------------------------
-void Patch2Slab(real **RhoK, int SlabID2Rank[], long SlabID2PID[], const double PrepTime, 
-                const int local_ny, const int global_nxp_start ) {
-                      
+void Patch2Slab(real **RhoK, const double PrepTime, const int local_ny, const int global_nxp_start ) {
+
    //Aux_Message(stdout, "Rank = %d: In Function <%s>. \n", MPI_Rank, __FUNCTION__);
-   
+
    const int  PSSize           = PS1*PS1;                                // patch slice size
-   const int  Scale0           = amr->scale[0];
    const int  NPatchY          = NX0_TOT[1]/PS1;
    const int  NPatchZ          = NX0_TOT[2]/PS1;
-   const int  NSlab            = amr->NPatchComma[0][1]*PS1;
-   const long NSlabTotal       = NPatchTotal[0]*PS1;
    const int  global_nxp_slab  = global_nxp * NPatchY * NPatchZ;
    const long global_nxp_total = global_nxp * NX0_TOT[1] * NX0_TOT[2];
-   
-   int  Cr[3], BPos_Xp;
-   int  TRANK_IP, TRANK_I, TRank;
-   long SlabID;                                 // need this?
-   real radius_p; // radius prime (r')
-   
-   int  SendCount[MPI_NRank], RecvCount[MPI_NRank], SendCount_Rho[MPI_NRank], RecvCount_Rho[MPI_NRank];
-   int  SendDisp [MPI_NRank], RecvDisp [MPI_NRank], SendDisp_Rho [MPI_NRank], RecvDisp_Rho [MPI_NRank];
-   int  TempBuf_Rank [ NSlab ] ;
-   long TempBuf_PID  [ NSlab ], TempBuf_SlabID [ NSlab ] ;
-   int  ListAllRank  [ NSlabTotal ];
-   long ListAllPID   [ NSlabTotal ], ListAllSlabID  [ NSlabTotal ];
-   vector< vector<int>  > TempBuf_IDPlanXp(MPI_NRank);
-   vector< vector<long> > TempBuf_IDPlanYZ(MPI_NRank);
-   vector< vector<real> > TempBuf_Rho     (MPI_NRank);
-   
-   
-// 2. prepare the temporary send buffer and record lists
+
+
+// 2. prepare the send buffer
    const OptPotBC_t  PotBC_None        = BC_POT_NONE;
    const IntScheme_t IntScheme         = INT_NONE;
    const NSide_t     NSide_None        = NSIDE_00;
@@ -60,284 +334,124 @@ void Patch2Slab(real **RhoK, int SlabID2Rank[], long SlabID2PID[], const double
    const real        MinDens_No        = -1.0;
    const real        MinPres_No        = -1.0;
    const int         GhostSize         = 0;
-   const int         NPG               = 1;
+   const int         NPG               = amr->NPatchComma[0][1]/8;
 
    real (*Dens)[PS1][PS1][PS1] = new real [8*NPG][PS1][PS1][PS1];
-   
-   int idx = 0 ;     // tracking 1D index - TempBuf_Rank, TempBuf_PID, TempBuf_SlabID
-   
-   for (int r=0; r<MPI_NRank; r++)  SendCount[r] = 0;  // initialization
-   
-   for (int PID0=0; PID0<amr->NPatchComma[0][1]; PID0+=8) {
-//    even with NSIDE_00 and GhostSize=0, we still need OPT__BC_FLU to determine whether periodic BC is adopted
-//    also note that we do not check minimum density here since no ghost zones are required
-      Prepare_PatchData( 0, PrepTime, Dens[0][0][0], GhostSize, NPG, &PID0, _DENS,
-                         IntScheme, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
-                         MinDens_No, MinPres_No, DE_Consistency_No );
-      
-      for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++) {
-         // determine the x/y/z-index in this patch
-         for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / Scale0;
-         
-         for (int ip=0; ip<PS1; ip++) {
-            // BPos_Xp = RANK_I*global_nxp + RANK_IP*local_nxp + residual_nxp_in_that_rank
-            BPos_Xp  = Cr[0] + ip;
-            SlabID   = (long)( BPos_Xp*NPatchZ + int(Cr[2]/PS1) ) * NPatchY + int(Cr[1]/PS1) ;
-            radius_p = Aux_Coord_CellIdx2AdoptedCoord(0, PID, 0, ip);
-            
-            // find TRANK_IP and TRANK_I
-            TRANK_IP = int( BPos_Xp/global_nxp_unit );            
-            TRANK_I  = 0;  
-            TRank    = TRANK_IP*(RANK_I_TOT) + TRANK_I ; 
-                        
-            TempBuf_IDPlanXp[TRank].push_back( BPos_Xp );
-            TempBuf_IDPlanYZ[TRank].push_back( Cr[2]*local_ny + Cr[1] );
-            
-            for (int k=0; k<PS1; k++) {  
-            for (int j=0; j<PS1; j++) {
-               TempBuf_Rho[TRank].push_back( Dens[LocalID][k][j][ip] * radius_p );
-            }}
-            SendCount[TRank] ++;
-            
-            TempBuf_Rank  [idx] = MPI_Rank ; 
-            TempBuf_PID   [idx] = PID ;
-            TempBuf_SlabID[idx] = SlabID ;
-            idx ++ ;
-            
-         } // for (ip=0; ip<PS1; ... )
-      } // for (PID=PID0, LocalID=0; PID<PID0+8; ... )  
-   } // for (PID0=0; PID0<amr->NPatchComma[0][1]; ...)
-   
+   int   *PID0_List            = new int  [NPG];
+
+// 2.1 prepare the density of all local patches at once so that Prepare_PatchData() can use all threads
+//     --> even with NSIDE_00 and GhostSize=0, we still need OPT__BC_FLU to determine whether periodic BC is adopted
+//     --> also note that we do not check minimum density here since no ghost zones are required
+   for (int t=0; t<NPG; t++)  PID0_List[t] = 8*t;
+
+   Prepare_PatchData( 0, PrepTime, Dens[0][0][0], GhostSize, NPG, PID0_List, _DENS,
+                      IntScheme, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
+                      MinDens_No, MinPres_No, DE_Consistency_No );
+
+// 2.2 fill in the send buffer
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<amr->NPatchComma[0][1]; PID++)
+   for (int ip=0; ip<PS1; ip++) {
+      const long Pos      = Sch_RhoPos[ PID*PS1 + ip ];
+      real radius_p = Aux_Coord_CellIdx2AdoptedCoord(0, PID, 0, ip);   // radius prime (r')
+
+      if ( OPT__CYL_RGRID != CYL_RGRID_UNIFORM )
+         radius_p *= Aux_Coord_CellIdx2CellWidth(0, PID, 0, ip) / amr->dh[0][0];
+
+      for (int k=0; k<PS1; k++) {
+      for (int j=0; j<PS1; j++) {
+         SendBuf_Rho[ Pos*PSSize + k*PS1 + j ] = Dens[PID][k][j][ip] * radius_p;
+      }}
+   } // for PID, ip
+
    delete [] Dens;
-   
-   
-// 3.0 prepare SlabID2Rank, SlabID2PID
-   int ListAllNSlab[MPI_NRank], NSlabDisp[MPI_NRank]; 
-   
-   MPI_Allgather( &NSlab, 1, MPI_INT, ListAllNSlab, 1, MPI_INT, MPI_COMM_WORLD ); 
-   
-   NSlabDisp[0] = 0;
-   for (int r=1; r<MPI_NRank; r++) 
-      NSlabDisp[r] = NSlabDisp[r-1] + ListAllNSlab[r-1];
-   
-   MPI_Allgatherv( TempBuf_Rank,   NSlab, MPI_INT,  ListAllRank,   ListAllNSlab, NSlabDisp, MPI_INT,  MPI_COMM_WORLD );
-   MPI_Allgatherv( TempBuf_PID,    NSlab, MPI_LONG, ListAllPID,    ListAllNSlab, NSlabDisp, MPI_LONG, MPI_COMM_WORLD );
-   MPI_Allgatherv( TempBuf_SlabID, NSlab, MPI_LONG, ListAllSlabID, ListAllNSlab, NSlabDisp, MPI_LONG, MPI_COMM_WORLD );
-   
-   
-   long SID ;
-   for (long t=0; t<NSlabTotal; t++) {
-      SID              = ListAllSlabID[t]; 
-      SlabID2Rank[SID] = ListAllRank[t]; 
-      SlabID2PID [SID] = ListAllPID [t];
-   }
-   
-// 3.1 broadcast the number of elements sending to different ranks
-   MPI_Alltoall( SendCount, 1, MPI_INT, RecvCount, 1, MPI_INT, MPI_COMM_WORLD );
+   delete [] PID0_List;
 
-   
-   for (int r=0; r<MPI_NRank; r++)  {
-      SendCount_Rho[r] = SendCount[r]*PSSize;
-      RecvCount_Rho[r] = RecvCount[r]*PSSize;
-   }
-   
-   //// construct SendDisp, RecvDisp
-   SendDisp[0]     = 0;
-   RecvDisp[0]     = 0;
-   SendDisp_Rho[0] = 0;
-   RecvDisp_Rho[0] = 0;
-   
-   for (int r=1; r<MPI_NRank; r++) {
-      SendDisp    [r] = SendDisp    [r-1] + SendCount    [r-1] ;
-      SendDisp_Rho[r] = SendDisp_Rho[r-1] + SendCount_Rho[r-1] ;
-      RecvDisp    [r] = RecvDisp    [r-1] + RecvCount    [r-1] ;
-      RecvDisp_Rho[r] = RecvDisp_Rho[r-1] + RecvCount_Rho[r-1] ;
-   }
-   
-   
-// 3.2 prepare the send buffer of Rank   
-   Flatten2DVec(TempBuf_Rho,      SendBuf_Rho     );
-   Flatten2DVec(TempBuf_IDPlanXp, SendBuf_IDPlanXp);
-   Flatten2DVec(TempBuf_IDPlanYZ, SendBuf_IDPlanYZ);
-   
-   
-// 4. exchange data by MPI 
+
+// 4. exchange data by MPI
 // 4.1 first exange data to rank w/ i=0
-   MPI_Alltoallv( SendBuf_IDPlanXp, SendCount, SendDisp, MPI_INT,
-                  RecvBuf_IDPlanXp, RecvCount, RecvDisp, MPI_INT, MPI_COMM_WORLD );
-   
-   MPI_Alltoallv( SendBuf_IDPlanYZ, SendCount, SendDisp, MPI_LONG,
-                  RecvBuf_IDPlanYZ, RecvCount, RecvDisp, MPI_LONG, MPI_COMM_WORLD );
-                  
-   MPI_Alltoallv( SendBuf_Rho, SendCount_Rho, SendDisp_Rho, MPI_DOUBLE,
-                  RecvBuf_Rho, RecvCount_Rho, RecvDisp_Rho, MPI_DOUBLE, MPI_COMM_WORLD );
-                  
+   MPI_Startall( Sch_NReq_Rho, Sch_Req_Rho );
+   MPI_Waitall ( Sch_NReq_Rho, Sch_Req_Rho, MPI_STATUSES_IGNORE );
+
 // 4.2 broadcast data along ip=const
-   MPI_Bcast( RecvBuf_IDPlanXp, global_nxp_slab,  MPI_INT,    0, rank_ip_comm );
-   MPI_Bcast( RecvBuf_IDPlanYZ, global_nxp_slab,  MPI_LONG,   0, rank_ip_comm );
-   MPI_Bcast( RecvBuf_Rho,      global_nxp_total, MPI_DOUBLE, 0, rank_ip_comm );
-   
+   MPI_Bcast( RecvBuf_Rho, global_nxp_total, MPI_DOUBLE, 0, rank_ip_comm );
+
 
 // 5. store the received density to the padded array "RhoK" for FFTW
-   long count = 0 ;
-   int ID_planXp, jj ;
-   long ID_planYZ;
-   
+//    --> different slabs never overlap
+#  pragma omp parallel for schedule( static )
    for (long t=0; t<global_nxp_slab ; t++)
    {
-      ID_planXp = RecvBuf_IDPlanXp[t] - global_nxp_start;
-      ID_planYZ = RecvBuf_IDPlanYZ[t];
+      const int  ID_planXp = RecvBuf_IDPlanXp[t] - global_nxp_start;
+      const long ID_planYZ = RecvBuf_IDPlanYZ[t];
+      long count = t*PSSize ;
 
       for (int j=0; j<PS1; j++) {
       for (int i=0; i<PS1; i++) {
-         jj = ID_planYZ + j*local_ny + i;
+         const long jj = ID_planYZ + j*local_ny + i;
          RhoK[ID_planXp][ jj ] = RecvBuf_Rho[ count ];
          count ++ ;
       }}
    }
-   
-} // FUNCTION: Patch2Slab
 
-
-//-------------------------------------------------------------------------------------------------------
-// Function    :  Flatten2DArray
-// Description :  traverse a 2D vector into a 1D array
-//-------------------------------------------------------------------------------------------------------
-template <class T>
-void Flatten2DVec( vector< vector<T> > Vec, T Array[] ){
-   
-   typename vector< vector<T> >::iterator row ;
-   typename vector<T>::iterator col ;
-   
-   int curr = 0 ;     // array index
-   
-   for ( row = Vec.begin();  row != Vec.end();  row++ ) {
-   for ( col = row->begin(); col != row->end(); col++ ) {
-      Array[curr] = *col ;
-      curr ++ ;
-   }}
-      
-}
+} // FUNCTION: Patch2Slab
 
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Slab2Patch
 // Description :  displace PhiK back to patch data
-//                1. fill in TempBufPhi
-//                2. flatten TempBufPhi to SendBufPhi for sending
-//                3. distribute SendCount
-//                4. construct SendDisp, RecvDisp
+//                1. fill in SendBuf_Phi
+//                2. exchange SendBuf_Phi with the persistent schedule constructed by CylPoisson_BuildSchedule()
+//                3. save the received potential to patches
 //-------------------------------------------------------------------------------------------------------
-void Slab2Patch(real **PhiK, const int SaveSg, int SlabID2Rank[], long SlabID2PID[],
-                const int local_ny, const int global_nx_start, const real Coeff ) {
-                   
+void Slab2Patch(real **PhiK, const int SaveSg, const int local_ny, const int global_nx_start, const real Coeff ) {
+
    //Aux_Message(stdout, "Rank = %d: In Function <%s>. \n", MPI_Rank, __FUNCTION__);
-                         
+
    const int  PSSize        = PS1 * PS1;
    const real fftw_norm     = (real) 1.0 / (real) ( NX0_TOT[1]*((real)2.0*NX0_TOT[2]) ) ;
-   const long NRecvSlab     = (long)amr->NPatchComma[0][1]*PS1;   // total number of received patch slices
    const int  NPatchY       = NX0_TOT[1]/PS1;
    const int  NPatchZ       = NX0_TOT[2]/PS1;
-   
-   vector< vector<real> > TempBuf_Phi( MPI_NRank );
-   vector< vector<long> > TempBuf_PID( MPI_NRank );
-   vector< vector<int>  > TempBuf_I  ( MPI_NRank );
-   
-   int  SendCount[MPI_NRank], RecvCount[MPI_NRank], SendCount_Phi[MPI_NRank], RecvCount_Phi[MPI_NRank];
-   int  SendDisp [MPI_NRank], RecvDisp [MPI_NRank], SendDisp_Phi [MPI_NRank], RecvDisp_Phi [MPI_NRank];
-   int  Cr0, Cr1, Cr2, ii, jj, kk, TRank;
-   long SlabID, PID, ID_planYZ;  
-   
-   // initialization
-   for (int r=0; r<MPI_NRank; r++)  SendCount[r] = 0;
-   
-   // 1. loop over all slabs and save to a 2D TempBuf vector
-   if (RANK_IP == 0) {
-      
-      for (int i=0; i<global_nx; i++ ) {
-         Cr0 = global_nx_start + i; 
-      
-         // loop over all slabs
-         for (Cr2 = 0; Cr2 < NX0_TOT[2]; Cr2 += PS1) 
-         for (Cr1 = 0; Cr1 < NX0_TOT[1]; Cr1 += PS1) {
-         
-            SlabID = (long)( Cr0*NPatchZ + int(Cr2/PS1) ) * NPatchY + int(Cr1/PS1) ;
-            TRank  = SlabID2Rank[SlabID] ; 
-            PID    = SlabID2PID [SlabID] ;
-         
-            TempBuf_PID[TRank].push_back(PID);
-            TempBuf_I  [TRank].push_back(Cr0);
-         
-            // save Phi in TempBuf_Phi
-            for (int k=0; k<PS1; k++) { kk = Cr2 + k;
-            for (int j=0; j<PS1; j++) { jj = Cr1 + j;
-               ID_planYZ = kk*local_ny + jj ;
-               TempBuf_Phi[TRank].push_back( PhiK[i][ID_planYZ] );
-            }} // for j, k
-         
-            SendCount[TRank] ++ ;
-         
-         } // for Cr2, Cr1
-      } // for (int i=0; ... )
-   
-   
-   // 2. flatten 2D TempBuf vector to a 1D SendBuf array 
-      Flatten2DVec(TempBuf_Phi, SendBuf_Phi) ;
-      Flatten2DVec(TempBuf_PID, SendBuf_PID) ;
-      Flatten2DVec(TempBuf_I  , SendBuf_I  ) ; 
-   
-   } // if RANK_IP == 0
-   
 
-   // 3. distribute SendCount in all processors
-   MPI_Alltoall( SendCount, 1, MPI_INT, RecvCount, 1, MPI_INT, MPI_COMM_WORLD );
-   
-   for (int r=0; r<MPI_NRank; r++)  {
-      SendCount_Phi[r] = SendCount[r]*PSSize;
-      RecvCount_Phi[r] = RecvCount[r]*PSSize;
-   }
 
-   
-   // 4. Construct SendDisp, RecvDisp
-   SendDisp[0]     = 0;
-   RecvDisp[0]     = 0;
-   SendDisp_Phi[0] = 0;
-   RecvDisp_Phi[0] = 0;
-   
-   for (int r=1; r<MPI_NRank; r++) {
-      SendDisp    [r] = SendDisp    [r-1] + SendCount    [r-1] ;
-      SendDisp_Phi[r] = SendDisp_Phi[r-1] + SendCount_Phi[r-1] ;
-      RecvDisp    [r] = RecvDisp    [r-1] + RecvCount    [r-1] ;
-      RecvDisp_Phi[r] = RecvDisp_Phi[r-1] + RecvCount_Phi[r-1] ;
-   }
-   
-   
-   // 5. distribute SendBuf_Phi, SendBuf_PID, SendBuf_I
-   MPI_Alltoallv( SendBuf_Phi, SendCount_Phi, SendDisp_Phi, MPI_DOUBLE, 
-                  RecvBuf_Phi, RecvCount_Phi, RecvDisp_Phi, MPI_DOUBLE, MPI_COMM_WORLD );
-                  
-   MPI_Alltoallv( SendBuf_PID, SendCount, SendDisp, MPI_LONG, 
-                  RecvBuf_PID, RecvCount, RecvDisp, MPI_LONG, MPI_COMM_WORLD );
-   
-   MPI_Alltoallv( SendBuf_I,   SendCount, SendDisp, MPI_INT, 
-                  RecvBuf_I,   RecvCount, RecvDisp, MPI_INT, MPI_COMM_WORLD );
-   
+   // 1. loop over all slabs of the PhiK rows owned by this rank and save them to the send buffer
+   //    --> slab index t = ( i*NPatchZ + Cr2/PS1 )*NPatchY + Cr1/PS1, where i is the local row of PhiK
+#  pragma omp parallel for schedule( static )
+   for (int t=0; t<Sch_NSendSlab; t++) {
+      const int  i      = t / (NPatchZ*NPatchY);
+      const int  Cr2    = ( (t/NPatchY) % NPatchZ )*PS1;
+      const int  Cr1    = ( t % NPatchY )*PS1;
+      const long Pos    = Sch_PhiPos[t];
 
-   // 6. save the patch data back to sandglass 
-   int count = 0 ;
-   
-   for (int t=0; t<NRecvSlab; t++) {
-      PID = RecvBuf_PID[t] ; 
-      ii  = RecvBuf_I  [t] ;
-      int i = ii % PS1 ;
-            
-      for (int k=0; k<PS1; k++) { 
-      for (int j=0; j<PS1; j++) { 
-         amr->patch[SaveSg][0][PID]->pot[k][j][i] = RecvBuf_Phi[count] * fftw_norm ; 
+      // save Phi in the send buffer
+      for (int k=0; k<PS1; k++) { const int kk = Cr2 + k;
+      for (int j=0; j<PS1; j++) { const int jj = Cr1 + j;
+         const long ID_planYZ = (long)kk*local_ny + jj ;
+         SendBuf_Phi[ Pos*PSSize + k*PS1 + j ] = PhiK[i][ID_planYZ];
+      }} // for j, k
+   } // for (int t=0; t<Sch_NSendSlab; t++)
+
+
+   // 2. distribute SendBuf_Phi
+   MPI_Startall( Sch_NReq_Phi, Sch_Req_Phi );
+   MPI_Waitall ( Sch_NReq_Phi, Sch_Req_Phi, MPI_STATUSES_IGNORE );
+
+
+   // 3. save the patch data back to sandglass
+   //    --> each received slab is a distinct slice of a local patch
+#  pragma omp parallel for schedule( static )
+   for (int t=0; t<Sch_NSlab; t++) {
+      const long PID   = RecvBuf_PID[t] ;
+      const int  i     = RecvBuf_I  [t] % PS1 ;
+      long       count = (long)t*PSSize ;
+
+      for (int k=0; k<PS1; k++) {
+      for (int j=0; j<PS1; j++) {
+         amr->patch[SaveSg][0][PID]->pot[k][j][i] = RecvBuf_Phi[count] * fftw_norm ;
          count++ ;
       }}
    }
-   
+
 }
 
 
@@ -345,83 +459,317 @@ void Slab2Patch(real **PhiK, const int SaveSg, int SlabID2Rank[], long SlabID2PI
 // Function    :  Pot_Isolated
 // Description :  Evaluate the gravitational potential in cyl coordinate
 //                1. FFT RhoK for in each rank with size local_nxp 
-//                   -> ###
-//                   -> ### use reinterpret_cast in FFTW3
+//                   -> complex data are accessed through CylComplex_t for both FFTW2 and FFTW3
 //                2. collect RhoK to rach rank to meet size global_nxp
 //                   -> ### use rank_ip_comm, instead of MPI_COMM
-//                3. integrate to get PhiK with size global_nx in each rank
-//                4. distribute PhiK to each rank with local_nx size, and copy data to meet right type
-//                   -> ### use reinterpret_cast in FFTW3
-//                5. iFFT PhiK back to real space
+//                3. integrate to get PhiK with size global_nx in each rank, one radial block at a time
+//                4. reduce each block to its owner in rank_i_comm with MPI_Ireduce as soon as the block is done
+//                   -> the reduction of a block overlaps with the integration of the following blocks
+//                   -> rows of PhiK are distributed over all ranks in rank_i_comm (see PhiK_OwnStart)
+//                5. iFFT the owned rows of PhiK back to real space
+//                   -> the inverse transforms are shared by all ranks instead of the RANK_IP == 0 ranks only
+//                6. only the azimuthal modes m < kernel_nm are integrated and reduced (see CYL_POISSON_MMAX)
+//                   -> PhiK_All stores these modes only
+//                   -> the reduced rows are expanded to PhiK with the higher modes set to zero
 //                   
 //-------------------------------------------------------------------------------------------------------
 void Pot_Isolated( real ** RhoK, real ** PhiK, const long slab_size ){
    
    //Aux_Message(stdout, "Rank = %d: In Function <%s>. \n", MPI_Rank, __FUNCTION__);         
    
-   fftw_complex *RhoK_cplx, Temp_cplx;
-   fftw_complex *PhiK_cplx, *SubKernel;
-   real         *PhiK_re_ptr, *PhiK_im_ptr;
-   int          ID_planX, CommCount, target_rank;
-   const long   slab_size_hf = slab_size/2; 
+   const int    kernel_ny    = NX0_TOT[1]/2 + 1;
+   const int    FFT_nz       = 2*NX0_TOT[2];
+   const bool   Truncated    = ( kernel_nm < kernel_ny );
+   const long   row_size     = (long)2*FFT_nz*kernel_nm;   // size of each row of PhiK_All
+   const long   row_size_hf  = row_size/2;
+   const int    NOwn         = PhiK_OwnStart[RANK_IP+1] - PhiK_OwnStart[RANK_IP];
+   const int    NRowBlock    = MAX( 1, (int)( PHIK_BLOCK_MB*1048576.0/(row_size*sizeof(real)) ) );
    
    
    // 1. collect all RhoK along ip=const direction   
-   for (int ip=0; ip<global_nxp; ip++) 
-      rfftwnd_one_real_to_complex( FFTW_Plan, RhoK[ip], NULL );
+   //    --> all slabs are transformed in one call (see CylFFTW_Forward)
+   CylFFTW_Forward( RhoK, global_nxp );
+   
+   // 3. integrate locally over r' to get partially integrated PhiK in each rank
+   //    --> use the H-matrix kernel if it is constructed (CYL_HMATRIX_TOL > 0)
+   //        --> it works on all rows at once, so only the reduction of different blocks is pipelined
+   if ( KernelHMat_Data != NULL )
+      Pot_Isolated_HMatrix( RhoK, row_size_hf ) ;
    
-   // 3. integrate to get PhiK
-   // 3.1 set PhiK to zeros
-   for (int t=0; t<global_nx*slab_size_hf; t++ )   PhiK_All_re[t] = PhiK_All_im[t] = (real) 0.0;
    
-   // 3.2 integrate locally over r' to get partially integrated PhiK in each rank
-   for (int i=0; i<global_nx; i++ ){
-      PhiK_re_ptr = & PhiK_All_re[i*slab_size_hf] ; 
-      PhiK_im_ptr = & PhiK_All_im[i*slab_size_hf] ;
+   // 4. add PhiK across different rank for total summation/integration
+   //    --> the rows owned by rank q are split into blocks of at most NRowBlock rows, and each block
+   //        is reduced to rank q in rank_i_comm once it is integrated
+   //    --> all ranks in rank_i_comm have the same global_nx and PhiK_OwnStart, so they post the
+   //        reductions in the same order
+   int NReq = 0, Done;
+   MPI_Request *Req = new MPI_Request [ global_nx/NRowBlock + RANK_IP_TOT ];
+   
+   for (int q=0; q<RANK_IP_TOT; q++)
+   for (int i0=PhiK_OwnStart[q]; i0<PhiK_OwnStart[q+1]; i0+=NRowBlock) {
+      const int ni = MIN( NRowBlock, PhiK_OwnStart[q+1]-i0 );
+      
+      if ( KernelHMat_Data == NULL )   Pot_Isolated_Dense( RhoK, i0, ni, row_size_hf ) ;
+      
+      // the owner reduces directly into its PhiK rows unless the azimuthal modes are truncated
+      real *RecvBuf = NULL;
       
-      for (int ip=0; ip<global_nxp; ip++){
-         ID_planX  = i*global_nxp + ip ;
+      if ( q == RANK_IP )
+         RecvBuf = ( Truncated ) ? PhiK_Recv + (long)( i0-PhiK_OwnStart[q] )*row_size : PhiK[ i0-PhiK_OwnStart[q] ];
+      
+      MPI_Ireduce( PhiK_All + (long)i0*row_size, RecvBuf, ni*row_size, MPI_DOUBLE, MPI_SUM, q, rank_i_comm,
+                   &Req[NReq++] );
+      
+      // give MPI a chance to progress the posted reductions
+      MPI_Testall( NReq, Req, &Done, MPI_STATUSES_IGNORE );
+   }
+   
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+   
+   delete [] Req;
+   
+   // expand the truncated rows to PhiK
+   if ( Truncated )
+   {
+#     pragma omp parallel for schedule( static )
+      for (long t=0; t<(long)NOwn*FFT_nz; t++) {
+         const int           i     = t / FFT_nz;
+         const int           kz    = t % FFT_nz;
+         const CylComplex_t *Src   = (CylComplex_t *) PhiK_Recv + t*kernel_nm ;
+         CylComplex_t       *Dst   = (CylComplex_t *) PhiK[i] + (long)kz*kernel_ny ;
          
-         RhoK_cplx = (fftw_complex *) (RhoK[ip]);
-         SubKernel = (fftw_complex *) KernelFuncK[ID_planX];
+         for (int ky=0;         ky<kernel_nm; ky++)  Dst[ky] = Src[ky];
+         for (int ky=kernel_nm; ky<kernel_ny; ky++)  Dst[ky].re = Dst[ky].im = (real) 0.0;
+      }
+   }
+   
+   
+   // 5. iFFT PhiK back to real space 
+   CylFFTW_Inverse( PhiK, NOwn );
+   
+}
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pot_Isolated_Dense
+// Description :  Radial convolution of Pot_Isolated() with the compressed dense kernel for the rows
+//                i0 ... i0+ni-1 of PhiK_All
+//
+// Note        :  1. The compressed kernel is real and even in kz (see Init_CylKernel), so each mode only
+//                   needs a real-complex product and kz > NX0_TOT[2] is mapped back to FFT_nz-kz
+//                   --> kz is the row index of RhoK and PhiK_All mapped by KzUnique()
+//                2. OpenMP-parallelized over kz of each row so that a block with only a few rows still
+//                   uses all threads
+//                3. Only the azimuthal modes ky < kernel_nm are integrated
+//-------------------------------------------------------------------------------------------------------
+void Pot_Isolated_Dense( real ** RhoK, const int i0, const int ni, const long row_size_hf ){
+   
+   const int kernel_ny = NX0_TOT[1]/2 + 1;
+   const int FFT_nz    = 2*NX0_TOT[2];
+   
+#  pragma omp parallel
+   for (int i=i0; i<i0+ni; i++ ){
+      CylComplex_t *PhiK_cplx = (CylComplex_t *) PhiK_All + i*row_size_hf ; 
+      
+#     pragma omp for schedule( static )
+      for (int kz=0; kz<FFT_nz; kz++) {
+         const int     kz_unique = KzUnique( kz ) ;
+         CylComplex_t *PhiK_kz   = PhiK_cplx + kz*kernel_nm ;
+         
+         for (int ky=0; ky<kernel_nm; ky++)  PhiK_kz[ky].re = PhiK_kz[ky].im = (real) 0.0;
          
+         for (int ip=0; ip<global_nxp; ip++){
+            const int           ID_planX     = KernelPairIdx[ i*global_nxp + ip ] ;
+            const CylComplex_t *RhoK_kz      = (CylComplex_t *) (RhoK[ip]) + kz*kernel_ny ;
+            const real         *SubKernel_kz = KernelFuncK[ID_planX] + kz_unique*kernel_nm ;
+            
+            for (int ky=0; ky<kernel_nm; ky++) {
+               const CylComplex_t Temp_cplx = RhoK_kz[ky];
+               const real         Kernel    = SubKernel_kz[ky];
+               
+               PhiK_kz[ky].re += Temp_cplx.re * Kernel ;
+               PhiK_kz[ky].im += Temp_cplx.im * Kernel ;
+            }
+         } // for (ip=0; ...)
+      } // for (kz=0; ...)
+   } // for (i=i0; ...)
+   
+} // FUNCTION : Pot_Isolated_Dense
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pot_Isolated_HMatrix
+// Description :  Radial convolution of Pot_Isolated() with the H-matrix kernel
+//
+// Note        :  1. Store the partially integrated potential of this rank in PhiK_All
+//                2. For each (kz,ky) mode, gather RhoK(ip) and apply the blocks of the unique mode
+//                   u = kz_unique*kernel_nm + ky (see Init_CylKernel_HMatrix)
+//                   --> low-rank blocks cost rank*(ni+nip) instead of ni*nip operations
+//                3. OpenMP-parallelized over kz
+//                4. Only the azimuthal modes ky < kernel_nm are integrated
+//-------------------------------------------------------------------------------------------------------
+void Pot_Isolated_HMatrix( real ** RhoK, const long row_size_hf ){
+   
+   const int kernel_ny = NX0_TOT[1]/2 + 1;
+   const int FFT_nz    = 2*NX0_TOT[2];
+   
+#  pragma omp parallel
+   {
+   real *X_re = new real [global_nxp];
+   real *X_im = new real [global_nxp];
+   real *Y_re = new real [global_nx ];
+   real *Y_im = new real [global_nx ];
+   
+// parallelize over kz so that each thread writes entire kz rows of PhiK_All
+#  pragma omp for schedule( static )
+   for (int kz=0; kz<FFT_nz; kz++) {
+      const int kz_unique = KzUnique( kz ) ;
+      
+   for (int ky=0; ky<kernel_nm; ky++) {
+      const long t = (long)kz*kernel_nm + ky ;
+      const long u = (long)kz_unique*kernel_nm + ky ;
+      
+      // gather RhoK of this mode
+      for (int ip=0; ip<global_nxp; ip++) {
+         const CylComplex_t Rho = ( (CylComplex_t *)RhoK[ip] )[ (long)kz*kernel_ny + ky ];
+         X_re[ip] = Rho.re;
+         X_im[ip] = Rho.im;
+      }
+      
+      for (int i=0; i<global_nx; i++)  Y_re[i] = Y_im[i] = (real) 0.0;
       
-         for (long t=0; t<slab_size_hf; t++) {
-            Temp_cplx = RhoK_cplx[t];
+      // apply all blocks of this mode
+      for (int b=0; b<KernelHMat_NBlock; b++) {
+         const int   i0   = KernelHMat_Block[b][0];
+         const int   ni   = KernelHMat_Block[b][1];
+         const int   ip0  = KernelHMat_Block[b][2];
+         const int   nip  = KernelHMat_Block[b][3];
+         const int   Rank = KernelHMat_Rank  [ u*KernelHMat_NBlock + b ];
+         const real *Data = KernelHMat_Data + KernelHMat_Offset[ u*KernelHMat_NBlock + b ];
+         
+         // dense block
+         if ( Rank < 0 ) {
+            for (int a=0; a<ni; a++) {
+               const real *Row = Data + a*nip;
+               real Sum_re = (real) 0.0, Sum_im = (real) 0.0;
+               
+               for (int c=0; c<nip; c++) {
+                  Sum_re += Row[c]*X_re[ ip0+c ];
+                  Sum_im += Row[c]*X_im[ ip0+c ];
+               }
+               
+               Y_re[ i0+a ] += Sum_re;
+               Y_im[ i0+a ] += Sum_im;
+            }
+         }
+         
+         // low-rank block
+         else {
+            const real *U = Data;
+            const real *V = Data + Rank*ni;
             
-            PhiK_re_ptr[t] += Temp_cplx.re * SubKernel[t].re - Temp_cplx.im * SubKernel[t].im ;
-            PhiK_im_ptr[t] += Temp_cplx.re * SubKernel[t].im + Temp_cplx.im * SubKernel[t].re ;            
+            for (int r=0; r<Rank; r++) {
+               real W_re = (real) 0.0, W_im = (real) 0.0;
+               
+               for (int c=0; c<nip; c++) {
+                  W_re += V[ r*nip + c ]*X_re[ ip0+c ];
+                  W_im += V[ r*nip + c ]*X_im[ ip0+c ];
+               }
+               
+               for (int a=0; a<ni; a++) {
+                  Y_re[ i0+a ] += U[ r*ni + a ]*W_re;
+                  Y_im[ i0+a ] += U[ r*ni + a ]*W_im;
+               }
+            }
          }
-      } // for (ip=0; ...)
-   } // for (i=0; ...)
+      } // for (int b=0; b<KernelHMat_NBlock; b++)
+      
+      // scatter PhiK of this mode
+      for (int i=0; i<global_nx; i++) {
+         CylComplex_t *PhiK_cplx = (CylComplex_t *) PhiK_All + i*row_size_hf + t ;
+         PhiK_cplx->re = Y_re[i];
+         PhiK_cplx->im = Y_im[i];
+      }
+   }} // for kz, ky
    
+   delete [] X_re;
+   delete [] X_im;
+   delete [] Y_re;
+   delete [] Y_im;
+   } // OpenMP parallel region
    
-   // 4. add PhiK across different rank for total summation/integration
-   CommCount = global_nx * slab_size_hf;
+} // FUNCTION : Pot_Isolated_HMatrix
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pot_TruncationError
+// Description :  Estimate the error of truncating the azimuthal modes (CYL_POISSON_MMAX) from the discarded
+//                power of the transformed density RhoK and record it in "Record__CylPoissonMMax"
+//
+// Note        :  1. Error estimate = sqrt( sum_{m >= kernel_nm} |RhoK|^2 / sum_{all m} |RhoK|^2 )
+//                   --> relative L2 norm of the discarded r'*rho, which bounds the relative error of the
+//                       potential since the kernel decreases with m
+//                   --> the modes 0 < m < NX0_TOT[1]/2 are counted twice for the r2c half spectrum
+//                2. All ranks with the same RANK_IP have the same RhoK, so only the ranks with RANK_I == 0
+//                   compute the sum, which is then reduced to MPI_Rank 0 in rank_i_comm
+//
+// Parameter   :  RhoK     : Transformed density
+//                PrepTime : Physical time of the density
+//-------------------------------------------------------------------------------------------------------
+void Pot_TruncationError( real ** RhoK, const double PrepTime ){
    
-   MPI_Reduce( PhiK_All_re, PhiK_local_re, CommCount, MPI_DOUBLE, MPI_SUM, 0, rank_i_comm) ; 
-   MPI_Reduce( PhiK_All_im, PhiK_local_im, CommCount, MPI_DOUBLE, MPI_SUM, 0, rank_i_comm) ;
+   const char  FileName[] = "Record__CylPoissonMMax";
+   static bool FirstTime  = true;
    
+   const int   kernel_ny  = NX0_TOT[1]/2 + 1;
+   const int   FFT_nz     = 2*NX0_TOT[2];
    
-   if (RANK_IP == 0) {
-      // copy PhiK_local to PhiK
-      // ### can this possibly be done through memcpy
-      PhiK_cplx = (fftw_complex *) PhiK[0] ;
-      for (int t=0; t<global_nx*slab_size_hf; t++) {
-         PhiK_cplx[t].re = PhiK_local_re[t] ;
-         PhiK_cplx[t].im = PhiK_local_im[t];  //###
+   if ( RANK_I != 0 )   return;
+   
+   double Power_Total = 0.0, Power_Discard = 0.0;
+   
+#  pragma omp parallel for schedule( static ) reduction( +:Power_Total, Power_Discard )
+   for (long t=0; t<(long)global_nxp*FFT_nz; t++) {
+      const int           ip     = t / FFT_nz;
+      const int           kz     = t % FFT_nz;
+      const CylComplex_t *RhoK_kz = (CylComplex_t *) (RhoK[ip]) + (long)kz*kernel_ny ;
+      
+      for (int ky=0; ky<kernel_ny; ky++) {
+         const double Weight = ( ky == 0  ||  2*ky == NX0_TOT[1] ) ? 1.0 : 2.0;
+         const double P      = Weight*( SQR( (double)RhoK_kz[ky].re ) + SQR( (double)RhoK_kz[ky].im ) );
+         
+         Power_Total += P;
+         if ( ky >= kernel_nm )  Power_Discard += P;
       }
+   }
    
+   double Power[2] = { Power_Total, Power_Discard }, Power_AllRank[2];
    
-   // 5. iFFT PhiK back to real space 
-      for ( int i=0; i<global_nx; i++ ) {
-         PhiK_cplx = (fftw_complex *) PhiK[i] ;
-         rfftwnd_one_complex_to_real( FFTW_Plan_Inv, PhiK_cplx, NULL );
-      } 
+   MPI_Reduce( Power, Power_AllRank, 2, MPI_DOUBLE, MPI_SUM, 0, rank_i_comm );
    
-   } // if RANK_IP == 0
+   if ( MPI_Rank == 0 )
+   {
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+         
+         FILE *File = fopen( FileName, "a" );
+         fprintf( File, "# CYL_POISSON_MMAX = %d, number of retained azimuthal modes = %d (of %d)\n",
+                  CYL_POISSON_MMAX, kernel_nm, kernel_ny );
+         fprintf( File, "#%12s  %10s  %14s\n", "Time", "Step", "Error" );
+         fclose( File );
+         
+         FirstTime = false;
+      }
+      
+      FILE *File = fopen( FileName, "a" );
+      fprintf( File, "%13.7e  %10ld  %14.7e\n", PrepTime, Step,
+               ( Power_AllRank[0] > 0.0 ) ? sqrt( Power_AllRank[1]/Power_AllRank[0] ) : 0.0 );
+      fclose( File );
+   }
    
-}
+} // FUNCTION : Pot_TruncationError
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -434,8 +782,6 @@ void CPU_CylPoissonSolver( const real Poi_Coeff, const int SaveSg, const double
    
    // determine the FFT size; FFT_Size[0] is redundunt
    int  FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2]*2 };
-   int  SlabID2Rank[ NPatchTotal[0]*PS1 ] ;
-   long SlabID2PID [ NPatchTotal[0]*PS1 ] ;
    
 # ifdef SERIAL
    Aux_Message(stderr, "Cylindrical Self-Gravity is not yet ready for serial mode! \n");
@@ -450,21 +796,16 @@ void CPU_CylPoissonSolver( const real Poi_Coeff, const int SaveSg, const double
 # endif // ifdef SERIAL, else...
    
    
-   // init RhoK array to zerol
-   for (int ip=0; ip<global_nxp; ip++)
-   for (int t=0;  t<slab_size;  t++ ) {
-      RhoK[ip][t] = (real) 0.0;
-   }
+   // RhoK does not need to be initialized since Patch2Slab() fills all z < NX0_TOT[2] rows and the zero-padded
+   // half is never read by CylFFTW_Forward()
+   // PhiK does not need to be initialized since it is entirely overwritten by the reduction in Pot_Isolated()
    
-   // ### need to do it to PhiK as well??
-   for (int i=0; i<global_nx;  i++)
-   for (int t=0; t<slab_size; t++ ) {
-      PhiK[i][t] = (real) 0.0;
-   }
    
+   // 0. construct the slab <-> patch communication schedule if it has been invalidated (e.g., by load balancing)
+   if ( !Sch_Valid )    CylPoisson_BuildSchedule( local_ny, global_nxp_start, global_nx_start );
    
    // 1. get (real)RhoK[ip] - Patch2Slab()
-   Patch2Slab( RhoK, SlabID2Rank, SlabID2PID, PrepTime, local_ny, global_nxp_start ) ;
+   Patch2Slab( RhoK, PrepTime, local_ny, global_nxp_start ) ;
    
    // 2.
    if ( OPT__BC_POT == BC_POT_ISOLATED ) 
@@ -472,8 +813,11 @@ void CPU_CylPoissonSolver( const real Poi_Coeff, const int SaveSg, const double
    else
       Aux_Error( ERROR_INFO, "Cylindrical poisson sovler only support isolated boundary condition. \n");
    
+   // record the error of truncating the azimuthal modes (RhoK is left in k-space by Pot_Isolated)
+   if ( kernel_nm < NX0_TOT[1]/2 + 1 )    Pot_TruncationError( RhoK, PrepTime ) ;
+   
    // 3.
-   Slab2Patch( PhiK, SaveSg, SlabID2Rank, SlabID2PID, local_ny, global_nx_start, Poi_Coeff ) ;
+   Slab2Patch( PhiK, SaveSg, local_ny, global_nx_start, Poi_Coeff ) ;
    
 
 } // CPU_CylPoissonSolver_FFT
@@ -4,6 +4,9 @@
 
 
 
+// the slab-decomposed solver below is only used by the Cartesian coordinates
+// --> the cylindrical solver is implemented in CPU_CylPoissonSolver.cpp
+#if ( COORDINATE == CARTESIAN )
 static void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const int RhoK_Size );
 static void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const int RhoK_Size );
 static int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess );
@@ -580,6 +583,7 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const i
 
 
 } // FUNCTION : FFT_Isolated
+#endif // #if ( COORDINATE == CARTESIAN )
 
 
 
@@ -48,42 +48,62 @@ void End_MemFree_PoissonGravity()
    if ( GreenFuncK != NULL )  delete [] GreenFuncK;
    
 #  elif ( COORDINATE == CYLINDRICAL )
+   End_MemFree_CylPoisson();
+   
+#  endif // COORDINATE 
+
+} // FUNCTION : End_MemFree_PoissonGravity
+
+
+
+#if ( COORDINATE == CYLINDRICAL )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  End_MemFree_CylPoisson
+// Description :  Free memory and communicators allocated by Init_CylKernel() and Init_MemAllocate_CylPoisson()
+//
+// Note        :  1. All pointers are reset to NULL so that Init_CylKernel() can be invoked again
+//                   (e.g., by the trial solves of Init_CylRankTuner())
+//-------------------------------------------------------------------------------------------------------
+void End_MemFree_CylPoisson()
+{
+
    // 1.0 free memory
+   CylPoisson_FreeSchedule();
    Aux_DeallocateArray2D(KernelFuncK);
+   delete [] KernelPairIdx;        KernelPairIdx     = NULL;
+   delete [] KernelHMat_Block;     KernelHMat_Block  = NULL;
+   delete [] KernelHMat_Rank;      KernelHMat_Rank   = NULL;
+   delete [] KernelHMat_Offset;    KernelHMat_Offset = NULL;
+   delete [] KernelHMat_Data;      KernelHMat_Data   = NULL;
+   KernelHMat_NBlock = 0;
    // 1.1
-   Aux_DeallocateArray2D(RhoK);
-   Aux_DeallocateArray2D(PhiK);
+   CylFFTW_DeallocateSlab(RhoK);
+   CylFFTW_DeallocateSlab(PhiK);
    // 1.2
-   delete [] SendBuf_Rho ; 
-   delete [] SendBuf_IDPlanXp ;
-   delete [] SendBuf_IDPlanYZ ;
-   delete [] RecvBuf_Rho ; 
-   delete [] RecvBuf_IDPlanXp ;
-   delete [] RecvBuf_IDPlanYZ ;
+   delete [] SendBuf_Rho ;         SendBuf_Rho      = NULL;
+   delete [] SendBuf_IDPlanXp ;    SendBuf_IDPlanXp = NULL;
+   delete [] SendBuf_IDPlanYZ ;    SendBuf_IDPlanYZ = NULL;
+   delete [] RecvBuf_Rho ;         RecvBuf_Rho      = NULL;
+   delete [] RecvBuf_IDPlanXp ;    RecvBuf_IDPlanXp = NULL;
+   delete [] RecvBuf_IDPlanYZ ;    RecvBuf_IDPlanYZ = NULL;
    // 1.3
-   delete [] PhiK_All_re ; 
-   delete [] PhiK_All_im ;
-   if (RANK_IP == 0) {
-      delete [] PhiK_local_re ;
-      delete [] PhiK_local_im ;
-   }
+   delete [] PhiK_All ;            PhiK_All         = NULL;
+   delete [] PhiK_Recv ;           PhiK_Recv        = NULL;
+   delete [] PhiK_OwnStart ;       PhiK_OwnStart    = NULL;
    // 1.4
-   if (RANK_IP == 0) {
-      delete [] SendBuf_Phi ; 
-      delete [] SendBuf_PID ;
-      delete [] SendBuf_I ;
-   }
-   delete [] RecvBuf_Phi ;
-   delete [] RecvBuf_PID ;
-   delete [] RecvBuf_I ;
+   delete [] SendBuf_Phi ;         SendBuf_Phi      = NULL;
+   delete [] SendBuf_PID ;         SendBuf_PID      = NULL;
+   delete [] SendBuf_I ;           SendBuf_I        = NULL;
+   delete [] RecvBuf_Phi ;         RecvBuf_Phi      = NULL;
+   delete [] RecvBuf_PID ;         RecvBuf_PID      = NULL;
+   delete [] RecvBuf_I ;           RecvBuf_I        = NULL;
    
    
    // 2.0 free new MPI_comm
-   MPI_Comm_free(&rank_i_comm );
-   MPI_Comm_free(&rank_ip_comm);
-   
-#  endif // COORDINATE 
+   if ( rank_i_comm  != MPI_COMM_NULL )   MPI_Comm_free(&rank_i_comm );
+   if ( rank_ip_comm != MPI_COMM_NULL )   MPI_Comm_free(&rank_ip_comm);
 
-} // FUNCTION : End_MemFree_PoissonGravity
+} // FUNCTION : End_MemFree_CylPoisson
+#endif // #if ( COORDINATE == CYLINDRICAL )
 
 #endif // #if ( !defined GPU  &&  defined GRAVITY )
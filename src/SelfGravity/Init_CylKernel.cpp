@@ -3,8 +3,6 @@
 #if (COORDINATE == CYLINDRICAL)
 #ifdef GRAVITY
 
-extern rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv;    
-
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_CylKernel
@@ -12,19 +10,21 @@ extern rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv;
 //-------------------------------------------------------------------------------------------------------
 void Init_CylKernel(){
    
-   const double *dh      = amr->dh[0]; 
-   const double dh_cube  = dh[0]*dh[1]*dh[2] ;
    const int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2]*2 }; // FFT_Size[0] is redundunt
 
-   double x, xp, y, z ; // (x, y, z) <-> (r, phi, z)
-   int ID_planX, ID_planYZ, kk, ii, iip ;
+   int ii, iip ;
       
 # ifdef SERIAL
    Aux_Message(stderr, "Cylindrical Self-Gravity is not yet ready for serial mode! \n");
    
 # else
-   //### NEED a scheme to determine RANK_I_TOT, RANK_IP_TOT for general case 
-      
+   // number of azimuthal modes m = 0 ... kernel_nm-1 retained in the kernel and the radial convolution
+   //   --> all modes (m <= NX0_TOT[1]/2) are retained if CYL_POISSON_MMAX < 0
+   kernel_nm = ( CYL_POISSON_MMAX < 0 ) ? NX0_TOT[1]/2 + 1 : MIN( CYL_POISSON_MMAX, NX0_TOT[1]/2 ) + 1;
+   
+   // determine RANK_I_TOT and RANK_IP_TOT automatically
+   if ( RANK_I_TOT <= 0 )  Init_CylRankTuner();
+
    // MPI_RANK = RANK_IP*(RANK_I_TOT) + RANK_I 
    RANK_IP         = int(MPI_Rank/RANK_I_TOT);          // const int RANK_IP = 0;
    RANK_I          = MPI_Rank % RANK_I_TOT ;            // const int RANK_I  = MPI_Rank;    
@@ -44,6 +44,12 @@ void Init_CylKernel(){
    const int  local_nz         = FFT_Size[2]; 
    const long slab_size        = local_ny * local_nz ;
    
+   // rows of PhiK owned by each rank in rank_i_comm (the rank of each process in rank_i_comm is RANK_IP)
+   // --> the radial integration of the owned rows is reduced to their owner, which then performs the inverse FFT
+   //     and sends the potential back to patches (see Pot_Isolated and Slab2Patch)
+   PhiK_OwnStart = new int [RANK_IP_TOT+1];
+   for (int q=0; q<=RANK_IP_TOT; q++)  PhiK_OwnStart[q] = (int)( (long)q*global_nx/RANK_IP_TOT );
+   
    // init memory for MPI
    Init_MemAllocate_CylPoisson(slab_size);
    
@@ -56,40 +62,186 @@ void Init_CylKernel(){
    if (rank_i_comm == MPI_COMM_NULL) Aux_Error(ERROR_INFO, "new MPI_Comm initiation failed... \n") ;
 
    
-   // 1.0 build up kernel for FFT
-   // 1.1 allocate Kernel K - 
-   //   a 1D array (a flattened 2D array), each component is a pointer to another 1D array (a flattened 2D array)
-   Aux_AllocateArray2D(KernelFuncK, global_nx*global_nxp, slab_size) ;
-   
-   // 1.2 build up Kernel in real space
-   for (int i=0;  i <global_nx;  i++)  { ii  = i+ global_nx_start;  x  = amr->BoxEdgeL[0] + (ii +0.5)*dh[0];
-   for (int ip=0; ip<global_nxp; ip++) { iip = ip+global_nxp_start; xp = amr->BoxEdgeL[0] + (iip+0.5)*dh[0];
-                                         ID_planX = i*global_nxp + ip;
-   for (int k=0;  k <local_nz;  k++)   { z = ( k <= NX0_TOT[2] ) ? k*dh[2] : (FFT_Size[2]-k)*dh[2] ;
-   for (int j=0;  j <local_ny;  j++)   { y = j*dh[1];
-      
-      ID_planYZ = k*local_ny + j;
-      real denominator = SQRT( SQR(x-xp) + (real)2.0*x*xp*((real)1.0 - COS(y)) + SQR(z) ) ;
-      
-      if (denominator != 0.0) 
-         KernelFuncK[ID_planX][ID_planYZ] = (real) -1.0*dh_cube / denominator; 
-      else  
-         KernelFuncK[ID_planX][ID_planYZ] = (real) 0.0 ;    // mesh does not see itself
-         
-   }}}}
-   
-   
-   // 2.0 FFT Kernel for each (i, ip)
-   for (int i=0;  i<global_nx;   i++){
-   for (int ip=0; ip<global_nxp; ip++){
-      
-      ID_planX = i*global_nxp + ip;
-      rfftwnd_one_real_to_complex( FFTW_Plan, KernelFuncK[ID_planX], NULL );      
+   // 1.0 number of unique real modes stored for each (i,ip) pair (see below)
+   //     --> only the azimuthal modes m < kernel_nm are stored
+   const int  kernel_nz      = NX0_TOT[2] + 1;
+   kernel_size = (long)kernel_nz * kernel_nm;
+
+   // hierarchical low-rank radial kernel (see Init_CylKernel_HMatrix)
+   if ( CYL_HMATRIX_TOL > 0.0 )
+   {
+      if (  !CYL_KERNEL_CACHE  ||  !CylKernel_LoadCache()  )
+      {
+         Init_CylKernel_HMatrix( global_nx_start, global_nxp_start );
+
+         if ( CYL_KERNEL_CACHE )    CylKernel_SaveCache();
+      }
+
+      return;
+   }
+
+   // 1.0 build up the symmetry-compressed kernel
+   //   --> the real-space kernel is even in both phi and z, so its transform is real and even in kz
+   //       --> only store the real parts of the modes with kz <= NX0_TOT[2] (kernel_size reals per (i,ip) pair)
+   //   --> the kernel is also symmetric in the global radial indices (ii,iip)
+   //       --> pairs whose transpose lies in the same rank block and has ii < iip share the same storage
+   // 1.1 map each (i,ip) pair to its storage slot
+   const int  global_nx_end  = global_nx_start  + global_nx;
+   const int  global_nxp_end = global_nxp_start + global_nxp;
+   KernelPairIdx = new int [ global_nx*global_nxp ];
+   kernel_npair  = 0;
+
+   int *PairII  = new int [ global_nx*global_nxp ];   // global radial indices of each unique pair
+   int *PairIIP = new int [ global_nx*global_nxp ];
+
+   for (int i=0;  i <global_nx;  i++)  { ii  = i +global_nx_start;
+   for (int ip=0; ip<global_nxp; ip++) { iip = ip+global_nxp_start;
+
+      const bool Transposed = ( ii > iip  &&  iip >= global_nx_start  &&  iip < global_nx_end  &&
+                                               ii  >= global_nxp_start &&  ii  < global_nxp_end );
+
+      if ( !Transposed ) {
+         PairII [kernel_npair] = ii;
+         PairIIP[kernel_npair] = iip;
+         KernelPairIdx[ i*global_nxp + ip ] = kernel_npair ++;
+      }
    }}
-      
+
+   for (int i=0;  i <global_nx;  i++)  { ii  = i +global_nx_start;
+   for (int ip=0; ip<global_nxp; ip++) { iip = ip+global_nxp_start;
+
+      const bool Transposed = ( ii > iip  &&  iip >= global_nx_start  &&  iip < global_nx_end  &&
+                                               ii  >= global_nxp_start &&  ii  < global_nxp_end );
+
+      if ( Transposed )
+         KernelPairIdx[ i*global_nxp + ip ] = KernelPairIdx[ (iip-global_nx_start)*global_nxp + (ii-global_nxp_start) ];
+   }}
+
+   // 1.2 load the kernel from the on-disk cache of the previous runs if possible
+   if ( CYL_KERNEL_CACHE  &&  CylKernel_LoadCache() )
+   {
+      delete [] PairII;
+      delete [] PairIIP;
+
+      return;
+   }
+
+   Aux_AllocateArray2D(KernelFuncK, kernel_npair, kernel_size) ;
+
+
+   // 1.3 build up each unique kernel slab in real space, FFT it, and keep the real part of the unique modes
+   //     --> OpenMP-parallelized over the unique pairs with one work slab per thread
+   real MaxRe = (real)0.0, MaxIm = (real)0.0;
+
+#  pragma omp parallel
+   {
+      real **KernelSlab = NULL;
+      real   MaxRe_Thread = (real)0.0, MaxIm_Thread = (real)0.0;
+
+      CylFFTW_AllocateSlab( KernelSlab, 1 );
+
+#     pragma omp for schedule( dynamic )
+      for (int t=0; t<kernel_npair; t++)
+         CylKernel_Pair( PairII[t], PairIIP[t], KernelSlab[0], KernelFuncK[t], MaxRe_Thread, MaxIm_Thread );
+
+#     pragma omp critical
+      {
+         MaxRe = FMAX( MaxRe, MaxRe_Thread );
+         MaxIm = FMAX( MaxIm, MaxIm_Thread );
+      }
+
+      CylFFTW_DeallocateSlab( KernelSlab );
+   } // OpenMP parallel region
+
+   delete [] PairII;
+   delete [] PairIIP;
+
+
+   // 1.4 the discarded imaginary parts should be round-off errors only
+   //     --> they are not if the azimuthal domain does not cover the full 2*pi
+   if ( MaxIm > (real)1.0e-4*MaxRe )
+      Aux_Error( ERROR_INFO, "kernel transform is not real (max |Im| = %13.7e, max |Re| = %13.7e) --> check BOX_EDGE_LEFT/RIGHT_Y !!\n",
+                 MaxIm, MaxRe );
+
+   if ( MPI_Rank == 0 )
+      Aux_Message( stdout, "   Cylindrical kernel storage per rank: %.3f MB (uncompressed: %.3f MB)\n",
+                   (double)kernel_npair*kernel_size*sizeof(real)/1048576.0,
+                   (double)global_nx*global_nxp*slab_size*sizeof(real)/1048576.0 );
+
+
+   // 1.5 save the kernel for the following runs
+   if ( CYL_KERNEL_CACHE )    CylKernel_SaveCache();
+
 } // Init_CylKernel
 
 
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylKernel_Pair
+// Description :  Build the kernel between the global radial indices ii and iip in real space, FFT it,
+//                and store the real parts of the unique modes (kz <= NX0_TOT[2]) in Kernel[]
+//
+// Note        :  1. KernelSlab[] is a work array with the size of a padded FFT slab
+//                2. Kernel[] has kernel_size elements stored as [kz][ky] with ky < kernel_nm
+//                3. MaxRe/MaxIm are updated with the maximum |Re|/|Im| of the stored modes so that
+//                   the caller can verify that the discarded imaginary parts are round-off errors only
+//                4. r and r' are the cell-centre radii of the mapped radial grid of OPT__CYL_RGRID
+//                   --> the kernel keeps the uniform volume factor dh^3 so that it remains symmetric in (ii,iip)
+//                   --> the source width dr'/dh is multiplied to the density by Patch2Slab() instead
+//
+// Parameter   :  ii, iip    : Global radial indices of r and r'
+//                KernelSlab : Work array
+//                Kernel     : Output array
+//                MaxRe      : Maximum |Re| of the stored modes
+//                MaxIm      : Maximum |Im| of the stored modes
+//-------------------------------------------------------------------------------------------------------
+void CylKernel_Pair( const int ii, const int iip, real *KernelSlab, real *Kernel, real &MaxRe, real &MaxIm )
+{
+
+   const double *dh        = amr->dh[0];
+   const double  dh_cube   = dh[0]*dh[1]*dh[2];
+   const int     local_ny  = 2*(NX0_TOT[1]/2+1);
+   const int     local_nz  = 2*NX0_TOT[2];
+   const int     kernel_nz = NX0_TOT[2] + 1;
+   const int     kernel_ny = local_ny / 2;
+   const double *rFace     = CylGeo[0].rFace + CylGeo[0].NGhost;
+   const double  x         = ( OPT__CYL_RGRID == CYL_RGRID_UNIFORM ) ? amr->BoxEdgeL[0] + (ii +0.5)*dh[0]
+                                                                     : 0.5*( rFace[ii ] + rFace[ii +1] );
+   const double  xp        = ( OPT__CYL_RGRID == CYL_RGRID_UNIFORM ) ? amr->BoxEdgeL[0] + (iip+0.5)*dh[0]
+                                                                     : 0.5*( rFace[iip] + rFace[iip+1] );
+
+   double y, z;   // (x, y, z) <-> (r, phi, z)
+
+   for (int k=0; k<local_nz; k++)   { z = ( k <= NX0_TOT[2] ) ? k*dh[2] : (local_nz-k)*dh[2] ;
+   for (int j=0; j<local_ny; j++)   { y = j*dh[1];
+
+      const long ID_planYZ   = (long)k*local_ny + j;
+      const real denominator = SQRT( SQR(x-xp) + (real)2.0*x*xp*((real)1.0 - COS(y)) + SQR(z) ) ;
+
+      if (denominator != 0.0)
+         KernelSlab[ID_planYZ] = (real) -1.0*dh_cube / denominator;
+      else
+         KernelSlab[ID_planYZ] = (real) 0.0 ;    // mesh does not see itself
+
+   }}
+
+   CylFFTW_Slab( KernelSlab );
+
+   const CylComplex_t *KernelSlab_cplx = (CylComplex_t *) KernelSlab;
+
+   for (int k=0; k<kernel_nz; k++)
+   for (int j=0; j<kernel_nm; j++) {
+      const CylComplex_t Mode = KernelSlab_cplx[ k*kernel_ny + j ];
+
+      Kernel[ k*kernel_nm + j ] = Mode.re;
+
+      MaxRe = FMAX( MaxRe, FABS(Mode.re) );
+      MaxIm = FMAX( MaxIm, FABS(Mode.im) );
+   }
+
+} // FUNCTION : CylKernel_Pair
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_MemAllocate_CylPoisson
 // Description :  allocate memory needed for CylPoisson (promary design for MPI task)
@@ -98,45 +250,45 @@ void Init_MemAllocate_CylPoisson(const long slab_size){
    
    if (MPI_Rank == 0) Aux_Message(stdout, "Init_MemAllocate_CylPoisson... ") ;
    
-   const int  NSlab            = amr->NPatchComma[0][1]*PS1;   // number of slabs in each node 
    const int  PSSize           = PS1 * PS1;
-   const long slab_size_hf     = slab_size / 2 ;
+   const int  NOwn             = PhiK_OwnStart[RANK_IP+1] - PhiK_OwnStart[RANK_IP];
    const long global_nxp_total = global_nxp * NX0_TOT[1] * NX0_TOT[2];
-   const long global_nx_total  = global_nx  * NX0_TOT[1] * NX0_TOT[2];
+   const long own_nx_total     = (long)NOwn * NX0_TOT[1] * NX0_TOT[2];
    const long global_nxp_slab  = global_nxp_total / PSSize;
-   const long global_nx_slab   = global_nx_total  / PSSize;
+   const long own_nx_slab      = own_nx_total     / PSSize;
    
    
    // 1.0 memory in CPU_CylPoissonSolver
-   Aux_AllocateArray2D(RhoK, global_nxp, slab_size) ;
-   Aux_AllocateArray2D(PhiK, global_nx , slab_size) ;    //### only RANK_I==0 needs this
+   CylFFTW_AllocateSlab(RhoK, global_nxp) ;
+   CylFFTW_AllocateSlab(PhiK, NOwn      ) ;    // owned rows only
    
    // 2.0 memory in Patch2Slab
-   SendBuf_Rho      = new real [ NSlab*PSSize ]; 
-   SendBuf_IDPlanXp = new int  [ NSlab  ];
-   SendBuf_IDPlanYZ = new long [ NSlab  ];
+   //     --> the send buffers depend on the number of local patches and are allocated by CylPoisson_BuildSchedule()
    RecvBuf_Rho      = new real [ global_nxp_total ]; 
    RecvBuf_IDPlanXp = new int  [ global_nxp_slab  ];
    RecvBuf_IDPlanYZ = new long [ global_nxp_slab  ];
    
    // 3.0 memory in Pot_Isolated
-   PhiK_All_re      = new real [ global_nx  * slab_size_hf ] ; 
-   PhiK_All_im      = new real [ global_nx  * slab_size_hf ] ;
-   if (RANK_IP == 0) {
-      PhiK_local_re = new real [ global_nx  * slab_size_hf ] ;
-      PhiK_local_im = new real [ global_nx  * slab_size_hf ] ;
-   }
+   //     --> interleaved complex stored as [i][kz][ky] with ky < kernel_nm
+   //         --> same layout as PhiK if all azimuthal modes are retained
+   //         --> otherwise the reduced owned rows are received by PhiK_Recv and then expanded to PhiK
+   const long phik_row_size = (long)2*( 2*NX0_TOT[2] )*kernel_nm;
+   
+   PhiK_All         = new real [ global_nx*phik_row_size ] ;
+   
+   if ( kernel_nm < NX0_TOT[1]/2 + 1 )
+   PhiK_Recv        = new real [ MAX( NOwn*phik_row_size, 1L ) ] ;
    
    // 4.0 in Slab2Patch   
-   if (RANK_IP == 0) {
-      SendBuf_Phi   = new real [ global_nx_total ]; 
-      SendBuf_PID   = new long [ global_nx_slab  ];
-      SendBuf_I     = new int  [ global_nx_slab  ];
-   }
-   // can reuse the one in step 2.0
-   RecvBuf_Phi      = new real [ NSlab*PSSize ] ;
-   RecvBuf_PID      = new long [ NSlab        ] ;
-   RecvBuf_I        = new int  [ NSlab        ] ;
+   SendBuf_Phi      = new real [ own_nx_total ]; 
+   SendBuf_PID      = new long [ own_nx_slab  ];
+   SendBuf_I        = new int  [ own_nx_slab  ];
+   //     --> the recv buffers depend on the number of local patches and are allocated by CylPoisson_BuildSchedule()
+   
+   // 5.0 batched FFTW3 plans on RhoK and PhiK
+#  ifdef SUPPORT_FFTW3
+   Init_CylFFTW_Batch( RhoK, global_nxp, PhiK, NOwn );
+#  endif
    
    //
    if (MPI_Rank == 0) Aux_Message(stdout, "done \n ") ;
@@ -0,0 +1,460 @@
+#include "GAMER.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if ( COORDINATE == CYLINDRICAL  &&  defined GRAVITY )
+
+
+// format version of the cache files --> increment it whenever the kernel or its storage layout changes
+#define CACHE_VERSION      2
+
+// maximum number of data sections and their alignment in the cache files (in bytes)
+#define CACHE_NSECTION_MAX 4
+#define CACHE_ALIGN        4096
+
+
+// header of the cache files
+// --> the key fields are placed before NSection and compared byte-by-byte
+//     --> the header is zero-initialized so that the structure padding is deterministic
+struct CylKernelCache_t
+{
+   char          Magic[8];
+   int           Version, SizeofReal, HMatrix, NMode;
+   int           NX0_Tot[3];
+   int           Rank_I_Tot, Rank_IP_Tot, Rank_I, Rank_IP;
+   double        BoxEdgeL[3], BoxEdgeR[3], dh[3], HMatrixTol;
+   unsigned long RFace;                      // checksum of the base-level face radii (see OPT__CYL_RGRID)
+
+   long          NSection;
+   long          NByte[CACHE_NSECTION_MAX];  // size of each data section in bytes (excluding the padding)
+   unsigned long Checksum;                   // checksum of all data sections
+};
+
+static void          CacheFileName( char *FileName );
+static void          CacheKey( CylKernelCache_t &Header );
+static int           CacheSection( const void *Ptr[], long NByte[] );
+static unsigned long CacheChecksum( unsigned long Sum, const char *Data, const long NByte );
+static bool          CacheRead( const char *Map, const long MapSize, const CylKernelCache_t &Key );
+static void          CacheFree();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylKernel_LoadCache
+// Description :  Load the cylindrical kernel of this rank from the cache file written by CylKernel_SaveCache()
+//
+// Note        :  1. Invoked by Init_CylKernel() when CYL_KERNEL_CACHE is on
+//                   --> kernel_size, kernel_npair, and KernelPairIdx must be set in advance for the dense kernel
+//                2. The cache is used only if
+//                   (a) the key of the file matches NX0_TOT, the box edges, dh, the radial face radii, the rank
+//                       decomposition, the floating-point precision, CYL_HMATRIX_TOL, and the number of azimuthal
+//                       modes of this run
+//                   (b) the section sizes are consistent with the current kernel
+//                   (c) the checksum matches
+//                3. The file is memory-mapped and copied to the regular kernel arrays so that they can be
+//                   freed by End_MemFree_CylPoisson() as usual
+//                4. All ranks must succeed since constructing the kernel may involve collective communication
+//                   (e.g., in Init_CylKernel_HMatrix())
+//                   --> if any rank fails, the data already loaded by the other ranks are discarded
+//
+// Return      :  true  --> kernel loaded on all ranks
+//                false --> kernel must be constructed
+//-------------------------------------------------------------------------------------------------------
+bool CylKernel_LoadCache()
+{
+
+   char FileName[MAX_STRING];
+   CylKernelCache_t Key;
+
+   CacheFileName( FileName );
+   CacheKey( Key );
+
+
+// 1. load the cache file of this rank
+   int Loaded = false;
+   const int FileID = open( FileName, O_RDONLY );
+
+   if ( FileID >= 0 )
+   {
+      struct stat FileStat;
+
+      if (  fstat( FileID, &FileStat ) == 0  &&  FileStat.st_size >= CACHE_ALIGN  )
+      {
+         void *Map = mmap( NULL, FileStat.st_size, PROT_READ, MAP_PRIVATE, FileID, 0 );
+
+         if ( Map != MAP_FAILED )
+         {
+            Loaded = CacheRead( (const char*)Map, FileStat.st_size, Key );
+            munmap( Map, FileStat.st_size );
+         }
+      }
+
+      close( FileID );
+   }
+
+
+// 2. all ranks must succeed
+   int Loaded_AllRank;
+
+   MPI_Allreduce( &Loaded, &Loaded_AllRank, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD );
+
+   if ( Loaded  &&  !Loaded_AllRank )  CacheFree();
+
+   if ( MPI_Rank == 0 )
+   {
+      if ( Loaded_AllRank )
+         Aux_Message( stdout, "   Cylindrical kernel loaded from the cache files \"%s\" ...\n", FileName );
+      else
+         Aux_Message( stdout, "   Cylindrical kernel cache files are missing or outdated --> construct the kernel\n" );
+   }
+
+   return Loaded_AllRank;
+
+} // FUNCTION : CylKernel_LoadCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylKernel_SaveCache
+// Description :  Save the cylindrical kernel of this rank to a cache file for the following runs
+//
+// Note        :  1. Invoked by Init_CylKernel() after constructing the kernel when CYL_KERNEL_CACHE is on
+//                2. File layout: header | data section 0 | data section 1 | ...
+//                   --> the header and each data section are padded to multiples of CACHE_ALIGN so that
+//                       all sections are page-aligned when the file is memory-mapped
+//                3. The file is first written to a temporary file and then renamed so that a run killed
+//                   during writing never leaves a truncated cache behind
+//                4. Failures only lead to a warning since the cache is optional
+//                   --> the cache is reported as saved only if all ranks succeed
+//-------------------------------------------------------------------------------------------------------
+void CylKernel_SaveCache()
+{
+
+   char FileName[MAX_STRING], TempName[2*MAX_STRING];
+   CylKernelCache_t Header;
+   const void *Ptr[CACHE_NSECTION_MAX];
+
+   CacheFileName( FileName );
+   sprintf( TempName, "%s.tmp", FileName );
+   CacheKey( Header );
+
+   Header.NSection = CacheSection( Ptr, Header.NByte );
+   Header.Checksum = 14695981039346656037UL;
+
+   for (int s=0; s<Header.NSection; s++)
+      Header.Checksum = CacheChecksum( Header.Checksum, (const char*)Ptr[s], Header.NByte[s] );
+
+
+// write the header and all data sections with padding
+   char *Zero    = (char*)calloc( CACHE_ALIGN, 1 );
+   FILE *File    = fopen( TempName, "wb" );
+   bool  Success = ( File != NULL );
+
+   if ( Success )
+   {
+      Success &= ( fwrite( &Header, sizeof(CylKernelCache_t), 1, File ) == 1 );
+      Success &= ( fwrite( Zero, 1, CACHE_ALIGN-sizeof(CylKernelCache_t), File ) == CACHE_ALIGN-sizeof(CylKernelCache_t) );
+
+      for (int s=0; s<Header.NSection; s++)
+      {
+         const size_t NPad = ( CACHE_ALIGN - Header.NByte[s]%CACHE_ALIGN ) % CACHE_ALIGN;
+
+         Success &= ( fwrite( Ptr[s], 1, Header.NByte[s], File ) == (size_t)Header.NByte[s] );
+         Success &= ( fwrite( Zero,   1, NPad,            File ) == NPad );
+      }
+
+      Success &= ( fclose( File ) == 0 );
+   }
+
+   free( Zero );
+
+   if ( Success )    Success = ( rename( TempName, FileName ) == 0 );
+
+   if ( !Success )
+   {
+      Aux_Message( stderr, "WARNING : failed to write the cylindrical kernel cache file \"%s\" (rank %d) !!\n",
+                   FileName, MPI_Rank );
+      remove( TempName );
+   }
+
+// all ranks must succeed for the cache to be usable by CylKernel_LoadCache()
+   int Saved = Success, Saved_AllRank;
+
+   MPI_Allreduce( &Saved, &Saved_AllRank, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      if ( Saved_AllRank )
+         Aux_Message( stdout, "   Cylindrical kernel saved to the cache files \"%s\" ...\n", FileName );
+      else
+         Aux_Message( stderr, "WARNING : cylindrical kernel cache files are NOT written on all ranks --> the kernel will be "
+                              "constructed again in the next run !!\n" );
+   }
+
+} // FUNCTION : CylKernel_SaveCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CacheFileName
+// Description :  Set the cache file name of this rank
+//
+// Note        :  1. The rank decomposition is included in the file name so that the caches of different
+//                   decompositions (e.g., those of the trial solves in Init_CylRankTuner()) coexist
+//-------------------------------------------------------------------------------------------------------
+void CacheFileName( char *FileName )
+{
+
+   sprintf( FileName, "CylKernelCache_I%d_IP%d_%06d", RANK_I_TOT, RANK_IP_TOT, MPI_Rank );
+
+} // FUNCTION : CacheFileName
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CacheKey
+// Description :  Fill the key fields of a cache header with the parameters of this run
+//                (all the other fields are set to zero)
+//-------------------------------------------------------------------------------------------------------
+void CacheKey( CylKernelCache_t &Header )
+{
+
+   memset( &Header, 0, sizeof(CylKernelCache_t) );
+
+   memcpy( Header.Magic, "GAMERCYK", 8 );
+
+   Header.Version     = CACHE_VERSION;
+   Header.SizeofReal  = sizeof(real);
+   Header.HMatrix     = ( CYL_HMATRIX_TOL > 0.0 );
+   Header.NMode       = kernel_nm;
+   Header.Rank_I_Tot  = RANK_I_TOT;
+   Header.Rank_IP_Tot = RANK_IP_TOT;
+   Header.Rank_I      = RANK_I;
+   Header.Rank_IP     = RANK_IP;
+   Header.HMatrixTol  = CYL_HMATRIX_TOL;
+
+   for (int d=0; d<3; d++)
+   {
+      Header.NX0_Tot [d] = NX0_TOT[d];
+      Header.BoxEdgeL[d] = amr->BoxEdgeL[d];
+      Header.BoxEdgeR[d] = amr->BoxEdgeR[d];
+      Header.dh      [d] = amr->dh[0][d];
+   }
+
+   Header.RFace = CacheChecksum( 14695981039346656037UL, (const char*)( CylGeo[0].rFace + CylGeo[0].NGhost ),
+                                 (NX0_TOT[0]+1)*sizeof(double) );
+
+} // FUNCTION : CacheKey
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CacheSection
+// Description :  Set the pointers and sizes of the kernel data sections of this rank
+//
+// Note        :  1. Dense kernel : KernelFuncK
+//                   H-matrix     : KernelHMat_Block, KernelHMat_Rank, KernelHMat_Offset, KernelHMat_Data
+//                2. The size of KernelHMat_Data is not stored globally
+//                   --> it is given by the offset and size of the last data block
+//
+// Parameter   :  Ptr   : Pointers of the data sections
+//                NByte : Sizes of the data sections in bytes
+//
+// Return      :  Number of data sections
+//-------------------------------------------------------------------------------------------------------
+int CacheSection( const void *Ptr[], long NByte[] )
+{
+
+   if ( CYL_HMATRIX_TOL > 0.0 )
+   {
+      const long NID   = kernel_size*KernelHMat_NBlock;
+      long       NData = 0;
+
+      for (long ID=0; ID<NID; ID++)
+      {
+         const int  b    = ID % KernelHMat_NBlock;
+         const int  Rank = KernelHMat_Rank[ID];
+         const long Size = ( Rank < 0 ) ? (long)KernelHMat_Block[b][1]*KernelHMat_Block[b][3]
+                                        : (long)Rank*( KernelHMat_Block[b][1] + KernelHMat_Block[b][3] );
+
+         NData = MAX( NData, KernelHMat_Offset[ID] + Size );
+      }
+
+      Ptr[0] = KernelHMat_Block;    NByte[0] = (long)KernelHMat_NBlock*4*sizeof(int);
+      Ptr[1] = KernelHMat_Rank;     NByte[1] = NID*sizeof(int);
+      Ptr[2] = KernelHMat_Offset;   NByte[2] = NID*sizeof(long);
+      Ptr[3] = KernelHMat_Data;     NByte[3] = NData*sizeof(real);
+
+      return 4;
+   }
+
+   else
+   {
+      Ptr[0] = KernelFuncK[0];      NByte[0] = (long)kernel_npair*kernel_size*sizeof(real);
+
+      return 1;
+   }
+
+} // FUNCTION : CacheSection
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CacheChecksum
+// Description :  Update the 64-bit FNV-1a checksum with a data section
+//
+// Note        :  1. Data are processed in 8-byte words for performance, with the remaining bytes processed
+//                   one by one
+//
+// Parameter   :  Sum   : Input checksum
+//                Data  : Data section
+//                NByte : Size of the data section in bytes
+//
+// Return      :  Updated checksum
+//-------------------------------------------------------------------------------------------------------
+unsigned long CacheChecksum( unsigned long Sum, const char *Data, const long NByte )
+{
+
+   const unsigned long Prime = 1099511628211UL;
+   const long          NWord = NByte / sizeof(unsigned long);
+   unsigned long       Word;
+
+   for (long t=0; t<NWord; t++)
+   {
+      memcpy( &Word, Data + t*sizeof(unsigned long), sizeof(unsigned long) );
+      Sum ^= Word;
+      Sum *= Prime;
+   }
+
+   for (long t=NWord*sizeof(unsigned long); t<NByte; t++)
+   {
+      Sum ^= (unsigned char)Data[t];
+      Sum *= Prime;
+   }
+
+   return Sum;
+
+} // FUNCTION : CacheChecksum
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CacheRead
+// Description :  Validate a memory-mapped cache file and copy its data to the kernel arrays
+//
+// Parameter   :  Map     : Memory-mapped cache file
+//                MapSize : Size of the cache file in bytes
+//                Key     : Header filled by CacheKey()
+//
+// Return      :  true  --> kernel arrays allocated and loaded
+//                false --> invalid cache file (nothing is allocated)
+//-------------------------------------------------------------------------------------------------------
+bool CacheRead( const char *Map, const long MapSize, const CylKernelCache_t &Key )
+{
+
+   const CylKernelCache_t *Header = (const CylKernelCache_t*)Map;
+
+
+// 1. check the key
+   if (  memcmp( Header, &Key, offsetof(CylKernelCache_t, NSection) ) != 0  )   return false;
+
+
+// 2. check the section sizes
+   const int NSection = ( Key.HMatrix ) ? 4 : 1;
+
+   if ( Header->NSection != NSection )    return false;
+
+   const char *Ptr[CACHE_NSECTION_MAX];
+   long        Offset = CACHE_ALIGN;
+
+   for (int s=0; s<NSection; s++)
+   {
+      if ( Header->NByte[s] < 0 )   return false;
+
+      Ptr[s]  = Map + Offset;
+      Offset += ( Header->NByte[s] + CACHE_ALIGN - 1 ) / CACHE_ALIGN * CACHE_ALIGN;
+   }
+
+   if ( Offset > MapSize )    return false;
+
+   long NBlock = 0;
+
+   if ( Key.HMatrix )
+   {
+      NBlock = Header->NByte[0] / ( 4*sizeof(int) );
+
+      if (  Header->NByte[0] != NBlock*4*(long)sizeof(int)               ||
+            Header->NByte[1] != kernel_size*NBlock*(long)sizeof(int)   ||
+            Header->NByte[2] != kernel_size*NBlock*(long)sizeof(long)  ||
+            Header->NByte[3] %  (long)sizeof(real) != 0  )
+         return false;
+   }
+
+   else
+   {
+      if ( Header->NByte[0] != kernel_npair*kernel_size*(long)sizeof(real) )   return false;
+   }
+
+
+// 3. check the checksum
+   unsigned long Checksum = 14695981039346656037UL;
+
+   for (int s=0; s<NSection; s++)   Checksum = CacheChecksum( Checksum, Ptr[s], Header->NByte[s] );
+
+   if ( Checksum != Header->Checksum )    return false;
+
+
+// 4. copy data
+   if ( Key.HMatrix )
+   {
+      KernelHMat_NBlock = NBlock;
+      KernelHMat_Block  = new int  [KernelHMat_NBlock][4];
+      KernelHMat_Rank   = new int  [ kernel_size*KernelHMat_NBlock ];
+      KernelHMat_Offset = new long [ kernel_size*KernelHMat_NBlock ];
+      KernelHMat_Data   = new real [ MAX( Header->NByte[3]/(long)sizeof(real), 1L ) ];
+
+      memcpy( KernelHMat_Block,  Ptr[0], Header->NByte[0] );
+      memcpy( KernelHMat_Rank,   Ptr[1], Header->NByte[1] );
+      memcpy( KernelHMat_Offset, Ptr[2], Header->NByte[2] );
+      memcpy( KernelHMat_Data,   Ptr[3], Header->NByte[3] );
+   }
+
+   else
+   {
+      Aux_AllocateArray2D( KernelFuncK, kernel_npair, kernel_size );
+
+      memcpy( KernelFuncK[0], Ptr[0], Header->NByte[0] );
+   }
+
+   return true;
+
+} // FUNCTION : CacheRead
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CacheFree
+// Description :  Free the kernel arrays allocated by CacheRead()
+//-------------------------------------------------------------------------------------------------------
+void CacheFree()
+{
+
+   if ( CYL_HMATRIX_TOL > 0.0 )
+   {
+      delete [] KernelHMat_Block;     KernelHMat_Block  = NULL;
+      delete [] KernelHMat_Rank;      KernelHMat_Rank   = NULL;
+      delete [] KernelHMat_Offset;    KernelHMat_Offset = NULL;
+      delete [] KernelHMat_Data;      KernelHMat_Data   = NULL;
+      KernelHMat_NBlock = 0;
+   }
+
+   else
+      Aux_DeallocateArray2D( KernelFuncK );
+
+} // FUNCTION : CacheFree
+
+
+
+#endif // #if ( COORDINATE == CYLINDRICAL  &&  defined GRAVITY )
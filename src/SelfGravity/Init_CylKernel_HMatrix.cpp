@@ -0,0 +1,366 @@
+#include "GAMER.h"
+
+#include <vector>
+
+using std::vector;
+
+#if (COORDINATE == CYLINDRICAL)
+#ifdef GRAVITY
+
+
+// minimum block size along each direction below which the blocks are stored as dense matrices
+#define HMAT_LEAF    16
+
+// admissibility parameter: a block is compressed if max(ni,nip) <= HMAT_ETA*(distance between the two radial clusters)
+#define HMAT_ETA     1.0
+
+// maximum memory (in MB) of the temporary kernel of a single block during the construction
+#define HMAT_MAX_MB  256.0
+
+static void BuildBlockTree( vector<int> &Block, const int i0, const int ni, const int ip0, const int nip,
+                            const int global_nx_start, const int global_nxp_start, const long MaxElem );
+static int  LowRank_ACA( real *R, const int ni, const int nip, const double Tol, const int MaxRank,
+                         real *U, real *V, double &NormA2, double &NormR2 );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_CylKernel_HMatrix
+// Description :  Construct the hierarchical low-rank (H-matrix) representation of the radial kernel
+//
+// Note        :  1. Invoked by Init_CylKernel() when CYL_HMATRIX_TOL > 0
+//                2. For each unique (kz,ky) mode, the kernel restricted to this rank is a
+//                   global_nx x global_nxp matrix K(i,ip)
+//                   --> The block cluster tree (shared by all modes) recursively bisects the radial ranges
+//                   --> Admissible blocks (well-separated radii) are smooth and compressed as sum_k u_k v_k^T
+//                       with the adaptive cross approximation (full pivoting) until the Frobenius norm
+//                       of the residual drops below CYL_HMATRIX_TOL times the norm of the block
+//                   --> The remaining near-diagonal blocks (and the admissible blocks which turn out not
+//                       to be compressible) are stored as dense matrices
+//                3. The kernel of each block is evaluated by CylKernel_Pair() for all modes at once
+//                   (OpenMP-parallelized over the pairs) and released right after the block is compressed
+//                   --> the dense kernel is never stored
+//                4. Report the achieved relative error against the dense kernel (measured in the
+//                   Frobenius norm over all blocks and modes) and the compressed storage
+//                5. Data layout (see Pot_Isolated):
+//                   KernelHMat_Block [b][4]      : local (i0, ni, ip0, nip) of block b
+//                   KernelHMat_Rank  [u][b]      : rank of block b for mode u (-1 for dense blocks)
+//                   KernelHMat_Offset[u][b]      : offset of the block data in KernelHMat_Data[]
+//                   KernelHMat_Data              : dense blocks --> [ni][nip]
+//                                                  low-rank     --> U[rank][ni] followed by V[rank][nip]
+//                   with u = kz*(NX0_TOT[1]/2+1) + ky the index of the unique real mode
+//
+// Parameter   :  global_nx_start  : Global index of the first r  of this rank
+//                global_nxp_start : Global index of the first r' of this rank
+//-------------------------------------------------------------------------------------------------------
+void Init_CylKernel_HMatrix( const int global_nx_start, const int global_nxp_start )
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Constructing the H-matrix kernel (tolerance = %13.7e) ...\n",
+                                        CYL_HMATRIX_TOL );
+
+   const long MaxElem = MAX( (long)HMAT_LEAF*HMAT_LEAF,
+                             (long)( HMAT_MAX_MB*1048576.0/(kernel_size*sizeof(real)) ) );
+
+
+// 1. construct the block cluster tree
+   vector<int> Block;
+
+   BuildBlockTree( Block, 0, global_nx, 0, global_nxp, global_nx_start, global_nxp_start, MaxElem );
+
+   KernelHMat_NBlock = Block.size() / 4;
+   KernelHMat_Block  = new int  [KernelHMat_NBlock][4];
+   KernelHMat_Rank   = new int  [ kernel_size*KernelHMat_NBlock ];
+   KernelHMat_Offset = new long [ kernel_size*KernelHMat_NBlock ];
+
+   for (int b=0; b<KernelHMat_NBlock; b++)
+   {
+      KernelHMat_Block[b][0] = ( Block[4*b] >= 0 ) ? Block[4*b] : -1-Block[4*b];
+      for (int t=1; t<4; t++)    KernelHMat_Block[b][t] = Block[ 4*b + t ];
+   }
+
+
+// 2. compress each block for all modes
+   vector<real> *BlockData = new vector<real> [KernelHMat_NBlock];   // block-major during the construction
+
+   long   *BlockOffset = new long [ kernel_size*KernelHMat_NBlock ];
+   real    MaxRe = (real)0.0, MaxIm = (real)0.0;
+   double  NormA2_Sum = 0.0, NormR2_Sum = 0.0;
+   long    NStore = 0;
+
+   for (int b=0; b<KernelHMat_NBlock; b++)
+   {
+      const int  i0         = KernelHMat_Block[b][0];
+      const int  ni         = KernelHMat_Block[b][1];
+      const int  ip0        = KernelHMat_Block[b][2];
+      const int  nip        = KernelHMat_Block[b][3];
+      const bool Admissible = ( Block[4*b] >= 0 );
+
+//    2.1 kernel of all (i,ip) pairs in this block
+      real *BlockKernel = new real [ (long)ni*nip*kernel_size ];
+
+#     pragma omp parallel
+      {
+         real **KernelSlab = NULL;
+         real   MaxRe_Thread = (real)0.0, MaxIm_Thread = (real)0.0;
+
+         CylFFTW_AllocateSlab( KernelSlab, 1 );
+
+#        pragma omp for schedule( dynamic )
+         for (int t=0; t<ni*nip; t++)
+            CylKernel_Pair( i0+t/nip+global_nx_start, ip0+t%nip+global_nxp_start, KernelSlab[0],
+                            BlockKernel + (long)t*kernel_size, MaxRe_Thread, MaxIm_Thread );
+
+#        pragma omp critical
+         {
+            MaxRe = FMAX( MaxRe, MaxRe_Thread );
+            MaxIm = FMAX( MaxIm, MaxIm_Thread );
+         }
+
+         CylFFTW_DeallocateSlab( KernelSlab );
+      } // OpenMP parallel region
+
+//    2.2 compress each mode
+      const int MaxRank = ( Admissible ) ? ni*nip/(ni+nip) : 0;
+
+      real *R = new real [ ni*nip ];
+      real *U = new real [ MAX(MaxRank,1)*ni  ];
+      real *V = new real [ MAX(MaxRank,1)*nip ];
+
+      for (long u=0; u<kernel_size; u++)
+      {
+         const long ID = u*KernelHMat_NBlock + b;
+
+         for (int t=0; t<ni*nip; t++)  R[t] = BlockKernel[ t*kernel_size + u ];
+
+         double NormA2 = 0.0, NormR2 = 0.0;
+         int    Rank   = -1;
+
+         if ( Admissible )    Rank = LowRank_ACA( R, ni, nip, CYL_HMATRIX_TOL, MaxRank, U, V, NormA2, NormR2 );
+
+         BlockOffset[ID] = BlockData[b].size();
+
+//       dense block (use the original kernel since R[] may have been overwritten by LowRank_ACA())
+         if ( Rank < 0 )
+         {
+            NormA2 = 0.0;
+
+            for (int t=0; t<ni*nip; t++)
+            {
+               BlockData[b].push_back( BlockKernel[ t*kernel_size + u ] );
+               NormA2 += SQR( (double)BlockKernel[ t*kernel_size + u ] );
+            }
+            NormR2 = 0.0;
+         }
+
+//       low-rank block
+         else
+         {
+            for (int t=0; t<Rank*ni;  t++)   BlockData[b].push_back( U[t] );
+            for (int t=0; t<Rank*nip; t++)   BlockData[b].push_back( V[t] );
+         }
+
+         KernelHMat_Rank[ID] = Rank;
+         NormA2_Sum         += NormA2;
+         NormR2_Sum         += NormR2;
+      } // for (long u=0; u<kernel_size; u++)
+
+      NStore += BlockData[b].size();
+
+      delete [] BlockKernel;
+      delete [] R;
+      delete [] U;
+      delete [] V;
+   } // for (int b=0; b<KernelHMat_NBlock; b++)
+
+
+
+// 3. store the blocks of each mode contiguously for the mode-by-mode matrix-vector products in Pot_Isolated()
+   KernelHMat_Data = new real [ MAX(NStore,1L) ];
+
+   long Offset = 0;
+
+   for (long u=0; u<kernel_size; u++)
+   for (int b=0; b<KernelHMat_NBlock; b++)
+   {
+      const long ID    = u*KernelHMat_NBlock + b;
+      const int  Rank  = KernelHMat_Rank[ID];
+      const long NData = ( Rank < 0 ) ? (long)KernelHMat_Block[b][1]*KernelHMat_Block[b][3]
+                                      : (long)Rank*( KernelHMat_Block[b][1] + KernelHMat_Block[b][3] );
+
+      KernelHMat_Offset[ID] = Offset;
+
+      for (long t=0; t<NData; t++)  KernelHMat_Data[ Offset + t ] = BlockData[b][ BlockOffset[ID] + t ];
+
+      Offset += NData;
+   }
+
+   delete [] BlockData;
+   delete [] BlockOffset;
+
+
+// 4. check the kernel and report the accuracy and storage of the compressed kernel
+   if ( MaxIm > (real)1.0e-4*MaxRe )
+      Aux_Error( ERROR_INFO, "kernel transform is not real (max |Im| = %13.7e, max |Re| = %13.7e) --> check BOX_EDGE_LEFT/RIGHT_Y !!\n",
+                 MaxIm, MaxRe );
+
+   double Norm2_Local[2] = { NormA2_Sum, NormR2_Sum }, Norm2_AllRank[2];
+   double MB_Local[2]    = { (double)NStore*sizeof(real)/1048576.0,
+                             (double)global_nx*global_nxp*kernel_size*sizeof(real)/1048576.0 }, MB_AllRank[2];
+
+   MPI_Allreduce( Norm2_Local, Norm2_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+   MPI_Allreduce( MB_Local,    MB_AllRank,    2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "   H-matrix kernel: %d blocks per rank, relative error (Frobenius) = %13.7e\n",
+                   KernelHMat_NBlock, ( Norm2_AllRank[0] > 0.0 ) ? sqrt( Norm2_AllRank[1]/Norm2_AllRank[0] ) : 0.0 );
+      Aux_Message( stdout, "   H-matrix kernel storage per rank: %.3f MB (dense: %.3f MB)\n",
+                   MB_AllRank[0], MB_AllRank[1] );
+   }
+
+} // FUNCTION : Init_CylKernel_HMatrix
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BuildBlockTree
+// Description :  Recursively bisect the block [i0,i0+ni) x [ip0,ip0+nip) until it is either admissible
+//                or small enough to be stored as a dense matrix
+//
+// Note        :  1. Leaf blocks are appended to Block[] as (i0, ni, ip0, nip)
+//                   --> i0 is stored as -1-i0 for the non-admissible blocks and is restored by the caller
+//                2. Admissible blocks larger than MaxElem are further bisected to bound the temporary
+//                   memory during the construction
+//
+// Parameter   :  Block            : Output list of the leaf blocks
+//                i0, ni           : Local start index and size of the radial cluster of r
+//                ip0, nip         : Local start index and size of the radial cluster of r'
+//                global_nx_start  : Global index of the first r  of this rank
+//                global_nxp_start : Global index of the first r' of this rank
+//                MaxElem          : Maximum number of elements in an admissible block
+//-------------------------------------------------------------------------------------------------------
+void BuildBlockTree( vector<int> &Block, const int i0, const int ni, const int ip0, const int nip,
+                     const int global_nx_start, const int global_nxp_start, const long MaxElem )
+{
+
+   const int gi0  = i0  + global_nx_start;
+   const int gip0 = ip0 + global_nxp_start;
+
+// distance (in cells) between the two radial clusters
+   int Dist;
+   if      ( gi0 +ni  <= gip0 )  Dist = gip0 - ( gi0 +ni  ) + 1;
+   else if ( gip0+nip <= gi0  )  Dist = gi0  - ( gip0+nip ) + 1;
+   else                          Dist = 0;
+
+   const bool Admissible = ( Dist > 0  &&  MAX(ni,nip) <= HMAT_ETA*Dist );
+   const bool Leaf       = ( ni <= HMAT_LEAF  &&  nip <= HMAT_LEAF );
+
+   if (  ( Admissible && (long)ni*nip <= MaxElem )  ||  Leaf  )
+   {
+      Block.push_back( (Admissible && !Leaf) ? i0 : -1-i0 );
+      Block.push_back( ni  );
+      Block.push_back( ip0 );
+      Block.push_back( nip );
+      return;
+   }
+
+   const int ni_L  = ( ni  > HMAT_LEAF ) ? ni /2 : ni;
+   const int nip_L = ( nip > HMAT_LEAF ) ? nip/2 : nip;
+
+   for (int a=0; a<2; a++)
+   {
+      const int i0_sub = ( a == 0 ) ? i0   : i0 + ni_L;
+      const int ni_sub = ( a == 0 ) ? ni_L : ni - ni_L;
+
+      if ( ni_sub == 0 )   continue;
+
+      for (int c=0; c<2; c++)
+      {
+         const int ip0_sub = ( c == 0 ) ? ip0   : ip0 + nip_L;
+         const int nip_sub = ( c == 0 ) ? nip_L : nip - nip_L;
+
+         if ( nip_sub == 0 )  continue;
+
+         BuildBlockTree( Block, i0_sub, ni_sub, ip0_sub, nip_sub, global_nx_start, global_nxp_start, MaxElem );
+      }
+   }
+
+} // FUNCTION : BuildBlockTree
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LowRank_ACA
+// Description :  Low-rank approximation R ~ sum_k u_k v_k^T of a dense ni x nip block with the adaptive cross
+//                approximation (full pivoting)
+//
+// Note        :  1. R[] is overwritten by the residual
+//                2. Stop when |residual|_F <= Tol*|R|_F
+//                3. Return -1 if the required rank exceeds MaxRank, in which case the caller should store
+//                   the block as a dense matrix
+//
+// Parameter   :  R       : Block to be compressed [ni][nip]
+//                ni, nip : Block size
+//                Tol     : Relative tolerance
+//                MaxRank : Maximum rank
+//                U, V    : Output factors [rank][ni] and [rank][nip]
+//                NormA2  : Squared Frobenius norm of the input block
+//                NormR2  : Squared Frobenius norm of the residual
+//
+// Return      :  Rank of the approximation or -1
+//-------------------------------------------------------------------------------------------------------
+int LowRank_ACA( real *R, const int ni, const int nip, const double Tol, const int MaxRank,
+                 real *U, real *V, double &NormA2, double &NormR2 )
+{
+
+   NormA2 = 0.0;
+   for (int t=0; t<ni*nip; t++)  NormA2 += SQR( (double)R[t] );
+
+   NormR2 = NormA2;
+
+   int Rank = 0;
+
+   while ( NormR2 > SQR(Tol)*NormA2 )
+   {
+      if ( Rank >= MaxRank )  return -1;
+
+//    pivot
+      int  Piv   = 0;
+      real MaxR  = (real)0.0;
+      for (int t=0; t<ni*nip; t++)
+         if ( FABS(R[t]) > MaxR )   {  MaxR = FABS(R[t]);  Piv = t;  }
+
+      if ( MaxR == (real)0.0 )   break;
+
+      const int  a_piv   = Piv / nip;
+      const int  c_piv   = Piv % nip;
+      const real _PivVal = (real)1.0 / R[Piv];
+
+      real *u = U + Rank*ni;
+      real *v = V + Rank*nip;
+
+      for (int a=0; a<ni;  a++)  u[a] = R[ a*nip + c_piv ];
+      for (int c=0; c<nip; c++)  v[c] = R[ a_piv*nip + c ]*_PivVal;
+
+//    update the residual
+      NormR2 = 0.0;
+      for (int a=0; a<ni;  a++)
+      for (int c=0; c<nip; c++)
+      {
+         R[ a*nip + c ] -= u[a]*v[c];
+         NormR2         += SQR( (double)R[ a*nip + c ] );
+      }
+
+      Rank ++;
+   }
+
+   return Rank;
+
+} // FUNCTION : LowRank_ACA
+
+
+
+#endif // GRAVITY
+#endif // COORDINATE == CYLINDRICAL
@@ -0,0 +1,222 @@
+#include "GAMER.h"
+
+#if ( COORDINATE == CYLINDRICAL  &&  defined GRAVITY )
+
+
+// nominal per-thread floating-point rate (flop/s) and per-rank network bandwidth (byte/s) of the cost model
+// --> only the relative costs of different decompositions matter
+#define TUNE_FLOP_RATE     1.0e9
+#define TUNE_BANDWIDTH     1.0e9
+
+// number of best predicted decompositions timed by trial solves when CYL_RANK_TUNE_NTRIAL > 0
+#define TUNE_NCAND_TRIAL   3
+
+
+// cost model of a single decomposition
+struct CylRankCost_t
+{
+   int    NRank_I, NRank_IP;  // RANK_I_TOT, RANK_IP_TOT
+   double Mem;                // memory per rank (MB)
+   double Comm;               // communication volume per rank per solve (MB)
+   int    NFFT;               // number of slab FFTs per rank per solve
+   double Time;               // predicted time per solve (s)
+   double Trial;              // measured time per solve (s; <0 = not measured)
+};
+
+static void CylRankCost( CylRankCost_t &Cost );
+static int  CompareTime( const void *a, const void *b );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_CylRankTuner
+// Description :  Determine RANK_I_TOT and RANK_IP_TOT of the cylindrical Poisson solver automatically
+//
+// Note        :  1. Invoked by Init_CylKernel() when RANK_I_TOT <= 0
+//                2. Candidates are all factorizations RANK_I_TOT*RANK_IP_TOT == MPI_NRank with
+//                   RANK_I_TOT <= NX0_TOT[0] and NX0_TOT[0] % RANK_IP_TOT == 0
+//                3. Each candidate is ranked by a cost model of the kernel memory, the communication volume,
+//                   and the number of FFTs and kernel multiplications per rank (see CylRankCost())
+//                4. If CYL_RANK_TUNE_NTRIAL > 0, the TUNE_NCAND_TRIAL best predicted candidates are
+//                   constructed and timed by CYL_RANK_TUNE_NTRIAL solves each, and the fastest one is adopted
+//                   --> the trial solves store the potential in amr->PotSg[0], which will be overwritten
+//                       by the first regular Poisson solve
+//                   --> the kernel is constructed once for each trial candidate
+//                5. The decision is logged to stdout by MPI_Rank 0
+//-------------------------------------------------------------------------------------------------------
+void Init_CylRankTuner()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   %s ...\n", __FUNCTION__ );
+
+
+// 1. enumerate and model all candidates
+   CylRankCost_t *Cand  = new CylRankCost_t [MPI_NRank];
+   int            NCand = 0;
+
+   for (int NRank_IP=1; NRank_IP<=MPI_NRank; NRank_IP++)
+   {
+      if ( MPI_NRank % NRank_IP != 0  ||  NX0_TOT[0] % NRank_IP != 0 )  continue;
+
+      const int NRank_I = MPI_NRank / NRank_IP;
+
+      if ( NRank_I > NX0_TOT[0] )   continue;
+
+      Cand[NCand].NRank_I  = NRank_I;
+      Cand[NCand].NRank_IP = NRank_IP;
+      Cand[NCand].Trial    = -1.0;
+
+      CylRankCost( Cand[NCand] );
+
+      NCand ++;
+   }
+
+   if ( NCand == 0 )
+      Aux_Error( ERROR_INFO, "no valid decomposition for MPI_NRank = %d and NX0_TOT[0] = %d !!\n", MPI_NRank, NX0_TOT[0] );
+
+   qsort( Cand, NCand, sizeof(CylRankCost_t), CompareTime );
+
+
+// 2. time the best predicted candidates
+   int Best = 0;
+
+   if ( CYL_RANK_TUNE_NTRIAL > 0  &&  NCand > 1 )
+   {
+      const int  NTrialCand = MIN( NCand, TUNE_NCAND_TRIAL );
+#     ifdef COMOVING
+      const real Poi_Coeff  = 4.0*M_PI*NEWTON_G*Time[0];
+#     else
+      const real Poi_Coeff  = 4.0*M_PI*NEWTON_G;
+#     endif
+
+      for (int c=0; c<NTrialCand; c++)
+      {
+         RANK_I_TOT  = Cand[c].NRank_I;
+         RANK_IP_TOT = Cand[c].NRank_IP;
+
+         Init_CylKernel();
+
+//       warm up once so that the first-touch and MPI setup costs are excluded
+         CPU_CylPoissonSolver( Poi_Coeff, amr->PotSg[0], Time[0] );
+
+         MPI_Barrier( MPI_COMM_WORLD );
+         const double Start = MPI_Wtime();
+
+         for (int t=0; t<CYL_RANK_TUNE_NTRIAL; t++)
+            CPU_CylPoissonSolver( Poi_Coeff, amr->PotSg[0], Time[0] );
+
+         double Elapsed = ( MPI_Wtime() - Start )/CYL_RANK_TUNE_NTRIAL;
+
+         MPI_Allreduce( MPI_IN_PLACE, &Elapsed, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+
+         Cand[c].Trial = Elapsed;
+
+         if ( Cand[c].Trial < Cand[Best].Trial )   Best = c;
+
+         End_MemFree_CylPoisson();
+      } // for (int c=0; c<NTrialCand; c++)
+   } // if ( CYL_RANK_TUNE_NTRIAL > 0  &&  NCand > 1 )
+
+   RANK_I_TOT  = Cand[Best].NRank_I;
+   RANK_IP_TOT = Cand[Best].NRank_IP;
+
+
+// 3. log the decision
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "      %10s  %11s  %12s  %12s  %8s  %14s  %14s\n",
+                   "RANK_I_TOT", "RANK_IP_TOT", "Mem/rank(MB)", "Comm/rank(MB)", "NFFT", "Model time(s)", "Trial time(s)" );
+
+      for (int c=0; c<NCand; c++)
+      {
+         Aux_Message( stdout, "      %10d  %11d  %12.3f  %12.3f  %8d  %14.6e  ",
+                      Cand[c].NRank_I, Cand[c].NRank_IP, Cand[c].Mem, Cand[c].Comm, Cand[c].NFFT, Cand[c].Time );
+
+         if ( Cand[c].Trial >= 0.0 )   Aux_Message( stdout, "%14.6e", Cand[c].Trial );
+         else                          Aux_Message( stdout, "%14s",    "--" );
+
+         Aux_Message( stdout, "%s\n", ( c == Best ) ? "  <--" : "" );
+      }
+
+      Aux_Message( stdout, "      --> adopt RANK_I_TOT = %d, RANK_IP_TOT = %d (%s)\n", RANK_I_TOT, RANK_IP_TOT,
+                   ( Cand[Best].Trial >= 0.0 ) ? "fastest trial" : "best model" );
+      Aux_Message( stdout, "   %s ... done\n", __FUNCTION__ );
+   }
+
+   delete [] Cand;
+
+} // FUNCTION : Init_CylRankTuner
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylRankCost
+// Description :  Cost model of a single decomposition
+//
+// Note        :  1. Costs are evaluated for the rank with the largest number of radial indices r
+//                2. Memory   : symmetry-compressed dense kernel (an upper bound for the H-matrix kernel)
+//                              + RhoK + PhiK_All + PhiK + density receive buffer
+//                3. Comm     : density received in Patch2Slab + partial PhiK sent/received in the reduction
+//                              of Pot_Isolated + potential sent in Slab2Patch
+//                4. NFFT     : forward FFTs of all r' slabs + inverse FFTs of the owned r slabs
+//                              --> each of which skips the zero-padded z half (see CylFFTW_Forward)
+//                5. Time     : (FFT + kernel multiplication flops)/(OMP_NTHREAD*TUNE_FLOP_RATE)
+//                              + Comm/TUNE_BANDWIDTH
+//
+// Parameter   :  Cost : Cost model with NRank_I and NRank_IP set on input
+//-------------------------------------------------------------------------------------------------------
+void CylRankCost( CylRankCost_t &Cost )
+{
+
+   const double MB        = 1048576.0;
+   const int    NRank_I   = Cost.NRank_I;
+   const int    NRank_IP  = Cost.NRank_IP;
+   const long   slab_size = (long)2*( NX0_TOT[1]/2 + 1 )*2*NX0_TOT[2];
+   const long   NCell_YZ  = (long)NX0_TOT[1]*NX0_TOT[2];
+   const long   kernel_sz = (long)( NX0_TOT[2] + 1 )*kernel_nm;
+   const int    nx        = NX0_TOT[0] - ( NX0_TOT[0]/NRank_I )*( NRank_I - 1 );   // the last RANK_I is the largest
+   const int    nxp       = NX0_TOT[0] / NRank_IP;
+   const int    NOwn      = ( nx + NRank_IP - 1 ) / NRank_IP;
+   const long   phik_row  = (long)2*( 2*NX0_TOT[2] )*kernel_nm;
+   const double FFT_Flop  = 2.5*NX0_TOT[2]*NX0_TOT[1]*log2( (double)NX0_TOT[1] )          // y r2c of the data rows
+                          + 10.0*NX0_TOT[2]*( NX0_TOT[1]/2 + 1 )*log2( (double)NX0_TOT[2] ); // z DFT of both halves
+
+   Cost.Mem  = (   (double)nx*nxp*kernel_sz + (double)nxp*slab_size + (double)nx*phik_row
+                 + (double)NOwn*slab_size + (double)nxp*NCell_YZ  )*sizeof(real)/MB;
+
+   Cost.Comm = (   (double)nxp*NCell_YZ
+                 + 2.0*nx*phik_row*( NRank_IP - 1 )/NRank_IP
+                 + (double)NOwn*NCell_YZ  )*sizeof(real)/MB;
+
+   Cost.NFFT = nxp + NOwn;
+
+   const double Flop = Cost.NFFT*FFT_Flop + 2.0*nx*nxp*(double)phik_row;
+
+   Cost.Time = Flop/( OMP_NTHREAD*TUNE_FLOP_RATE ) + Cost.Comm*MB/TUNE_BANDWIDTH;
+
+} // FUNCTION : CylRankCost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CompareTime
+// Description :  Comparison function for sorting the candidates by the predicted time in ascending order
+//                (ties are broken by the memory per rank)
+//-------------------------------------------------------------------------------------------------------
+int CompareTime( const void *a, const void *b )
+{
+
+   const CylRankCost_t *A = (const CylRankCost_t *)a;
+   const CylRankCost_t *B = (const CylRankCost_t *)b;
+
+   if ( A->Time != B->Time )  return ( A->Time < B->Time ) ? -1 : +1;
+   if ( A->Mem  != B->Mem  )  return ( A->Mem  < B->Mem  ) ? -1 : +1;
+
+   return 0;
+
+} // FUNCTION : CompareTime
+
+
+
+#endif // #if ( COORDINATE == CYLINDRICAL  &&  defined GRAVITY )
@@ -11,7 +11,52 @@ rfftwnd_mpi_plan FFTW_Plan, FFTW_Plan_Inv, FFTW_Plan_PS;
 #endif
 
 #elif ( COORDINATE == CYLINDRICAL )
-rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv;
+// the isolated BC zero-pads z to 2*NX0_TOT[2], but the padded half is never stored or transformed
+// --> the forward transform applies the real-to-complex FFT along y to the NX0_TOT[2] data rows only and
+//     splits the length-2*NX0_TOT[2] DFT along z into the even and odd wavenumbers, each of which is a
+//     length-NX0_TOT[2] DFT of the data rows (see CylFFTW_Forward)
+// --> k-space rows 0 ... NX0_TOT[2]-1 store kz = 2*row and rows NX0_TOT[2] ... 2*NX0_TOT[2]-1 store
+//     kz = 2*(row-NX0_TOT[2])+1
+// --> the inverse transform only computes the z < NX0_TOT[2] half kept by Slab2Patch()
+static real *CylFFTW_Twiddle = NULL;   // cos/sin( pi*z/NX0_TOT[2] ) of the odd wavenumbers
+
+template <typename T> static void CylFFTW_Split( T *Data, const int NSlab );
+template <typename T> static void CylFFTW_Merge( T *Data, const int NSlab );
+
+#ifdef SUPPORT_FFTW3
+// FFTW3_REAL( name ) --> fftw_name/fftwf_name for FLOAT8 on/off
+#ifdef FLOAT8
+#  define FFTW3_REAL( name )  FFTW_MANGLE_DOUBLE( name )
+#else
+#  define FFTW3_REAL( name )  FFTW_MANGLE_FLOAT( name )
+#endif
+
+// wisdom files loaded/stored for CYL_FFTW3_WISDOM
+#define FFTW3_WISDOM_FILE     "FFTW3_Wisdom"
+#define FFTW3_WISDOM_FILE_F   "FFTW3_Wisdom_Single"
+
+static FFTW3_REAL(plan) FFTW3_Plan_Slab     = NULL;           // one padded slab (for constructing the kernel)
+static FFTW3_REAL(plan) FFTW3_Plan_Fwd[2]   = { NULL, NULL }; // y r2c / z DFT of all RhoK slabs in one call
+static FFTW3_REAL(plan) FFTW3_Plan_Inv[2]   = { NULL, NULL }; // z DFT / y c2r of all PhiK slabs in one call
+static int              FFTW3_NSlab_Fwd     = 0;
+static int              FFTW3_NSlab_Inv     = 0;
+#ifdef FLOAT8
+static fftwf_plan       FFTW3_Plan_Fwd_f[2] = { NULL, NULL }; // single-precision plans for CYL_FFTW3_SINGLE
+static fftwf_plan       FFTW3_Plan_Inv_f[2] = { NULL, NULL };
+static float           *FFTW3_Buf_f         = NULL;
+#endif
+
+static void CylFFTW_Wisdom( const bool Import );
+static void CylFFTW_DestroyBatch();
+#ifdef FLOAT8
+static void CylFFTW_Single( const bool Forward, real *Data, const int NSlab );
+#endif
+
+#else
+rfftwnd_plan     FFTW_Plan;                          // one padded slab (for constructing the kernel)
+static rfftwnd_plan FFTW_Plan_Y, FFTW_Plan_Y_Inv;    // y r2c / c2r of a single row
+static fftw_plan    FFTW_Plan_Z, FFTW_Plan_Z_Inv;    // length-NX0_TOT[2] z DFT of a single column
+#endif // #ifdef SUPPORT_FFTW3 ... else ...
 
 #endif // COORDINATE ... 
 
@@ -64,8 +109,20 @@ void End_FFTW()
    
    
 #  elif ( COORDINATE == CYLINDRICAL )
-   rfftwnd_destroy_plan    ( FFTW_Plan     );
-   rfftwnd_destroy_plan    ( FFTW_Plan_Inv );
+#  ifdef SUPPORT_FFTW3
+   if ( FFTW3_Plan_Slab  != NULL )  FFTW3_REAL(destroy_plan)( FFTW3_Plan_Slab );
+   CylFFTW_DestroyBatch();
+
+#  else
+   rfftwnd_destroy_plan    ( FFTW_Plan       );
+   rfftwnd_destroy_plan    ( FFTW_Plan_Y     );
+   rfftwnd_destroy_plan    ( FFTW_Plan_Y_Inv );
+   fftw_destroy_plan       ( FFTW_Plan_Z     );
+   fftw_destroy_plan       ( FFTW_Plan_Z_Inv );
+#  endif // #ifdef SUPPORT_FFTW3 ... else ...
+
+   delete [] CylFFTW_Twiddle;
+   CylFFTW_Twiddle = NULL;
    
 #  endif // COORDINATE ...
 
@@ -136,21 +193,611 @@ void Init_CrtFFTW()  {
 #elif (COORDINATE == CYLINDRICAL)
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_CylFFTW
-// Description :  Create the 2D FFTW plans 
+// Description :  Create the FFTW plans and the twiddle factors of the pruned z transform
+//
+// Note        :  1. SUPPORT_FFTW3 : only the single-slab plan used by CylFFTW_Slab() is created here
+//                   --> the batched plans depend on the radial decomposition and are created by
+//                       Init_CylFFTW_Batch() after RhoK and PhiK are allocated
+//                2. SUPPORT_FFTW3 : import the wisdom first if CYL_FFTW3_WISDOM is on
+//                3. The padded 2D plan is only used for the kernel, whose z extent is entirely non-zero
 //-------------------------------------------------------------------------------------------------------
 void Init_CylFFTW(){
-      
+
    // determine the FFT size; FFT_Size[0] is redundunt
    int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2]*2 };
 
-   FFTW_Plan     = rfftw2d_create_plan( FFT_Size[2], FFT_Size[1], FFTW_REAL_TO_COMPLEX, 
-                                        FFTW_MEASURE | FFTW_IN_PLACE );
+   // twiddle factors exp( -i*pi*z/NX0_TOT[2] ) of the odd wavenumbers along z
+   delete [] CylFFTW_Twiddle;
+   CylFFTW_Twiddle = new real [ 2*NX0_TOT[2] ];
+
+   for (int z=0; z<NX0_TOT[2]; z++)
+   {
+      CylFFTW_Twiddle[2*z+0] = (real)cos( M_PI*z/NX0_TOT[2] );
+      CylFFTW_Twiddle[2*z+1] = (real)sin( M_PI*z/NX0_TOT[2] );
+   }
+
+#  ifdef SUPPORT_FFTW3
+#  ifdef OPENMP
+   FFTW3_REAL(init_threads)();
+#  ifdef FLOAT8
+   fftwf_init_threads();
+#  endif
+#  endif
+
+   if ( CYL_FFTW3_WISDOM )    CylFFTW_Wisdom( true );
+
+   // the single-slab plan is executed concurrently by different OpenMP threads when constructing the kernel
+   // --> one FFTW thread per execution
+   // --> the new-array execute function requires the same alignment as the array used for planning,
+   //     which is guaranteed by CylFFTW_AllocateSlab()
+   real **Slab = NULL;
+   CylFFTW_AllocateSlab( Slab, 1 );
+
+#  ifdef OPENMP
+   FFTW3_REAL(plan_with_nthreads)( 1 );
+#  endif
+   FFTW3_Plan_Slab = FFTW3_REAL(plan_dft_r2c_2d)( FFT_Size[2], FFT_Size[1], Slab[0], (FFTW3_REAL(complex)*)Slab[0],
+                                                  FFTW_MEASURE );
+
+   CylFFTW_DeallocateSlab( Slab );
+
+   if ( FFTW3_Plan_Slab == NULL )   Aux_Error( ERROR_INFO, "failed to create the FFTW3 single-slab plan !!\n" );
+
+#  else
+   // the same plan is executed concurrently by different OpenMP threads in the cylindrical Poisson solver
+   // --> FFTW_THREADSAFE disables the work array stored in the plan
+#  ifdef OPENMP
+   const int Flag = FFTW_MEASURE | FFTW_IN_PLACE | FFTW_THREADSAFE;
+#  else
+   const int Flag = FFTW_MEASURE | FFTW_IN_PLACE;
+#  endif
+
+   FFTW_Plan       = rfftw2d_create_plan( FFT_Size[2], FFT_Size[1], FFTW_REAL_TO_COMPLEX, Flag );
+
+   FFTW_Plan_Y     = rfftwnd_create_plan( 1, &FFT_Size[1], FFTW_REAL_TO_COMPLEX, Flag );
+   FFTW_Plan_Y_Inv = rfftwnd_create_plan( 1, &FFT_Size[1], FFTW_COMPLEX_TO_REAL, Flag );
+
+   FFTW_Plan_Z     = fftw_create_plan( NX0_TOT[2], FFTW_FORWARD,  Flag );
+   FFTW_Plan_Z_Inv = fftw_create_plan( NX0_TOT[2], FFTW_BACKWARD, Flag );
+#  endif // #ifdef SUPPORT_FFTW3 ... else ...
 
-   FFTW_Plan_Inv = rfftw2d_create_plan( FFT_Size[2], FFT_Size[1], FFTW_COMPLEX_TO_REAL, 
-                                        FFTW_MEASURE | FFTW_IN_PLACE );
-   
 } //FUNCTION: Init_CylFFTW
 
+
+
+#ifdef SUPPORT_FFTW3
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_CylFFTW_Batch
+// Description :  Create the FFTW3 plans transforming all slabs of RhoK and PhiK in a single call
+//
+// Note        :  1. Invoked by Init_MemAllocate_CylPoisson()
+//                2. Planning with FFTW_MEASURE overwrites RhoK and PhiK
+//                3. Each transform is multithreaded by FFTW itself with OMP_NTHREAD threads
+//                4. Also create the single-precision plans on a float buffer if CYL_FFTW3_SINGLE is on
+//                5. Export the wisdom if CYL_FFTW3_WISDOM is on
+//                6. No inverse plan is created if this rank owns no PhiK slab (NSlab_Phi == 0)
+//                7. Plans created by a previous call are destroyed first (e.g., for the trial solves of
+//                   Init_CylRankTuner())
+//                8. Two plans for each direction (see CylFFTW_Forward)
+//                   --> y : r2c/c2r of the NX0_TOT[2] data rows of each slab
+//                   --> z : length-NX0_TOT[2] DFT of each column of the even and odd halves of each slab,
+//                           which are equally spaced, so 2*NSlab halves are transformed in one call
+//
+// Parameter   :  RhoK      : Slab array of density   (allocated by CylFFTW_AllocateSlab())
+//                NSlab_Rho : Number of slabs in RhoK
+//                PhiK      : Slab array of potential (allocated by CylFFTW_AllocateSlab())
+//                NSlab_Phi : Number of slabs in PhiK
+//-------------------------------------------------------------------------------------------------------
+void Init_CylFFTW_Batch( real **RhoK, const int NSlab_Rho, real **PhiK, const int NSlab_Phi )
+{
+
+   const int Nz        = NX0_TOT[2];
+   const int kernel_ny = NX0_TOT[1]/2 + 1;
+   const int local_ny  = 2*kernel_ny;
+   const int slab_size = local_ny*2*Nz;
+
+   CylFFTW_DestroyBatch();
+
+   FFTW3_NSlab_Fwd = NSlab_Rho;
+   FFTW3_NSlab_Inv = NSlab_Phi;
+
+// strides of the real/complex data are in units of real/complex
+   FFTW3_REAL(iodim) Dim_Y   [1] = { { NX0_TOT[1], 1, 1 } };
+   FFTW3_REAL(iodim) Dim_Z   [1] = { { Nz, kernel_ny, kernel_ny } };
+   FFTW3_REAL(iodim) Many_R2C[2] = { { NSlab_Rho, slab_size, slab_size/2 }, { Nz, local_ny, kernel_ny } };
+   FFTW3_REAL(iodim) Many_C2R[2] = { { NSlab_Phi, slab_size/2, slab_size }, { Nz, kernel_ny, local_ny } };
+   FFTW3_REAL(iodim) Many_Fwd[2] = { { 2*NSlab_Rho, Nz*kernel_ny, Nz*kernel_ny }, { kernel_ny, 1, 1 } };
+   FFTW3_REAL(iodim) Many_Inv[2] = { { 2*NSlab_Phi, Nz*kernel_ny, Nz*kernel_ny }, { kernel_ny, 1, 1 } };
+
+#  ifdef OPENMP
+   FFTW3_REAL(plan_with_nthreads)( OMP_NTHREAD );
+#  endif
+
+   FFTW3_Plan_Fwd[0] = FFTW3_REAL(plan_guru_dft_r2c)( 1, Dim_Y, 2, Many_R2C, RhoK[0], (FFTW3_REAL(complex)*)RhoK[0],
+                                                      FFTW_MEASURE );
+   FFTW3_Plan_Fwd[1] = FFTW3_REAL(plan_guru_dft)( 1, Dim_Z, 2, Many_Fwd, (FFTW3_REAL(complex)*)RhoK[0],
+                                                  (FFTW3_REAL(complex)*)RhoK[0], FFTW_FORWARD, FFTW_MEASURE );
+
+   if ( NSlab_Phi > 0 )
+   {
+      FFTW3_Plan_Inv[0] = FFTW3_REAL(plan_guru_dft)( 1, Dim_Z, 2, Many_Inv, (FFTW3_REAL(complex)*)PhiK[0],
+                                                     (FFTW3_REAL(complex)*)PhiK[0], FFTW_BACKWARD, FFTW_MEASURE );
+      FFTW3_Plan_Inv[1] = FFTW3_REAL(plan_guru_dft_c2r)( 1, Dim_Y, 2, Many_C2R, (FFTW3_REAL(complex)*)PhiK[0], PhiK[0],
+                                                         FFTW_MEASURE );
+   }
+
+   if (  FFTW3_Plan_Fwd[0] == NULL  ||  FFTW3_Plan_Fwd[1] == NULL  ||
+         ( NSlab_Phi > 0 && ( FFTW3_Plan_Inv[0] == NULL || FFTW3_Plan_Inv[1] == NULL ) )  )
+      Aux_Error( ERROR_INFO, "failed to create the FFTW3 batched plans (NSlab_Rho %d, NSlab_Phi %d) !!\n",
+                 NSlab_Rho, NSlab_Phi );
+
+#  ifdef FLOAT8
+   if ( CYL_FFTW3_SINGLE )
+   {
+      fftwf_iodim Dim_Y_f   [1] = { { NX0_TOT[1], 1, 1 } };
+      fftwf_iodim Dim_Z_f   [1] = { { Nz, kernel_ny, kernel_ny } };
+      fftwf_iodim Many_R2C_f[2] = { { NSlab_Rho, slab_size, slab_size/2 }, { Nz, local_ny, kernel_ny } };
+      fftwf_iodim Many_C2R_f[2] = { { NSlab_Phi, slab_size/2, slab_size }, { Nz, kernel_ny, local_ny } };
+      fftwf_iodim Many_Fwd_f[2] = { { 2*NSlab_Rho, Nz*kernel_ny, Nz*kernel_ny }, { kernel_ny, 1, 1 } };
+      fftwf_iodim Many_Inv_f[2] = { { 2*NSlab_Phi, Nz*kernel_ny, Nz*kernel_ny }, { kernel_ny, 1, 1 } };
+
+      FFTW3_Buf_f = fftwf_alloc_real( (size_t)MAX( NSlab_Rho, NSlab_Phi )*slab_size );
+
+#     ifdef OPENMP
+      fftwf_plan_with_nthreads( OMP_NTHREAD );
+#     endif
+
+      FFTW3_Plan_Fwd_f[0] = fftwf_plan_guru_dft_r2c( 1, Dim_Y_f, 2, Many_R2C_f, FFTW3_Buf_f, (fftwf_complex*)FFTW3_Buf_f,
+                                                     FFTW_MEASURE );
+      FFTW3_Plan_Fwd_f[1] = fftwf_plan_guru_dft( 1, Dim_Z_f, 2, Many_Fwd_f, (fftwf_complex*)FFTW3_Buf_f,
+                                                 (fftwf_complex*)FFTW3_Buf_f, FFTW_FORWARD, FFTW_MEASURE );
+
+      if ( NSlab_Phi > 0 )
+      {
+         FFTW3_Plan_Inv_f[0] = fftwf_plan_guru_dft( 1, Dim_Z_f, 2, Many_Inv_f, (fftwf_complex*)FFTW3_Buf_f,
+                                                    (fftwf_complex*)FFTW3_Buf_f, FFTW_BACKWARD, FFTW_MEASURE );
+         FFTW3_Plan_Inv_f[1] = fftwf_plan_guru_dft_c2r( 1, Dim_Y_f, 2, Many_C2R_f, (fftwf_complex*)FFTW3_Buf_f,
+                                                        FFTW3_Buf_f, FFTW_MEASURE );
+      }
+
+      if (  FFTW3_Plan_Fwd_f[0] == NULL  ||  FFTW3_Plan_Fwd_f[1] == NULL  ||
+            ( NSlab_Phi > 0 && ( FFTW3_Plan_Inv_f[0] == NULL || FFTW3_Plan_Inv_f[1] == NULL ) )  )
+         Aux_Error( ERROR_INFO, "failed to create the FFTW3 single-precision plans !!\n" );
+   }
+#  endif
+
+   if ( CYL_FFTW3_WISDOM )    CylFFTW_Wisdom( false );
+
+} // FUNCTION : Init_CylFFTW_Batch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFFTW_DestroyBatch
+// Description :  Destroy the batched FFTW3 plans and the float buffer created by Init_CylFFTW_Batch()
+//-------------------------------------------------------------------------------------------------------
+void CylFFTW_DestroyBatch()
+{
+
+   for (int p=0; p<2; p++)
+   {
+      if ( FFTW3_Plan_Fwd  [p] != NULL )  FFTW3_REAL(destroy_plan)( FFTW3_Plan_Fwd[p] );
+      if ( FFTW3_Plan_Inv  [p] != NULL )  FFTW3_REAL(destroy_plan)( FFTW3_Plan_Inv[p] );
+      FFTW3_Plan_Fwd[p] = FFTW3_Plan_Inv[p] = NULL;
+#     ifdef FLOAT8
+      if ( FFTW3_Plan_Fwd_f[p] != NULL )  fftwf_destroy_plan( FFTW3_Plan_Fwd_f[p] );
+      if ( FFTW3_Plan_Inv_f[p] != NULL )  fftwf_destroy_plan( FFTW3_Plan_Inv_f[p] );
+      FFTW3_Plan_Fwd_f[p] = FFTW3_Plan_Inv_f[p] = NULL;
+#     endif
+   }
+
+#  ifdef FLOAT8
+   if ( FFTW3_Buf_f != NULL )  fftwf_free( FFTW3_Buf_f );
+   FFTW3_Buf_f = NULL;
+#  endif
+
+} // FUNCTION : CylFFTW_DestroyBatch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFFTW_Wisdom
+// Description :  Import/export the FFTW3 wisdom from/to the file FFTW3_WISDOM_FILE
+//                (and FFTW3_WISDOM_FILE_F for the single-precision plans of CYL_FFTW3_SINGLE)
+//
+// Note        :  1. Import : MPI_Rank 0 loads the file and broadcasts it to all ranks
+//                            --> skipped if the file does not exist
+//                2. Export : only MPI_Rank 0 writes the file
+//                            --> ranks with a different number of slabs may still need to plan from scratch
+//
+// Parameter   :  Import : true/false --> import/export
+//-------------------------------------------------------------------------------------------------------
+void CylFFTW_Wisdom( const bool Import )
+{
+
+#  ifdef FLOAT8
+   const int   NFile       = 2;
+#  else
+   const int   NFile       = 1;
+#  endif
+   const char *FileName[2] = { FFTW3_WISDOM_FILE, FFTW3_WISDOM_FILE_F };
+
+   for (int f=0; f<NFile; f++)
+   {
+      if ( Import )
+      {
+         long  Length = 0;
+         char *Wisdom = NULL;
+
+         if ( MPI_Rank == 0  &&  Aux_CheckFileExist(FileName[f]) )
+         {
+            FILE *File = fopen( FileName[f], "r" );
+
+            fseek( File, 0, SEEK_END );
+            Length = ftell( File );
+            fseek( File, 0, SEEK_SET );
+
+            Wisdom = new char [Length+1];
+            Length = fread( Wisdom, sizeof(char), Length, File );
+            Wisdom[Length] = '\0';
+
+            fclose( File );
+         }
+
+         MPI_Bcast( &Length, 1, MPI_LONG, 0, MPI_COMM_WORLD );
+
+         if ( Length == 0 )   continue;
+
+         if ( MPI_Rank != 0 )    Wisdom = new char [Length+1];
+
+         MPI_Bcast( Wisdom, (int)Length+1, MPI_CHAR, 0, MPI_COMM_WORLD );
+
+         const int Success = ( f == 0 ) ? FFTW3_REAL(import_wisdom_from_string)( Wisdom )
+                                        : fftwf_import_wisdom_from_string( Wisdom );
+
+         if ( !Success  &&  MPI_Rank == 0 )
+            Aux_Message( stderr, "WARNING : failed to import the FFTW3 wisdom from \"%s\" !!\n", FileName[f] );
+
+         delete [] Wisdom;
+      } // if ( Import )
+
+      else if ( MPI_Rank == 0 )
+      {
+         char *Wisdom = ( f == 0 ) ? FFTW3_REAL(export_wisdom_to_string)()
+                                   : fftwf_export_wisdom_to_string();
+         FILE *File   = fopen( FileName[f], "w" );
+
+         fputs( Wisdom, File );
+         fclose( File );
+
+         free( Wisdom );
+      } // if ( Import ) ... else if ...
+   } // for (int f=0; f<NFile; f++)
+
+} // FUNCTION : CylFFTW_Wisdom
+
+
+
+#ifdef FLOAT8
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFFTW_Single
+// Description :  Execute the transform of CylFFTW_Forward() / CylFFTW_Inverse() on double-precision data with
+//                the single-precision plans of CYL_FFTW3_SINGLE
+//
+// Note        :  1. Copy the rows read by the transform to the float buffer, transform in place, and copy
+//                   the rows written by the transform back
+//                   --> forward : z < NX0_TOT[2] rows in, all rows out
+//                   --> inverse : all rows in, z < NX0_TOT[2] rows out
+//
+// Parameter   :  Forward : true/false --> forward/inverse transform
+//                Data    : Data to be transformed in place
+//                NSlab   : Number of slabs in Data[]
+//-------------------------------------------------------------------------------------------------------
+void CylFFTW_Single( const bool Forward, real *Data, const int NSlab )
+{
+
+   const long slab_size = (long)2*( NX0_TOT[1]/2 + 1 )*2*NX0_TOT[2];
+   const long NIn       = ( Forward ) ? slab_size/2 : slab_size;
+   const long NOut      = ( Forward ) ? slab_size   : slab_size/2;
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<NSlab*NIn; t++)
+   {
+      const long idx = ( t/NIn )*slab_size + t%NIn;
+      FFTW3_Buf_f[idx] = (float)Data[idx];
+   }
+
+   if ( Forward )
+   {
+      fftwf_execute( FFTW3_Plan_Fwd_f[0] );
+      CylFFTW_Split( FFTW3_Buf_f, NSlab );
+      fftwf_execute( FFTW3_Plan_Fwd_f[1] );
+   }
+
+   else
+   {
+      fftwf_execute( FFTW3_Plan_Inv_f[0] );
+      CylFFTW_Merge( FFTW3_Buf_f, NSlab );
+      fftwf_execute( FFTW3_Plan_Inv_f[1] );
+   }
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<NSlab*NOut; t++)
+   {
+      const long idx = ( t/NOut )*slab_size + t%NOut;
+      Data[idx] = (real)FFTW3_Buf_f[idx];
+   }
+
+} // FUNCTION : CylFFTW_Single
+#endif // #ifdef FLOAT8
+#endif // #ifdef SUPPORT_FFTW3
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFFTW_Slab
+// Description :  In-place real-to-complex FFT of a single slab
+//
+// Note        :  1. Can be invoked concurrently by different OpenMP threads
+//                2. SUPPORT_FFTW3 : Slab must be allocated by CylFFTW_AllocateSlab()
+//
+// Parameter   :  Slab : Slab to be transformed
+//-------------------------------------------------------------------------------------------------------
+void CylFFTW_Slab( real *Slab )
+{
+
+#  ifdef SUPPORT_FFTW3
+   FFTW3_REAL(execute_dft_r2c)( FFTW3_Plan_Slab, Slab, (FFTW3_REAL(complex)*)Slab );
+#  else
+   rfftwnd_one_real_to_complex( FFTW_Plan, Slab, NULL );
+#  endif
+
+} // FUNCTION : CylFFTW_Slab
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFFTW_Forward / CylFFTW_Inverse
+// Description :  In-place real-to-complex / complex-to-real FFT of all slabs in Slab[] with the z direction
+//                zero-padded to 2*NX0_TOT[2]
+//
+// Note        :  1. Forward : only the rows z < NX0_TOT[2] are read, so the padded half need not be zeroed
+//                   --> (a) r2c along y of the data rows
+//                       (b) copy the twiddled rows to the odd half (CylFFTW_Split)
+//                       (c) length-NX0_TOT[2] DFT along z of both halves
+//                2. Inverse : only the rows z < NX0_TOT[2] are computed, and the other rows are garbage
+//                   --> (a) length-NX0_TOT[2] inverse DFT along z of both halves
+//                       (b) add the twiddled odd half to the even half (CylFFTW_Merge)
+//                       (c) c2r along y of the data rows
+//                3. k-space rows are ordered as kz = 0, 2, 4, ..., 1, 3, 5, ... (see the top of this file)
+//                4. FFTW2 : OpenMP-parallelized over slabs (y) and halves (z)
+//                   --> the plans are created with FFTW_THREADSAFE under OPENMP (see Init_CylFFTW)
+//                5. FFTW3 : all slabs in one call with the batched plans of Init_CylFFTW_Batch()
+//                   --> NSlab must match the number of slabs used for planning
+//                6. The inverse transform is not normalized
+//
+// Parameter   :  Slab  : Slabs allocated by CylFFTW_AllocateSlab()
+//                NSlab : Number of slabs
+//-------------------------------------------------------------------------------------------------------
+void CylFFTW_Forward( real **Slab, const int NSlab )
+{
+
+#  ifdef SUPPORT_FFTW3
+   if ( NSlab != FFTW3_NSlab_Fwd )
+      Aux_Error( ERROR_INFO, "NSlab (%d) != number of slabs in the forward plan (%d) !!\n", NSlab, FFTW3_NSlab_Fwd );
+
+#  ifdef FLOAT8
+   if ( CYL_FFTW3_SINGLE )
+   {
+      CylFFTW_Single( true, Slab[0], NSlab );
+      return;
+   }
+#  endif
+
+   FFTW3_REAL(execute_dft_r2c)( FFTW3_Plan_Fwd[0], Slab[0], (FFTW3_REAL(complex)*)Slab[0] );
+
+   CylFFTW_Split( Slab[0], NSlab );
+
+   FFTW3_REAL(execute_dft)( FFTW3_Plan_Fwd[1], (FFTW3_REAL(complex)*)Slab[0], (FFTW3_REAL(complex)*)Slab[0] );
+
+#  else
+   const int Nz        = NX0_TOT[2];
+   const int kernel_ny = NX0_TOT[1]/2 + 1;
+
+#  pragma omp parallel for schedule( static )
+   for (int s=0; s<NSlab; s++)
+      rfftwnd_real_to_complex( FFTW_Plan_Y, Nz, Slab[s], 1, 2*kernel_ny, NULL, 1, kernel_ny );
+
+   CylFFTW_Split( Slab[0], NSlab );
+
+#  pragma omp parallel for schedule( static )
+   for (int h=0; h<2*NSlab; h++)
+      fftw( FFTW_Plan_Z, kernel_ny, (fftw_complex *)Slab[0] + (long)h*Nz*kernel_ny, kernel_ny, 1, NULL, 0, 0 );
+#  endif
+
+} // FUNCTION : CylFFTW_Forward
+
+
+
+void CylFFTW_Inverse( real **Slab, const int NSlab )
+{
+
+#  ifdef SUPPORT_FFTW3
+   if ( NSlab != FFTW3_NSlab_Inv )
+      Aux_Error( ERROR_INFO, "NSlab (%d) != number of slabs in the inverse plan (%d) !!\n", NSlab, FFTW3_NSlab_Inv );
+#  endif
+
+   if ( NSlab == 0 )    return;
+
+#  ifdef SUPPORT_FFTW3
+#  ifdef FLOAT8
+   if ( CYL_FFTW3_SINGLE )
+   {
+      CylFFTW_Single( false, Slab[0], NSlab );
+      return;
+   }
+#  endif
+
+   FFTW3_REAL(execute_dft)( FFTW3_Plan_Inv[0], (FFTW3_REAL(complex)*)Slab[0], (FFTW3_REAL(complex)*)Slab[0] );
+
+   CylFFTW_Merge( Slab[0], NSlab );
+
+   FFTW3_REAL(execute_dft_c2r)( FFTW3_Plan_Inv[1], (FFTW3_REAL(complex)*)Slab[0], Slab[0] );
+
+#  else
+   const int Nz        = NX0_TOT[2];
+   const int kernel_ny = NX0_TOT[1]/2 + 1;
+
+#  pragma omp parallel for schedule( static )
+   for (int h=0; h<2*NSlab; h++)
+      fftw( FFTW_Plan_Z_Inv, kernel_ny, (fftw_complex *)Slab[0] + (long)h*Nz*kernel_ny, kernel_ny, 1, NULL, 0, 0 );
+
+   CylFFTW_Merge( Slab[0], NSlab );
+
+#  pragma omp parallel for schedule( static )
+   for (int s=0; s<NSlab; s++)
+      rfftwnd_complex_to_real( FFTW_Plan_Y_Inv, Nz, (fftw_complex *)Slab[s], 1, kernel_ny, NULL, 1, 2*kernel_ny );
+#  endif
+
+} // FUNCTION : CylFFTW_Inverse
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFFTW_Split / CylFFTW_Merge
+// Description :  Split the y-transformed data rows into the inputs of the even and odd z wavenumbers /
+//                merge the inverse-transformed even and odd halves into the data rows
+//
+// Note        :  1. With Nz = NX0_TOT[2] and F(z) = 0 for z >= Nz, the length-2*Nz DFT along z satisfies
+//                      G(2m)   = sum_{z<Nz} F(z)                     exp(-2*pi*i*m*z/Nz)
+//                      G(2m+1) = sum_{z<Nz} F(z)*exp(-i*pi*z/Nz)     exp(-2*pi*i*m*z/Nz)
+//                   and its inverse for z < Nz satisfies
+//                      f(z)    = E(z) + exp(+i*pi*z/Nz)*O(z)
+//                   where E/O are the length-Nz inverse DFTs of G(2m)/G(2m+1)
+//                   --> Split : odd half = F(z)*exp(-i*pi*z/Nz)
+//                   --> Merge : even half += odd half*exp(+i*pi*z/Nz)
+//                2. The slabs in Data[] must be contiguous (see CylFFTW_AllocateSlab)
+//                3. Templated so that the float buffer of CYL_FFTW3_SINGLE can be processed as well
+//
+// Parameter   :  Data  : Slabs to be processed
+//                NSlab : Number of slabs
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+void CylFFTW_Split( T *Data, const int NSlab )
+{
+
+   const int  Nz        = NX0_TOT[2];
+   const int  kernel_ny = NX0_TOT[1]/2 + 1;
+   const long Half      = (long)2*Nz*kernel_ny;    // number of reals in each half of a slab
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<(long)NSlab*Nz; t++)
+   {
+      const long s    = t / Nz;
+      const int  z    = t % Nz;
+      const T    Cos  = (T)CylFFTW_Twiddle[2*z+0];
+      const T    Sin  = (T)CylFFTW_Twiddle[2*z+1];
+      const T   *Even = Data + 2*s*Half + (long)2*z*kernel_ny;
+      T         *Odd  = Data + 2*s*Half + (long)2*z*kernel_ny + Half;
+
+      for (int ky=0; ky<kernel_ny; ky++)
+      {
+         const T Re = Even[2*ky+0];
+         const T Im = Even[2*ky+1];
+
+         Odd[2*ky+0] = Re*Cos + Im*Sin;
+         Odd[2*ky+1] = Im*Cos - Re*Sin;
+      }
+   }
+
+} // FUNCTION : CylFFTW_Split
+
+
+
+template <typename T>
+void CylFFTW_Merge( T *Data, const int NSlab )
+{
+
+   const int  Nz        = NX0_TOT[2];
+   const int  kernel_ny = NX0_TOT[1]/2 + 1;
+   const long Half      = (long)2*Nz*kernel_ny;    // number of reals in each half of a slab
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<(long)NSlab*Nz; t++)
+   {
+      const long s    = t / Nz;
+      const int  z    = t % Nz;
+      const T    Cos  = (T)CylFFTW_Twiddle[2*z+0];
+      const T    Sin  = (T)CylFFTW_Twiddle[2*z+1];
+      T         *Even = Data + 2*s*Half + (long)2*z*kernel_ny;
+      const T   *Odd  = Data + 2*s*Half + (long)2*z*kernel_ny + Half;
+
+      for (int ky=0; ky<kernel_ny; ky++)
+      {
+         const T Re = Odd[2*ky+0];
+         const T Im = Odd[2*ky+1];
+
+         Even[2*ky+0] += Re*Cos - Im*Sin;
+         Even[2*ky+1] += Im*Cos + Re*Sin;
+      }
+   }
+
+} // FUNCTION : CylFFTW_Merge
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CylFFTW_AllocateSlab / CylFFTW_DeallocateSlab
+// Description :  Allocate/free NSlab contiguous FFT slabs and the pointer to each slab
+//
+// Note        :  1. Each slab has the padded size 2*(NX0_TOT[1]/2+1) * 2*NX0_TOT[2]
+//                   --> the rows z >= NX0_TOT[2] only hold the odd z wavenumbers in k-space (see CylFFTW_Forward)
+//                2. SUPPORT_FFTW3 : use the FFTW allocator so that the data are aligned for the SIMD codelets
+//                3. NSlab can be zero, in which case Slab[0] is NULL
+//
+// Parameter   :  Slab  : Slab array to be allocated/freed
+//                NSlab : Number of slabs
+//-------------------------------------------------------------------------------------------------------
+void CylFFTW_AllocateSlab( real **&Slab, const int NSlab )
+{
+
+   const long slab_size = (long)2*( NX0_TOT[1]/2 + 1 )*2*NX0_TOT[2];
+
+   Slab = new real* [ MAX(NSlab,1) ];
+
+   if ( NSlab == 0 )
+      Slab[0] = NULL;
+   else
+#  ifdef SUPPORT_FFTW3
+      Slab[0] = FFTW3_REAL(alloc_real)( (size_t)NSlab*slab_size );
+#  else
+      Slab[0] = new real [ NSlab*slab_size ];
+#  endif
+
+   for (int s=1; s<NSlab; s++)   Slab[s] = Slab[0] + s*slab_size;
+
+} // FUNCTION : CylFFTW_AllocateSlab
+
+
+
+void CylFFTW_DeallocateSlab( real **&Slab )
+{
+
+// do NOT free if Slab is NULL
+   if ( Slab == NULL )  return;
+
+#  ifdef SUPPORT_FFTW3
+   if ( Slab[0] != NULL )  FFTW3_REAL(free)( Slab[0] );
+#  else
+   delete [] Slab[0];
+#  endif
+
+   delete [] Slab;
+
+   Slab = NULL;
+
+} // FUNCTION : CylFFTW_DeallocateSlab
+
 #endif // if (COORDINATE == CARTESIAN), elif (COORDINATE == CYLINDRICAL)
 
 
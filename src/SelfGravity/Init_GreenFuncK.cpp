@@ -2,11 +2,13 @@
 
 #ifdef GRAVITY
 
+#if ( COORDINATE == CARTESIAN )
 #ifdef SERIAL
 extern rfftwnd_plan     FFTW_Plan;
 #else
 extern rfftwnd_mpi_plan FFTW_Plan;
 #endif
+#endif
 
 
 
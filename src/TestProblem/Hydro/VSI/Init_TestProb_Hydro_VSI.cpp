@@ -4,6 +4,9 @@
 static void Init_ExternalAcc() ;
 static void BC( real fluid[], const double x, const double y, const double z, const double Time,
                 const int lv, double AuxArray[] );
+#if ( COORDINATE == CYLINDRICAL )
+static double OrbAdv_Vphi_Equilibrium( const double R, const double Z, const double Time );
+#endif
                 
                 
 // problem-specific global variables
@@ -252,6 +255,34 @@ void BC( real fluid[], const double x, const double y, const double z, const dou
 
 
 
+#if ( COORDINATE == CYLINDRICAL )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  OrbAdv_Vphi_Equilibrium
+// Description :  Mean azimuthal velocity of orbital advection set to the equilibrium rotation curve
+//
+// Note        :  1. Linked to the function pointer "OrbAdv_Vphi_User_Ptr" (for OPT__ORBITAL_ADV == 2)
+//
+// Parameter   :  R/Z      : Cylindrical radius and height
+//                Time     : Physical time
+//
+// Return      :  Azimuthal velocity
+//-------------------------------------------------------------------------------------------------------
+double OrbAdv_Vphi_Equilibrium( const double R, const double Z, const double Time )
+{
+
+   const double temperature = T_0 * pow( R/R_0, slope_q );
+   const double cs_square   = const_R * temperature;
+   const double _sph_r      = 1.0 / sqrt( R*R + Z*Z );
+   const double omega_kep   = sqrt( GM*_sph_r );
+   const double H           = sqrt( cs_square )/omega_kep;
+
+   return R*omega_kep * sqrt( 1.0 + (slope_q+slope_p)*SQR(H/R) + slope_q*(1.0-R*_sph_r) );
+
+} // FUNCTION : OrbAdv_Vphi_Equilibrium
+#endif
+
+
+
 
 #endif // #if ( MODEL == HYDRO )
 
@@ -292,6 +323,9 @@ void Init_TestProb_Hydro_VSI()
    BC_User_Ptr              = NULL;
    Flu_ResetByUser_Func_Ptr = NULL;
    End_User_Ptr             = NULL;
+#  if ( COORDINATE == CYLINDRICAL )
+   OrbAdv_Vphi_User_Ptr     = OrbAdv_Vphi_Equilibrium;
+#  endif
 #ifdef GRAVITY
    Init_ExternalAcc_Ptr     = Init_ExternalAcc;       // option: OPT__GRAVITY_TYPE=2/3; example: SelfGravity/Init_ExternalAcc.cpp
 #endif //GRAVITY